@@ -0,0 +1,260 @@
+// MIT License
+//
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <limits>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+
+// Google Benchmark
+#include "benchmark/benchmark.h"
+// CmdParser
+#include "cmdparser.hpp"
+#include "benchmark_utils.hpp"
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/rocprim.hpp>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 128;
+#endif
+
+const unsigned int batch_size = 10;
+const unsigned int warmup_size = 5;
+
+enum class adjacent_difference_variant
+{
+    left,
+    right,
+    left_inplace,
+    right_inplace,
+    // The previous approach: transform over a zip_iterator of input and input + 1
+    // (every item is read twice and the first item is not copied)
+    transform_zip
+};
+
+template<class T>
+struct difference_op
+{
+    __device__ __host__
+    T operator()(const rocprim::tuple<T, T>& t) const
+    {
+        return rocprim::get<1>(t) - rocprim::get<0>(t);
+    }
+};
+
+template<class T>
+hipError_t dispatch_adjacent_difference(adjacent_difference_variant variant,
+                                        void * d_temporary_storage,
+                                        size_t& temporary_storage_bytes,
+                                        T * d_input,
+                                        T * d_output,
+                                        size_t size,
+                                        const hipStream_t stream)
+{
+    switch(variant)
+    {
+        case adjacent_difference_variant::left:
+            return rocprim::adjacent_difference(
+                d_temporary_storage, temporary_storage_bytes,
+                d_input, d_output, size, rocprim::minus<T>(), stream
+            );
+        case adjacent_difference_variant::right:
+            return rocprim::adjacent_difference_right(
+                d_temporary_storage, temporary_storage_bytes,
+                d_input, d_output, size, rocprim::minus<T>(), stream
+            );
+        case adjacent_difference_variant::left_inplace:
+            return rocprim::adjacent_difference_inplace(
+                d_temporary_storage, temporary_storage_bytes,
+                d_input, size, rocprim::minus<T>(), stream
+            );
+        case adjacent_difference_variant::right_inplace:
+            return rocprim::adjacent_difference_right_inplace(
+                d_temporary_storage, temporary_storage_bytes,
+                d_input, size, rocprim::minus<T>(), stream
+            );
+        case adjacent_difference_variant::transform_zip:
+            temporary_storage_bytes = 4;
+            if(d_temporary_storage == nullptr)
+            {
+                return hipSuccess;
+            }
+            return rocprim::transform(
+                rocprim::make_zip_iterator(rocprim::make_tuple(d_input, d_input + 1)),
+                d_output + 1, size - 1, difference_op<T>(), stream
+            );
+    }
+    return hipErrorInvalidValue;
+}
+
+template<class T>
+void run_benchmark(benchmark::State& state,
+                   adjacent_difference_variant variant,
+                   size_t size,
+                   const hipStream_t stream)
+{
+    std::vector<T> input = get_random_data<T>(size, T(0), T(1000));
+
+    T * d_input;
+    T * d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_input, input.data(),
+            size * sizeof(T),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(
+        dispatch_adjacent_difference(
+            variant, nullptr, temporary_storage_bytes,
+            d_input, d_output, size, stream
+        )
+    );
+
+    void * d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(
+            dispatch_adjacent_difference(
+                variant, d_temporary_storage, temporary_storage_bytes,
+                d_input, d_output, size, stream
+            )
+        );
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(
+                dispatch_adjacent_difference(
+                    variant, d_temporary_storage, temporary_storage_bytes,
+                    d_input, d_output, size, stream
+                )
+            );
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+}
+
+#define CREATE_BENCHMARK(T, VARIANT) \
+benchmark::RegisterBenchmark( \
+    ("adjacent_difference<" #T ">(" #VARIANT ")"), \
+    run_benchmark<T>, adjacent_difference_variant::VARIANT, size, stream \
+)
+
+#define BENCHMARK_TYPE(type) \
+    CREATE_BENCHMARK(type, left), \
+    CREATE_BENCHMARK(type, right), \
+    CREATE_BENCHMARK(type, left_inplace), \
+    CREATE_BENCHMARK(type, right_inplace), \
+    CREATE_BENCHMARK(type, transform_zip)
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size = parser.get<size_t>("size");
+    const int trials = parser.get<int>("trials");
+
+    // HIP
+    hipStream_t stream = 0; // default
+    hipDeviceProp_t devProp;
+    int device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks =
+    {
+        BENCHMARK_TYPE(int),
+        BENCHMARK_TYPE(long long),
+        BENCHMARK_TYPE(int8_t),
+        BENCHMARK_TYPE(float),
+        BENCHMARK_TYPE(double),
+    };
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
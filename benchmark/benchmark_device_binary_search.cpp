@@ -56,10 +56,20 @@ const size_t DEFAULT_N = 1024 * 1024 * 32;
 const unsigned int batch_size = 10;
 const unsigned int warmup_size = 5;
 
+enum class search_algorithm
+{
+    binary_search,
+    // lower_bound_sorted_needles, needles must be sorted
+    merge_path,
+    // lower_bound with search_index, the index is built once before the benchmark
+    search_index
+};
+
 template<class T>
 void run_lower_bound_benchmark(benchmark::State& state, hipStream_t stream,
                                size_t haystack_size, size_t needles_size,
-                               bool sorted_needles)
+                               bool sorted_needles,
+                               search_algorithm algorithm)
 {
     using haystack_type = T;
     using needle_type = T;
@@ -100,50 +110,83 @@ void run_lower_bound_benchmark(benchmark::State& state, hipStream_t stream,
         )
     );
 
+    haystack_type * d_index = nullptr;
+    rocprim::search_index<haystack_type> index =
+        rocprim::make_search_index(d_index, haystack_size);
     void * d_temporary_storage = nullptr;
     size_t temporary_storage_bytes;
-    HIP_CHECK(
-        rocprim::lower_bound(
-            d_temporary_storage, temporary_storage_bytes,
-            d_haystack, d_needles, d_output,
-            haystack_size, needles_size,
-            compare_op,
-            stream
-        )
-    );
-
-    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
-
-    // Warm-up
-    for(size_t i = 0; i < warmup_size; i++)
+    if(algorithm == search_algorithm::search_index)
     {
+        HIP_CHECK(hipMalloc(&d_index, rocprim::search_index_size(haystack_size) * sizeof(haystack_type)));
+        index = rocprim::make_search_index(d_index, haystack_size);
+        HIP_CHECK(
+            rocprim::build_search_index(
+                d_temporary_storage, temporary_storage_bytes,
+                d_haystack, index,
+                stream
+            )
+        );
+        HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
         HIP_CHECK(
-            rocprim::lower_bound(
+            rocprim::build_search_index(
                 d_temporary_storage, temporary_storage_bytes,
-                d_haystack, d_needles, d_output,
-                haystack_size, needles_size,
-                compare_op,
+                d_haystack, index,
                 stream
             )
         );
+        HIP_CHECK(hipFree(d_temporary_storage));
+        d_temporary_storage = nullptr;
     }
-    HIP_CHECK(hipDeviceSynchronize());
 
-    for(auto _ : state)
+    auto run = [&](void * d_temporary_storage, size_t& temporary_storage_bytes)
     {
-        auto start = std::chrono::high_resolution_clock::now();
-
-        for(size_t i = 0; i < batch_size; i++)
+        switch(algorithm)
         {
-            HIP_CHECK(
-                rocprim::lower_bound(
+            case search_algorithm::merge_path:
+                return rocprim::lower_bound_sorted_needles(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_haystack, d_needles, d_output,
+                    haystack_size, needles_size,
+                    compare_op,
+                    stream
+                );
+            case search_algorithm::search_index:
+                return rocprim::lower_bound(
+                    d_temporary_storage, temporary_storage_bytes,
+                    index, d_needles, d_output,
+                    needles_size,
+                    compare_op,
+                    stream
+                );
+            default:
+                return rocprim::lower_bound(
                     d_temporary_storage, temporary_storage_bytes,
                     d_haystack, d_needles, d_output,
                     haystack_size, needles_size,
                     compare_op,
                     stream
-                )
-            );
+                );
+        }
+    };
+
+    HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
         }
         HIP_CHECK(hipDeviceSynchronize());
 
@@ -156,6 +199,10 @@ void run_lower_bound_benchmark(benchmark::State& state, hipStream_t stream,
     state.SetItemsProcessed(state.iterations() * batch_size * needles_size);
 
     HIP_CHECK(hipFree(d_temporary_storage));
+    if(d_index != nullptr)
+    {
+        HIP_CHECK(hipFree(d_index));
+    }
     HIP_CHECK(hipFree(d_haystack));
     HIP_CHECK(hipFree(d_needles));
     HIP_CHECK(hipFree(d_output));
@@ -167,12 +214,34 @@ benchmark::RegisterBenchmark( \
         std::string("lower_bound") + "<" #T ">(" #K "\% " + \
         (SORTED ? "sorted" : "random") + " needles)" \
     ).c_str(), \
-    [=](benchmark::State& state) { run_lower_bound_benchmark<T>(state, stream, size, size * K / 100, SORTED); } \
+    [=](benchmark::State& state) { run_lower_bound_benchmark<T>(state, stream, size, size * K / 100, SORTED, search_algorithm::binary_search); } \
+)
+
+#define CREATE_LOWER_BOUND_SORTED_NEEDLES_BENCHMARK(T, K) \
+benchmark::RegisterBenchmark( \
+    ( \
+        std::string("lower_bound_sorted_needles") + "<" #T ">(" #K "\% sorted needles)" \
+    ).c_str(), \
+    [=](benchmark::State& state) { run_lower_bound_benchmark<T>(state, stream, size, size * K / 100, true, search_algorithm::merge_path); } \
+)
+
+#define CREATE_LOWER_BOUND_SEARCH_INDEX_BENCHMARK(T, K) \
+benchmark::RegisterBenchmark( \
+    ( \
+        std::string("lower_bound_search_index") + "<" #T ">(" #K "\% random needles)" \
+    ).c_str(), \
+    [=](benchmark::State& state) { run_lower_bound_benchmark<T>(state, stream, size, size * K / 100, false, search_algorithm::search_index); } \
 )
 
 #define BENCHMARK_TYPE(type) \
     CREATE_LOWER_BOUND_BENCHMARK(type, 10, false), \
-    CREATE_LOWER_BOUND_BENCHMARK(type, 10, true)
+    CREATE_LOWER_BOUND_BENCHMARK(type, 10, true), \
+    CREATE_LOWER_BOUND_BENCHMARK(type, 100, true), \
+    CREATE_LOWER_BOUND_SORTED_NEEDLES_BENCHMARK(type, 10), \
+    CREATE_LOWER_BOUND_SORTED_NEEDLES_BENCHMARK(type, 100), \
+    CREATE_LOWER_BOUND_BENCHMARK(type, 100, false), \
+    CREATE_LOWER_BOUND_SEARCH_INDEX_BENCHMARK(type, 10), \
+    CREATE_LOWER_BOUND_SEARCH_INDEX_BENCHMARK(type, 100)
 
 int main(int argc, char *argv[])
 {
@@ -92,6 +92,41 @@ std::vector<T> generate(size_t size, int entropy_reduction, int lower_level, int
     return data;
 }
 
+// Skewed data: hot_percents% of samples fall into a few hot bins and form runs of equal values
+// (like large uniform areas of images), other samples are uniformly distributed
+template<class T>
+std::vector<T> generate_skewed(size_t size, int hot_percents, int lower_level, int upper_level)
+{
+    const size_t max_random_size = 1024 * 1024;
+    const int hot_values = 4;
+    const size_t max_run = 32;
+
+    std::random_device rd;
+    std::default_random_engine gen(rd());
+    std::uniform_int_distribution<int> percent_dis(0, 99);
+    std::uniform_int_distribution<int> value_dis(lower_level, upper_level - 1);
+    std::uniform_int_distribution<int> hot_dis(0, hot_values - 1);
+    std::uniform_int_distribution<size_t> run_dis(1, max_run);
+    const int hot_step = std::max(1, (upper_level - lower_level) / hot_values);
+
+    std::vector<T> data(size);
+    const size_t random_size = std::min(size, max_random_size);
+    for(size_t i = 0; i < random_size;)
+    {
+        const size_t run = std::min(random_size - i, run_dis(gen));
+        const T value = percent_dis(gen) < hot_percents
+            ? T(lower_level + hot_dis(gen) * hot_step)
+            : T(value_dis(gen));
+        std::fill(data.begin() + i, data.begin() + i + run, value);
+        i += run;
+    }
+    for(size_t i = max_random_size; i < size; i += max_random_size)
+    {
+        std::copy_n(data.begin(), std::min(size - i, max_random_size), data.begin() + i);
+    }
+    return data;
+}
+
 int get_entropy_percents(int entropy_reduction)
 {
     switch(entropy_reduction)
@@ -196,6 +231,201 @@ void run_even_benchmark(benchmark::State& state,
     HIP_CHECK(hipFree(d_histogram));
 }
 
+template<class T, class Config>
+void run_skewed_benchmark(benchmark::State& state,
+                          size_t bins,
+                          int hot_percents,
+                          hipStream_t stream,
+                          size_t size)
+{
+    using counter_type = unsigned int;
+
+    // All bins have the same integer width
+    const size_t scale = std::min<size_t>(16, std::numeric_limits<T>::max() / bins);
+    const int lower_level = 0;
+    const int upper_level = bins * scale;
+
+    // Generate data
+    std::vector<T> input = generate_skewed<T>(size, hot_percents, lower_level, upper_level);
+
+    T * d_input;
+    counter_type * d_histogram;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_histogram, bins * sizeof(counter_type)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_input, input.data(),
+            size * sizeof(T),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    void * d_temporary_storage = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(
+        rp::histogram_even<Config>(
+            d_temporary_storage, temporary_storage_bytes,
+            d_input, size,
+            d_histogram,
+            bins + 1, lower_level, upper_level,
+            stream, false
+        )
+    );
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(
+            rp::histogram_even<Config>(
+                d_temporary_storage, temporary_storage_bytes,
+                d_input, size,
+                d_histogram,
+                bins + 1, lower_level, upper_level,
+                stream, false
+            )
+        );
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for (auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(
+                rp::histogram_even<Config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_input, size,
+                    d_histogram,
+                    bins + 1, lower_level, upper_level,
+                    stream, false
+                )
+            );
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_histogram));
+}
+
+template<class T>
+void run_segmented_benchmark(benchmark::State& state,
+                             size_t bins,
+                             unsigned int segment_length,
+                             hipStream_t stream,
+                             size_t size)
+{
+    using counter_type = unsigned int;
+
+    const int lower_level = 0;
+    const int upper_level = bins * 10;
+    const unsigned int segments = size / segment_length;
+    size = static_cast<size_t>(segments) * segment_length;
+
+    // Generate data
+    std::vector<T> input = generate<T>(size, 0, lower_level, upper_level);
+    std::vector<unsigned int> offsets(segments + 1);
+    for(unsigned int segment = 0; segment <= segments; segment++)
+    {
+        offsets[segment] = segment * segment_length;
+    }
+
+    T * d_input;
+    unsigned int * d_offsets;
+    counter_type * d_histogram;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_offsets, (segments + 1) * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc(&d_histogram, segments * bins * sizeof(counter_type)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_input, input.data(),
+            size * sizeof(T),
+            hipMemcpyHostToDevice
+        )
+    );
+    HIP_CHECK(
+        hipMemcpy(
+            d_offsets, offsets.data(),
+            (segments + 1) * sizeof(unsigned int),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    void * d_temporary_storage = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(
+        rp::segmented_histogram_even(
+            d_temporary_storage, temporary_storage_bytes,
+            d_input, d_histogram,
+            segments, d_offsets, d_offsets + 1,
+            bins + 1, lower_level, upper_level,
+            stream, false
+        )
+    );
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(
+            rp::segmented_histogram_even(
+                d_temporary_storage, temporary_storage_bytes,
+                d_input, d_histogram,
+                segments, d_offsets, d_offsets + 1,
+                bins + 1, lower_level, upper_level,
+                stream, false
+            )
+        );
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for (auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(
+                rp::segmented_histogram_even(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_input, d_histogram,
+                    segments, d_offsets, d_offsets + 1,
+                    bins + 1, lower_level, upper_level,
+                    stream, false
+                )
+            );
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_offsets));
+    HIP_CHECK(hipFree(d_histogram));
+}
+
 template<class T, unsigned int Channels, unsigned int ActiveChannels>
 void run_multi_even_benchmark(benchmark::State& state,
                               size_t bins,
@@ -422,12 +652,78 @@ void add_even_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmark
             BENCHMARK_TYPE(int8_t),
             BENCHMARK_TYPE(uint8_t),
             BENCHMARK_TYPE(unsigned short),
-            BENCHMARK_TYPE(rocprim::half)
+            BENCHMARK_TYPE(rocprim::half),
+
+            // Sort-based implementation
+            CREATE_EVEN_BENCHMARK(int, 1 << 20, 1),
+            CREATE_EVEN_BENCHMARK(int, 1 << 22, 1)
         };
         benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
     };
 }
 
+#define CREATE_SKEWED_BENCHMARK(T, BINS, HOT_PERCENTS, HISTOGRAMS) \
+benchmark::RegisterBenchmark( \
+    (std::string("histogram_even") + "<" #T ">" + \
+        "(" #HOT_PERCENTS "% hot, " + std::to_string(BINS) + " bins, " \
+        #HISTOGRAMS " shared histograms)" \
+    ).c_str(), \
+    [=](benchmark::State& state) { \
+        run_skewed_benchmark< \
+            T, rp::histogram_config<rp::kernel_config<256, 8>, 1024, 2048, HISTOGRAMS> \
+        >(state, BINS, HOT_PERCENTS, stream, size); \
+    } \
+)
+
+#define BENCHMARK_SKEWED_TYPE(type, bins, hot_percents) \
+    CREATE_SKEWED_BENCHMARK(type, bins, hot_percents, 1), \
+    CREATE_SKEWED_BENCHMARK(type, bins, hot_percents, 4), \
+    CREATE_SKEWED_BENCHMARK(type, bins, hot_percents, 16)
+
+void add_skewed_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                           hipStream_t stream,
+                           size_t size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs =
+    {
+        BENCHMARK_SKEWED_TYPE(int, 16, 50),
+        BENCHMARK_SKEWED_TYPE(int, 16, 90),
+        BENCHMARK_SKEWED_TYPE(int, 256, 90),
+        BENCHMARK_SKEWED_TYPE(int, 256, 99),
+        BENCHMARK_SKEWED_TYPE(uint8_t, 16, 90),
+        BENCHMARK_SKEWED_TYPE(unsigned short, 256, 90),
+        BENCHMARK_SKEWED_TYPE(unsigned short, 2048, 90),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+#define CREATE_SEGMENTED_BENCHMARK(T, BINS, SEGMENT_LENGTH) \
+benchmark::RegisterBenchmark( \
+    (std::string("segmented_histogram_even") + "<" #T ">" + \
+        "(" + std::to_string(BINS) + " bins, " #SEGMENT_LENGTH " samples per segment)" \
+    ).c_str(), \
+    [=](benchmark::State& state) { \
+        run_segmented_benchmark<T>(state, BINS, SEGMENT_LENGTH, stream, size); \
+    } \
+)
+
+void add_segmented_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                              hipStream_t stream,
+                              size_t size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs =
+    {
+        // Tiles of images, e.g. 16x16, 32x32 and 64x64 pixels
+        CREATE_SEGMENTED_BENCHMARK(uint8_t, 16, 256),
+        CREATE_SEGMENTED_BENCHMARK(uint8_t, 16, 1024),
+        CREATE_SEGMENTED_BENCHMARK(uint8_t, 16, 4096),
+        CREATE_SEGMENTED_BENCHMARK(unsigned short, 256, 1024),
+        CREATE_SEGMENTED_BENCHMARK(unsigned short, 256, 4096),
+        CREATE_SEGMENTED_BENCHMARK(int, 1000, 4096),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
 #define CREATE_MULTI_EVEN_BENCHMARK(CHANNELS, ACTIVE_CHANNELS, T, BINS, SCALE) \
 benchmark::RegisterBenchmark( \
     (std::string("multi_histogram_even") + "<" #CHANNELS ", " #ACTIVE_CHANNELS ", " #T ">" + \
@@ -510,6 +806,8 @@ int main(int argc, char *argv[])
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
     add_even_benchmarks(benchmarks, stream, size);
+    add_skewed_benchmarks(benchmarks, stream, size);
+    add_segmented_benchmarks(benchmarks, stream, size);
     add_multi_even_benchmarks(benchmarks, stream, size);
     add_range_benchmarks(benchmarks, stream, size);
 
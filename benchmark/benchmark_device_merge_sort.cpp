@@ -58,7 +58,7 @@ namespace rp = rocprim;
 const unsigned int batch_size = 10;
 const unsigned int warmup_size = 5;
 
-template<class Key>
+template<class Key, class Config = rp::default_config>
 void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
 {
     using key_type = Key;
@@ -95,7 +95,7 @@ void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t
     void * d_temporary_storage = nullptr;
     size_t temporary_storage_bytes = 0;
     HIP_CHECK(
-        rp::merge_sort(
+        rp::merge_sort<Config>(
             d_temporary_storage, temporary_storage_bytes,
             d_keys_input, d_keys_output, size,
             lesser_op, stream, false
@@ -109,7 +109,7 @@ void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t
     for(size_t i = 0; i < warmup_size; i++)
     {
         HIP_CHECK(
-            rp::merge_sort(
+            rp::merge_sort<Config>(
                 d_temporary_storage, temporary_storage_bytes,
                 d_keys_input, d_keys_output, size,
                 lesser_op, stream, false
@@ -125,7 +125,7 @@ void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t
         for(size_t i = 0; i < batch_size; i++)
         {
             HIP_CHECK(
-                rp::merge_sort(
+                rp::merge_sort<Config>(
                     d_temporary_storage, temporary_storage_bytes,
                     d_keys_input, d_keys_output, size,
                     lesser_op, stream, false
@@ -147,7 +147,7 @@ void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t
     HIP_CHECK(hipFree(d_keys_output));
 }
 
-template<class Key, class Value>
+template<class Key, class Value, class Config = rp::default_config>
 void run_sort_pairs_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
 {
     using key_type = Key;
@@ -200,7 +200,7 @@ void run_sort_pairs_benchmark(benchmark::State& state, hipStream_t stream, size_
     void * d_temporary_storage = nullptr;
     size_t temporary_storage_bytes = 0;
     HIP_CHECK(
-        rp::merge_sort(
+        rp::merge_sort<Config>(
             d_temporary_storage, temporary_storage_bytes,
             d_keys_input, d_keys_output, d_values_input, d_values_output, size,
             lesser_op, stream, false
@@ -214,7 +214,7 @@ void run_sort_pairs_benchmark(benchmark::State& state, hipStream_t stream, size_
     for(size_t i = 0; i < warmup_size; i++)
     {
         HIP_CHECK(
-            rp::merge_sort(
+            rp::merge_sort<Config>(
                 d_temporary_storage, temporary_storage_bytes,
                 d_keys_input, d_keys_output, d_values_input, d_values_output, size,
                 lesser_op, stream, false
@@ -230,7 +230,7 @@ void run_sort_pairs_benchmark(benchmark::State& state, hipStream_t stream, size_
         for(size_t i = 0; i < batch_size; i++)
         {
             HIP_CHECK(
-                rp::merge_sort(
+                rp::merge_sort<Config>(
                     d_temporary_storage, temporary_storage_bytes,
                     d_keys_input, d_keys_output, d_values_input, d_values_output, size,
                     lesser_op, stream, false
@@ -309,6 +309,55 @@ void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark*>& ben
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
 
+#define CREATE_SORT_KEYS_CONFIG_BENCHMARK(Key, SortBS, SortIPT, MergeBS, MergeIPT) \
+benchmark::RegisterBenchmark( \
+    (std::string("sort_keys") + "<" #Key ">" \
+        "[sort " #SortBS "x" #SortIPT ", merge " #MergeBS "x" #MergeIPT "]").c_str(), \
+    [=](benchmark::State& state) { \
+        run_sort_keys_benchmark< \
+            Key, rp::merge_sort_config<SortBS, SortIPT, MergeBS, MergeIPT> \
+        >(state, stream, size); \
+    } \
+)
+
+#define CREATE_SORT_PAIRS_CONFIG_BENCHMARK(Key, Value, SortBS, SortIPT, MergeBS, MergeIPT) \
+benchmark::RegisterBenchmark( \
+    (std::string("sort_pairs") + "<" #Key ", " #Value ">" \
+        "[sort " #SortBS "x" #SortIPT ", merge " #MergeBS "x" #MergeIPT "]").c_str(), \
+    [=](benchmark::State& state) { \
+        run_sort_pairs_benchmark< \
+            Key, Value, rp::merge_sort_config<SortBS, SortIPT, MergeBS, MergeIPT> \
+        >(state, stream, size); \
+    } \
+)
+
+// Tile sizes of block sort and merge stages
+void add_sort_config_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                hipStream_t stream,
+                                size_t size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs =
+    {
+        CREATE_SORT_KEYS_CONFIG_BENCHMARK(int, 256, 1, 256, 1),
+        CREATE_SORT_KEYS_CONFIG_BENCHMARK(int, 256, 4, 256, 4),
+        CREATE_SORT_KEYS_CONFIG_BENCHMARK(int, 256, 8, 256, 8),
+        CREATE_SORT_KEYS_CONFIG_BENCHMARK(int, 256, 8, 128, 16),
+        CREATE_SORT_KEYS_CONFIG_BENCHMARK(int, 512, 4, 256, 8),
+
+        CREATE_SORT_KEYS_CONFIG_BENCHMARK(long long, 256, 1, 256, 1),
+        CREATE_SORT_KEYS_CONFIG_BENCHMARK(long long, 256, 4, 256, 4),
+        CREATE_SORT_KEYS_CONFIG_BENCHMARK(long long, 256, 8, 128, 8),
+
+        CREATE_SORT_PAIRS_CONFIG_BENCHMARK(int, float, 256, 1, 256, 1),
+        CREATE_SORT_PAIRS_CONFIG_BENCHMARK(int, float, 256, 4, 256, 4),
+        CREATE_SORT_PAIRS_CONFIG_BENCHMARK(int, float, 256, 8, 256, 8),
+
+        CREATE_SORT_PAIRS_CONFIG_BENCHMARK(long long, double, 256, 1, 256, 1),
+        CREATE_SORT_PAIRS_CONFIG_BENCHMARK(long long, double, 256, 4, 256, 4),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -333,6 +382,7 @@ int main(int argc, char *argv[])
     std::vector<benchmark::internal::Benchmark*> benchmarks;
     add_sort_keys_benchmarks(benchmarks, stream, size);
     add_sort_pairs_benchmarks(benchmarks, stream, size);
+    add_sort_config_benchmarks(benchmarks, stream, size);
 
     // Use manual timing
     for(auto& b : benchmarks)
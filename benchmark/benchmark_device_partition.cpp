@@ -267,6 +267,122 @@ void run_if_benchmark(benchmark::State& state,
     hipFree(d_temp_storage);
 }
 
+template<class T>
+void run_three_way_benchmark(benchmark::State& state,
+                             size_t size,
+                             const hipStream_t stream,
+                             float first_probability,
+                             float second_probability)
+{
+    auto select_first_part_op = [first_probability] __device__ (const T& value) -> bool
+    {
+        return value < T(10000 * first_probability);
+    };
+    auto select_second_part_op = [first_probability, second_probability] __device__ (const T& value) -> bool
+    {
+        return value < T(10000 * (first_probability + second_probability));
+    };
+
+    std::vector<T> input = get_random_data<T>(size, T(0), T(10000));
+    T * d_input;
+    T * d_first_output;
+    T * d_second_output;
+    T * d_unselected_output;
+    unsigned int * d_selected_count_output;
+    HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_first_output, input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_second_output, input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_unselected_output, input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_selected_count_output, 2 * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_input, input.data(),
+            input.size() * sizeof(T),
+            hipMemcpyHostToDevice
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    // Allocate temporary storage memory
+    size_t temp_storage_size_bytes;
+
+    // Get size of d_temp_storage
+    rocprim::partition_three_way(
+        nullptr,
+        temp_storage_size_bytes,
+        d_input,
+        d_first_output,
+        d_second_output,
+        d_unselected_output,
+        d_selected_count_output,
+        input.size(),
+        select_first_part_op,
+        select_second_part_op,
+        stream
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // allocate temporary storage
+    void * d_temp_storage = nullptr;
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < 10; i++)
+    {
+        rocprim::partition_three_way(
+            d_temp_storage,
+            temp_storage_size_bytes,
+            d_input,
+            d_first_output,
+            d_second_output,
+            d_unselected_output,
+            d_selected_count_output,
+            input.size(),
+            select_first_part_op,
+            select_second_part_op,
+            stream
+        );
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    const unsigned int batch_size = 10;
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            rocprim::partition_three_way(
+                d_temp_storage,
+                temp_storage_size_bytes,
+                d_input,
+                d_first_output,
+                d_second_output,
+                d_unselected_output,
+                d_selected_count_output,
+                input.size(),
+                select_first_part_op,
+                select_second_part_op,
+                stream
+            );
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    hipFree(d_input);
+    hipFree(d_first_output);
+    hipFree(d_second_output);
+    hipFree(d_unselected_output);
+    hipFree(d_selected_count_output);
+    hipFree(d_temp_storage);
+}
+
 #define CREATE_PARTITION_FLAGGED_BENCHMARK(T, F, p) \
 benchmark::RegisterBenchmark( \
     ("partition(flags)<" #T "," #F ", "#T", unsigned int>(p = " #p")"), \
@@ -279,6 +395,12 @@ benchmark::RegisterBenchmark( \
     run_if_benchmark<T>, size, stream, p \
 )
 
+#define CREATE_PARTITION_THREE_WAY_BENCHMARK(T, p1, p2) \
+benchmark::RegisterBenchmark( \
+    ("partition_three_way<" #T ", "#T", unsigned int>(p1 = " #p1", p2 = " #p2")"), \
+    run_three_way_benchmark<T>, size, stream, p1, p2 \
+)
+
 #define BENCHMARK_FLAGGED_TYPE(type, value) \
     CREATE_PARTITION_FLAGGED_BENCHMARK(type, value, 0.05f), \
     CREATE_PARTITION_FLAGGED_BENCHMARK(type, value, 0.25f), \
@@ -291,6 +413,11 @@ benchmark::RegisterBenchmark( \
     CREATE_PARTITION_IF_BENCHMARK(type, 0.5f), \
     CREATE_PARTITION_IF_BENCHMARK(type, 0.75f)
 
+#define BENCHMARK_THREE_WAY_TYPE(type) \
+    CREATE_PARTITION_THREE_WAY_BENCHMARK(type, 0.05f, 0.05f), \
+    CREATE_PARTITION_THREE_WAY_BENCHMARK(type, 0.25f, 0.25f), \
+    CREATE_PARTITION_THREE_WAY_BENCHMARK(type, 0.33f, 0.33f)
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -331,7 +458,13 @@ int main(int argc, char *argv[])
         BENCHMARK_IF_TYPE(uint8_t),
         BENCHMARK_IF_TYPE(int8_t),
         BENCHMARK_IF_TYPE(rocprim::half),
-        BENCHMARK_IF_TYPE(custom_int_double)
+        BENCHMARK_IF_TYPE(custom_int_double),
+
+        BENCHMARK_THREE_WAY_TYPE(int),
+        BENCHMARK_THREE_WAY_TYPE(float),
+        BENCHMARK_THREE_WAY_TYPE(double),
+        BENCHMARK_THREE_WAY_TYPE(uint8_t),
+        BENCHMARK_THREE_WAY_TYPE(custom_int_double)
     };
 
     // Use manual timing
@@ -58,7 +58,12 @@ namespace rp = rocprim;
 const unsigned int batch_size = 10;
 const unsigned int warmup_size = 5;
 
-template<class Key>
+// Single-pass (onesweep) radix sort: 8 bits per iteration, 2048 items per block
+using onesweep_config = rp::radix_sort_config<
+    8, 8, rp::kernel_config<256, 2>, rp::kernel_config<256, 8>, true
+>;
+
+template<class Key, class Config = rp::default_config>
 void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
 {
     using key_type = Key;
@@ -94,7 +99,7 @@ void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t
     void * d_temporary_storage = nullptr;
     size_t temporary_storage_bytes = 0;
     HIP_CHECK(
-        rp::radix_sort_keys(
+        rp::radix_sort_keys<Config>(
             d_temporary_storage, temporary_storage_bytes,
             d_keys_input, d_keys_output, size,
             0, sizeof(key_type) * 8,
@@ -109,7 +114,7 @@ void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t
     for(size_t i = 0; i < warmup_size; i++)
     {
         HIP_CHECK(
-            rp::radix_sort_keys(
+            rp::radix_sort_keys<Config>(
                 d_temporary_storage, temporary_storage_bytes,
                 d_keys_input, d_keys_output, size,
                 0, sizeof(key_type) * 8,
@@ -126,7 +131,7 @@ void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t
         for(size_t i = 0; i < batch_size; i++)
         {
             HIP_CHECK(
-                rp::radix_sort_keys(
+                rp::radix_sort_keys<Config>(
                     d_temporary_storage, temporary_storage_bytes,
                     d_keys_input, d_keys_output, size,
                     0, sizeof(key_type) * 8,
@@ -149,7 +154,7 @@ void run_sort_keys_benchmark(benchmark::State& state, hipStream_t stream, size_t
     HIP_CHECK(hipFree(d_keys_output));
 }
 
-template<class Key, class Value>
+template<class Key, class Value, class Config = rp::default_config>
 void run_sort_pairs_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
 {
     using key_type = Key;
@@ -201,7 +206,7 @@ void run_sort_pairs_benchmark(benchmark::State& state, hipStream_t stream, size_
     void * d_temporary_storage = nullptr;
     size_t temporary_storage_bytes = 0;
     HIP_CHECK(
-        rp::radix_sort_pairs(
+        rp::radix_sort_pairs<Config>(
             d_temporary_storage, temporary_storage_bytes,
             d_keys_input, d_keys_output, d_values_input, d_values_output, size,
             0, sizeof(key_type) * 8,
@@ -216,7 +221,7 @@ void run_sort_pairs_benchmark(benchmark::State& state, hipStream_t stream, size_
     for(size_t i = 0; i < warmup_size; i++)
     {
         HIP_CHECK(
-            rp::radix_sort_pairs(
+            rp::radix_sort_pairs<Config>(
                 d_temporary_storage, temporary_storage_bytes,
                 d_keys_input, d_keys_output, d_values_input, d_values_output, size,
                 0, sizeof(key_type) * 8,
@@ -233,7 +238,7 @@ void run_sort_pairs_benchmark(benchmark::State& state, hipStream_t stream, size_
         for(size_t i = 0; i < batch_size; i++)
         {
             HIP_CHECK(
-                rp::radix_sort_pairs(
+                rp::radix_sort_pairs<Config>(
                     d_temporary_storage, temporary_storage_bytes,
                     d_keys_input, d_keys_output, d_values_input, d_values_output, size,
                     0, sizeof(key_type) * 8,
@@ -283,6 +288,29 @@ void add_sort_keys_benchmarks(std::vector<benchmark::internal::Benchmark*>& benc
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
 
+#define CREATE_SORT_KEYS_ONESWEEP_BENCHMARK(Key) \
+benchmark::RegisterBenchmark( \
+    (std::string("sort_keys_onesweep") + "<" #Key ">").c_str(), \
+    [=](benchmark::State& state) { run_sort_keys_benchmark<Key, onesweep_config>(state, stream, size); } \
+)
+
+void add_sort_keys_onesweep_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                       hipStream_t stream,
+                                       size_t size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs =
+    {
+        CREATE_SORT_KEYS_ONESWEEP_BENCHMARK(int),
+        CREATE_SORT_KEYS_ONESWEEP_BENCHMARK(long long),
+
+        CREATE_SORT_KEYS_ONESWEEP_BENCHMARK(int8_t),
+        CREATE_SORT_KEYS_ONESWEEP_BENCHMARK(uint8_t),
+        CREATE_SORT_KEYS_ONESWEEP_BENCHMARK(rocprim::half),
+        CREATE_SORT_KEYS_ONESWEEP_BENCHMARK(short),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
 #define CREATE_SORT_PAIRS_BENCHMARK(Key, Value) \
 benchmark::RegisterBenchmark( \
     (std::string("sort_pairs") + "<" #Key ", " #Value ">").c_str(), \
@@ -315,6 +343,38 @@ void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark*>& ben
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
 
+#define CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(Key, Value) \
+benchmark::RegisterBenchmark( \
+    (std::string("sort_pairs_onesweep") + "<" #Key ", " #Value ">").c_str(), \
+    [=](benchmark::State& state) { run_sort_pairs_benchmark<Key, Value, onesweep_config>(state, stream, size); } \
+)
+
+void add_sort_pairs_onesweep_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                        hipStream_t stream,
+                                        size_t size)
+{
+    using custom_float2 = custom_type<float, float>;
+    using custom_double2 = custom_type<double, double>;
+
+    std::vector<benchmark::internal::Benchmark*> bs =
+    {
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(int, float),
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(int, double),
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(int, custom_float2),
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(int, custom_double2),
+
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(int8_t, int8_t),
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(uint8_t, uint8_t),
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(rocprim::half, rocprim::half),
+
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(long long, float),
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(long long, double),
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(long long, custom_float2),
+        CREATE_SORT_PAIRS_ONESWEEP_BENCHMARK(long long, custom_double2),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -339,6 +399,8 @@ int main(int argc, char *argv[])
     std::vector<benchmark::internal::Benchmark*> benchmarks;
     add_sort_keys_benchmarks(benchmarks, stream, size);
     add_sort_pairs_benchmarks(benchmarks, stream, size);
+    add_sort_keys_onesweep_benchmarks(benchmarks, stream, size);
+    add_sort_pairs_onesweep_benchmarks(benchmarks, stream, size);
 
     // Use manual timing
     for(auto& b : benchmarks)
@@ -137,12 +137,94 @@ void run_benchmark(benchmark::State& state,
     HIP_CHECK(hipFree(d_temp_storage));
 }
 
+template<class T>
+void run_deterministic_benchmark(benchmark::State& state,
+                                 size_t size,
+                                 const hipStream_t stream)
+{
+    std::vector<T> input = get_random_data<T>(size, T(0), T(1000));
+
+    T * d_input;
+    T * d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, sizeof(T)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_input, input.data(),
+            size * sizeof(T),
+            hipMemcpyHostToDevice
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Allocate temporary storage memory
+    size_t temp_storage_size_bytes;
+    void * d_temp_storage = nullptr;
+    // Get size of d_temp_storage
+    HIP_CHECK(
+        rocprim::deterministic_reduce(
+            d_temp_storage, temp_storage_size_bytes,
+            d_input, d_output, T(), size,
+            stream
+        )
+    );
+    HIP_CHECK(hipMalloc(&d_temp_storage,temp_storage_size_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(
+            rocprim::deterministic_reduce(
+                d_temp_storage, temp_storage_size_bytes,
+                d_input, d_output, T(), size,
+                stream
+            )
+        );
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(
+                rocprim::deterministic_reduce(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input, d_output, T(), size,
+                    stream
+                )
+            );
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+            std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
 #define CREATE_BENCHMARK(T, REDUCE_OP) \
 benchmark::RegisterBenchmark( \
     ("reduce<" #T ", " #REDUCE_OP ">"), \
     run_benchmark<T, REDUCE_OP>, size, stream, REDUCE_OP() \
 )
 
+#define CREATE_DETERMINISTIC_BENCHMARK(T) \
+benchmark::RegisterBenchmark( \
+    ("deterministic_reduce<" #T ">"), \
+    run_deterministic_benchmark<T>, size, stream \
+)
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -181,6 +263,9 @@ int main(int argc, char *argv[])
 
         CREATE_BENCHMARK(custom_float2, rocprim::plus<custom_float2>),
         CREATE_BENCHMARK(custom_double2, rocprim::plus<custom_double2>),
+
+        CREATE_DETERMINISTIC_BENCHMARK(float),
+        CREATE_DETERMINISTIC_BENCHMARK(double),
     };
 
     // Use manual timing
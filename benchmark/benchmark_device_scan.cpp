@@ -227,6 +227,7 @@ int main(int argc, char *argv[])
 
     using custom_double2 = custom_type<double, double>;
     using custom_int2 = custom_type<int, int>;
+    using custom_long_long2 = custom_type<long long, long long>;
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks =
@@ -255,7 +256,9 @@ int main(int argc, char *argv[])
         CREATE_INCLUSIVE_BENCHMARK(custom_double2, rocprim::plus<custom_double2>),
         CREATE_EXCLUSIVE_BENCHMARK(custom_double2, rocprim::plus<custom_double2>),
         CREATE_INCLUSIVE_BENCHMARK(custom_int2, rocprim::plus<custom_int2>),
-        CREATE_EXCLUSIVE_BENCHMARK(custom_int2, rocprim::plus<custom_int2>)
+        CREATE_EXCLUSIVE_BENCHMARK(custom_int2, rocprim::plus<custom_int2>),
+        CREATE_INCLUSIVE_BENCHMARK(custom_long_long2, rocprim::plus<custom_long_long2>),
+        CREATE_EXCLUSIVE_BENCHMARK(custom_long_long2, rocprim::plus<custom_long_long2>)
     };
 
     // Use manual timing
@@ -26,6 +26,8 @@
 #include <locale>
 #include <string>
 #include <limits>
+#include <algorithm>
+#include <cmath>
 
 // Google Benchmark
 #include "benchmark/benchmark.h"
@@ -57,17 +59,15 @@ namespace rp = rocprim;
 const unsigned int batch_size = 4;
 const unsigned int warmup_size = 2;
 
-template<class Key>
-void run_sort_keys_benchmark(benchmark::State& state,
-                             size_t desired_segments,
-                             hipStream_t stream, size_t size)
+// Lengths of segments are uniformly distributed in [0; 2 * average length] or
+// follow a power law (Pareto distribution with the same average length): most segments
+// are very short and a few segments contain a large part of all items.
+template<class Offset>
+unsigned int generate_offsets(std::vector<Offset>& offsets,
+                              size_t desired_segments,
+                              bool power_law,
+                              size_t size)
 {
-    using offset_type = int;
-    using key_type = Key;
-
-    // Generate data
-    std::vector<offset_type> offsets;
-
     const double avg_segment_length = static_cast<double>(size) / desired_segments;
 
     const unsigned int seed = 123;
@@ -75,16 +75,45 @@ void run_sort_keys_benchmark(benchmark::State& state,
 
     std::uniform_real_distribution<double> segment_length_dis(0, avg_segment_length * 2);
 
+    const double alpha = 1.2;
+    const double min_segment_length = avg_segment_length * (alpha - 1) / alpha;
+    std::uniform_real_distribution<double> power_law_dis(0, 1);
+
     unsigned int segments_count = 0;
     size_t offset = 0;
     while(offset < size)
     {
-        const size_t segment_length = std::round(segment_length_dis(gen));
+        const double length = power_law
+            ? min_segment_length / std::pow(1.0 - power_law_dis(gen), 1.0 / alpha)
+            : segment_length_dis(gen);
+        const size_t segment_length = std::round(std::min(length, static_cast<double>(size)));
         offsets.push_back(offset);
         segments_count++;
         offset += segment_length;
     }
     offsets.push_back(size);
+    return segments_count;
+}
+
+// Sorts short segments by logical warps and long segments by device-wide radix sort
+using binned_config = rp::segmented_radix_sort_config<
+    7, 6, rp::kernel_config<256, 15>,
+    rp::segmented_radix_sort_bins_config<32, 256, 256 * 15 * 16>
+>;
+
+template<class Key, class Config = rp::default_config>
+void run_sort_keys_benchmark(benchmark::State& state,
+                             size_t desired_segments,
+                             bool power_law,
+                             hipStream_t stream, size_t size)
+{
+    using offset_type = int;
+    using key_type = Key;
+
+    // Generate data
+    std::vector<offset_type> offsets;
+    const unsigned int segments_count =
+        generate_offsets(offsets, desired_segments, power_law, size);
 
     std::vector<key_type> keys_input;
     if(std::is_floating_point<key_type>::value)
@@ -125,7 +154,7 @@ void run_sort_keys_benchmark(benchmark::State& state,
     void * d_temporary_storage = nullptr;
     size_t temporary_storage_bytes = 0;
     HIP_CHECK(
-        rp::segmented_radix_sort_keys(
+        rp::segmented_radix_sort_keys<Config>(
             d_temporary_storage, temporary_storage_bytes,
             d_keys_input, d_keys_output, size,
             segments_count, d_offsets, d_offsets + 1,
@@ -141,7 +170,7 @@ void run_sort_keys_benchmark(benchmark::State& state,
     for(size_t i = 0; i < warmup_size; i++)
     {
         HIP_CHECK(
-            rp::segmented_radix_sort_keys(
+            rp::segmented_radix_sort_keys<Config>(
                 d_temporary_storage, temporary_storage_bytes,
                 d_keys_input, d_keys_output, size,
                 segments_count, d_offsets, d_offsets + 1,
@@ -159,7 +188,7 @@ void run_sort_keys_benchmark(benchmark::State& state,
         for(size_t i = 0; i < batch_size; i++)
         {
             HIP_CHECK(
-                rp::segmented_radix_sort_keys(
+                rp::segmented_radix_sort_keys<Config>(
                     d_temporary_storage, temporary_storage_bytes,
                     d_keys_input, d_keys_output, size,
                     segments_count, d_offsets, d_offsets + 1,
@@ -184,9 +213,10 @@ void run_sort_keys_benchmark(benchmark::State& state,
     HIP_CHECK(hipFree(d_keys_output));
 }
 
-template<class Key, class Value>
+template<class Key, class Value, class Config = rp::default_config>
 void run_sort_pairs_benchmark(benchmark::State& state,
                               size_t desired_segments,
+                              bool power_law,
                               hipStream_t stream, size_t size)
 {
     using offset_type = int;
@@ -195,24 +225,8 @@ void run_sort_pairs_benchmark(benchmark::State& state,
 
     // Generate data
     std::vector<offset_type> offsets;
-
-    const double avg_segment_length = static_cast<double>(size) / desired_segments;
-
-    const unsigned int seed = 123;
-    std::default_random_engine gen(seed);
-
-    std::uniform_real_distribution<double> segment_length_dis(0, avg_segment_length * 2);
-
-    unsigned int segments_count = 0;
-    size_t offset = 0;
-    while(offset < size)
-    {
-        const size_t segment_length = std::round(segment_length_dis(gen));
-        offsets.push_back(offset);
-        segments_count++;
-        offset += segment_length;
-    }
-    offsets.push_back(size);
+    const unsigned int segments_count =
+        generate_offsets(offsets, desired_segments, power_law, size);
 
     std::vector<key_type> keys_input;
     if(std::is_floating_point<key_type>::value)
@@ -268,7 +282,7 @@ void run_sort_pairs_benchmark(benchmark::State& state,
     void * d_temporary_storage = nullptr;
     size_t temporary_storage_bytes = 0;
     HIP_CHECK(
-        rp::segmented_radix_sort_pairs(
+        rp::segmented_radix_sort_pairs<Config>(
             d_temporary_storage, temporary_storage_bytes,
             d_keys_input, d_keys_output, d_values_input, d_values_output, size,
             segments_count, d_offsets, d_offsets + 1,
@@ -284,7 +298,7 @@ void run_sort_pairs_benchmark(benchmark::State& state,
     for(size_t i = 0; i < warmup_size; i++)
     {
         HIP_CHECK(
-            rp::segmented_radix_sort_pairs(
+            rp::segmented_radix_sort_pairs<Config>(
                 d_temporary_storage, temporary_storage_bytes,
                 d_keys_input, d_keys_output, d_values_input, d_values_output, size,
                 segments_count, d_offsets, d_offsets + 1,
@@ -302,7 +316,7 @@ void run_sort_pairs_benchmark(benchmark::State& state,
         for(size_t i = 0; i < batch_size; i++)
         {
             HIP_CHECK(
-                rp::segmented_radix_sort_pairs(
+                rp::segmented_radix_sort_pairs<Config>(
                     d_temporary_storage, temporary_storage_bytes,
                     d_keys_input, d_keys_output, d_values_input, d_values_output, size,
                     segments_count, d_offsets, d_offsets + 1,
@@ -336,7 +350,21 @@ benchmark::RegisterBenchmark( \
     (std::string("sort_keys") + "<" #Key ">" + \
         "(~" + std::to_string(SEGMENTS) + " segments)" \
     ).c_str(), \
-    [=](benchmark::State& state) { run_sort_keys_benchmark<Key>(state, SEGMENTS, stream, size); } \
+    [=](benchmark::State& state) { run_sort_keys_benchmark<Key>(state, SEGMENTS, false, stream, size); } \
+)
+
+#define CREATE_SORT_KEYS_POWER_LAW_BENCHMARK(Key, SEGMENTS) \
+benchmark::RegisterBenchmark( \
+    (std::string("sort_keys_power_law") + "<" #Key ">" + \
+        "(~" + std::to_string(SEGMENTS) + " segments)" \
+    ).c_str(), \
+    [=](benchmark::State& state) { run_sort_keys_benchmark<Key>(state, SEGMENTS, true, stream, size); } \
+), \
+benchmark::RegisterBenchmark( \
+    (std::string("sort_keys_power_law_binned") + "<" #Key ">" + \
+        "(~" + std::to_string(SEGMENTS) + " segments)" \
+    ).c_str(), \
+    [=](benchmark::State& state) { run_sort_keys_benchmark<Key, binned_config>(state, SEGMENTS, true, stream, size); } \
 )
 
 #define BENCHMARK_KEY_TYPE(type) \
@@ -346,6 +374,11 @@ benchmark::RegisterBenchmark( \
     CREATE_SORT_KEYS_BENCHMARK(type, 1000), \
     CREATE_SORT_KEYS_BENCHMARK(type, 10000)
 
+#define BENCHMARK_KEY_TYPE_POWER_LAW(type) \
+    CREATE_SORT_KEYS_POWER_LAW_BENCHMARK(type, 1000), \
+    CREATE_SORT_KEYS_POWER_LAW_BENCHMARK(type, 100000), \
+    CREATE_SORT_KEYS_POWER_LAW_BENCHMARK(type, 1000000)
+
 void add_sort_keys_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                               hipStream_t stream,
                               size_t size)
@@ -358,6 +391,9 @@ void add_sort_keys_benchmarks(std::vector<benchmark::internal::Benchmark*>& benc
         BENCHMARK_KEY_TYPE(uint8_t),
         BENCHMARK_KEY_TYPE(rocprim::half),
         BENCHMARK_KEY_TYPE(int),
+        BENCHMARK_KEY_TYPE_POWER_LAW(float),
+        BENCHMARK_KEY_TYPE_POWER_LAW(int),
+        BENCHMARK_KEY_TYPE_POWER_LAW(long long),
     };
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
@@ -367,7 +403,21 @@ benchmark::RegisterBenchmark( \
     (std::string("sort_pairs") + "<" #Key ", " #Value ">" + \
         "(~" + std::to_string(SEGMENTS) + " segments)" \
     ).c_str(), \
-    [=](benchmark::State& state) { run_sort_pairs_benchmark<Key, Value>(state, SEGMENTS, stream, size); } \
+    [=](benchmark::State& state) { run_sort_pairs_benchmark<Key, Value>(state, SEGMENTS, false, stream, size); } \
+)
+
+#define CREATE_SORT_PAIRS_POWER_LAW_BENCHMARK(Key, Value, SEGMENTS) \
+benchmark::RegisterBenchmark( \
+    (std::string("sort_pairs_power_law") + "<" #Key ", " #Value ">" + \
+        "(~" + std::to_string(SEGMENTS) + " segments)" \
+    ).c_str(), \
+    [=](benchmark::State& state) { run_sort_pairs_benchmark<Key, Value>(state, SEGMENTS, true, stream, size); } \
+), \
+benchmark::RegisterBenchmark( \
+    (std::string("sort_pairs_power_law_binned") + "<" #Key ", " #Value ">" + \
+        "(~" + std::to_string(SEGMENTS) + " segments)" \
+    ).c_str(), \
+    [=](benchmark::State& state) { run_sort_pairs_benchmark<Key, Value, binned_config>(state, SEGMENTS, true, stream, size); } \
 )
 
 #define BENCHMARK_PAIR_TYPE(type, value) \
@@ -377,6 +427,11 @@ benchmark::RegisterBenchmark( \
     CREATE_SORT_PAIRS_BENCHMARK(type, value, 1000), \
     CREATE_SORT_PAIRS_BENCHMARK(type, value, 10000)
 
+#define BENCHMARK_PAIR_TYPE_POWER_LAW(type, value) \
+    CREATE_SORT_PAIRS_POWER_LAW_BENCHMARK(type, value, 1000), \
+    CREATE_SORT_PAIRS_POWER_LAW_BENCHMARK(type, value, 100000), \
+    CREATE_SORT_PAIRS_POWER_LAW_BENCHMARK(type, value, 1000000)
+
 void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                                hipStream_t stream,
                                size_t size)
@@ -393,6 +448,8 @@ void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark*>& ben
         BENCHMARK_PAIR_TYPE(rocprim::half, rocprim::half),
         BENCHMARK_PAIR_TYPE(int, custom_float2),
         BENCHMARK_PAIR_TYPE(long long, custom_double2),
+        BENCHMARK_PAIR_TYPE_POWER_LAW(int, float),
+        BENCHMARK_PAIR_TYPE_POWER_LAW(long long, double),
     };
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
@@ -22,6 +22,7 @@
 
 #include <iostream>
 #include <chrono>
+#include <cmath>
 #include <vector>
 #include <locale>
 #include <string>
@@ -57,30 +58,69 @@ namespace rp = rocprim;
 const unsigned int batch_size = 10;
 const unsigned int warmup_size = 5;
 
-template<class T>
-void run_benchmark(benchmark::State& state, size_t desired_segments, hipStream_t stream, size_t size)
+enum class segment_distribution
+{
+    // Lengths are uniformly distributed in [0; 2 * average length]
+    uniform,
+    // Lengths follow the power law (Pareto distribution with alpha = 1.2): most segments
+    // are short, a few are very long
+    power_law,
+    // Half of all items are in one segment, the rest are in short segments
+    single_giant
+};
+
+template<class OffsetType>
+std::vector<OffsetType> generate_offsets(segment_distribution distribution,
+                                         size_t desired_segments,
+                                         size_t size)
 {
-    using offset_type = int;
-    using value_type = T;
-
-    // Generate data
     const unsigned int seed = 123;
     std::default_random_engine gen(seed);
 
     const double avg_segment_length = static_cast<double>(size) / desired_segments;
-    std::uniform_real_distribution<double> segment_length_dis(0, avg_segment_length * 2);
+    std::uniform_real_distribution<double> uniform_dis(0, 1);
 
-    std::vector<offset_type> offsets;
-    unsigned int segments_count = 0;
+    std::vector<OffsetType> offsets;
     size_t offset = 0;
+    if(distribution == segment_distribution::single_giant)
+    {
+        offsets.push_back(offset);
+        offset += size / 2;
+    }
     while(offset < size)
     {
-        const size_t segment_length = std::round(segment_length_dis(gen));
+        size_t segment_length;
+        if(distribution == segment_distribution::power_law)
+        {
+            // The average length of Pareto distribution is x_min * alpha / (alpha - 1)
+            const double alpha = 1.2;
+            const double x_min = avg_segment_length * (alpha - 1) / alpha;
+            segment_length = std::round(x_min * std::pow(1.0 - uniform_dis(gen), -1.0 / alpha));
+        }
+        else
+        {
+            segment_length = std::round(uniform_dis(gen) * avg_segment_length * 2);
+        }
         offsets.push_back(offset);
-        segments_count++;
         offset += segment_length;
     }
     offsets.push_back(size);
+    return offsets;
+}
+
+template<class T>
+void run_benchmark(benchmark::State& state,
+                   segment_distribution distribution,
+                   size_t desired_segments,
+                   hipStream_t stream,
+                   size_t size)
+{
+    using offset_type = int;
+    using value_type = T;
+
+    // Generate data
+    std::vector<offset_type> offsets = generate_offsets<offset_type>(distribution, desired_segments, size);
+    const unsigned int segments_count = offsets.size() - 1;
 
     std::vector<value_type> values_input(size);
     std::iota(values_input.begin(), values_input.end(), 0);
@@ -177,21 +217,27 @@ void run_benchmark(benchmark::State& state, size_t desired_segments, hipStream_t
     HIP_CHECK(hipFree(d_aggregates_output));
 }
 
-#define CREATE_BENCHMARK(T, SEGMENTS) \
+#define CREATE_BENCHMARK(T, DISTRIBUTION, SEGMENTS) \
 benchmark::RegisterBenchmark( \
     (std::string("segmented_reduce") + "<" #T ">" + \
-        "(~" + std::to_string(SEGMENTS) + " segments)" \
+        "(" #DISTRIBUTION ", ~" + std::to_string(SEGMENTS) + " segments)" \
     ).c_str(), \
     run_benchmark<T>, \
-    SEGMENTS, stream, size \
+    segment_distribution::DISTRIBUTION, SEGMENTS, stream, size \
 )
 
 #define BENCHMARK_TYPE(type) \
-    CREATE_BENCHMARK(type, 1), \
-    CREATE_BENCHMARK(type, 10), \
-    CREATE_BENCHMARK(type, 100), \
-    CREATE_BENCHMARK(type, 1000), \
-    CREATE_BENCHMARK(type, 10000)
+    CREATE_BENCHMARK(type, uniform, 1), \
+    CREATE_BENCHMARK(type, uniform, 10), \
+    CREATE_BENCHMARK(type, uniform, 100), \
+    CREATE_BENCHMARK(type, uniform, 1000), \
+    CREATE_BENCHMARK(type, uniform, 10000)
+
+#define BENCHMARK_SKEWED_TYPE(type) \
+    CREATE_BENCHMARK(type, power_law, 1000), \
+    CREATE_BENCHMARK(type, power_law, 100000), \
+    CREATE_BENCHMARK(type, single_giant, 1000), \
+    CREATE_BENCHMARK(type, single_giant, 100000)
 
 void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                     hipStream_t stream,
@@ -210,6 +256,10 @@ void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
         BENCHMARK_TYPE(int),
         BENCHMARK_TYPE(custom_float2),
         BENCHMARK_TYPE(custom_double2),
+
+        BENCHMARK_SKEWED_TYPE(float),
+        BENCHMARK_SKEWED_TYPE(double),
+        BENCHMARK_SKEWED_TYPE(int),
     };
 
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
@@ -57,6 +57,8 @@
 // Defines targeted AMD architecture. Supported values:
 // * 803 (gfx803)
 // * 900 (gfx900)
+// If it is not defined, some algorithms (select, partition, unique) select default configs
+// for the family of the current device at run time.
 #ifndef ROCPRIM_TARGET_ARCH
     #define ROCPRIM_TARGET_ARCH 0
 #endif
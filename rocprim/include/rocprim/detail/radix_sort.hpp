@@ -25,6 +25,8 @@
 
 #include "../config.hpp"
 #include "../type_traits.hpp"
+#include "../types/radix_key_decomposer.hpp"
+#include "../types/tuple.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 namespace detail
@@ -100,12 +102,145 @@ struct radix_key_codec_floating
 };
 
 template<class Key, class Enable = void>
+struct radix_key_codec_base;
+
+// Smallest unsigned integral type that has at least Bits bits
+template<unsigned int Bits>
+struct radix_bit_key
+{
+    #ifdef __SIZEOF_INT128__
+    static_assert(Bits <= 128, "Radix keys can have at most 128 bits");
+    #else
+    static_assert(Bits <= 64, "Radix keys can have at most 64 bits");
+    #endif
+
+    using type =
+        typename std::conditional<(Bits <= 8), unsigned char,
+        typename std::conditional<(Bits <= 16), unsigned short,
+        typename std::conditional<(Bits <= 32), unsigned int,
+        #ifdef __SIZEOF_INT128__
+        typename std::conditional<(Bits <= 64), unsigned long long, unsigned __int128>::type
+        #else
+        unsigned long long
+        #endif
+        >::type>::type>::type;
+};
+
+// Encodes elements of a tuple one after another, the first element goes to the most
+// significant bits, so bit keys of tuples are ordered lexicographically.
+template<class Tuple, size_t I = 0, size_t Size = ::rocprim::tuple_size<Tuple>::value>
+struct radix_key_tuple_codec_impl
+{
+    using element_codec = radix_key_codec_base<typename ::rocprim::tuple_element<I, Tuple>::type>;
+    using element_bit_key_type = typename element_codec::bit_key_type;
+    using next_type = radix_key_tuple_codec_impl<Tuple, I + 1, Size>;
+
+    // Bits of this element and all following elements
+    static constexpr unsigned int bits = 8 * sizeof(element_bit_key_type) + next_type::bits;
+
+    template<class BitKey>
+    ROCPRIM_DEVICE inline
+    static void encode(const Tuple& key, BitKey& bit_key)
+    {
+        bit_key |= static_cast<BitKey>(element_codec::encode(::rocprim::get<I>(key))) << next_type::bits;
+        next_type::encode(key, bit_key);
+    }
+
+    template<class BitKey>
+    ROCPRIM_DEVICE inline
+    static void decode(BitKey bit_key, Tuple& key)
+    {
+        ::rocprim::get<I>(key) =
+            element_codec::decode(static_cast<element_bit_key_type>(bit_key >> next_type::bits));
+        next_type::decode(bit_key, key);
+    }
+};
+
+template<class Tuple, size_t Size>
+struct radix_key_tuple_codec_impl<Tuple, Size, Size>
+{
+    static constexpr unsigned int bits = 0;
+
+    template<class BitKey>
+    ROCPRIM_DEVICE inline
+    static void encode(const Tuple&, BitKey&) { }
+
+    template<class BitKey>
+    ROCPRIM_DEVICE inline
+    static void decode(BitKey, Tuple&) { }
+};
+
+template<class Tuple>
+struct radix_key_tuple_codec
+{
+    using impl_type = radix_key_tuple_codec_impl<Tuple>;
+    using bit_key_type = typename radix_bit_key<impl_type::bits>::type;
+
+    ROCPRIM_DEVICE inline
+    static bit_key_type encode(const Tuple& key)
+    {
+        bit_key_type bit_key = 0;
+        impl_type::encode(key, bit_key);
+        return bit_key;
+    }
+
+    ROCPRIM_DEVICE inline
+    static Tuple decode(bit_key_type bit_key)
+    {
+        Tuple key;
+        impl_type::decode(bit_key, key);
+        return key;
+    }
+};
+
+template<class Key, class Enable = void>
+struct has_radix_key_decomposer : std::false_type { };
+
+template<class Key>
+struct has_radix_key_decomposer<
+    Key,
+    typename std::enable_if<
+        !std::is_same<typename ::rocprim::radix_key_decomposer<Key>::tuple_type, void>::value
+    >::type
+> : std::true_type { };
+
+template<class Key, class Enable>
 struct radix_key_codec_base
 {
     static_assert(sizeof(Key) == 0,
-        "Only integral and floating point types supported as radix sort keys");
+        "Only integral and floating point types and tuples of them supported as radix sort keys, "
+        "other types require specialization of rocprim::radix_key_decomposer");
+};
+
+// User-defined keys are decomposed into tuples
+template<class Key>
+struct radix_key_codec_base<
+    Key,
+    typename std::enable_if<has_radix_key_decomposer<Key>::value>::type
+>
+{
+    using decomposer_type = ::rocprim::radix_key_decomposer<Key>;
+    using tuple_codec = radix_key_tuple_codec<typename decomposer_type::tuple_type>;
+
+    using bit_key_type = typename tuple_codec::bit_key_type;
+
+    ROCPRIM_DEVICE inline
+    static bit_key_type encode(Key key)
+    {
+        return tuple_codec::encode(decomposer_type::decompose(key));
+    }
+
+    ROCPRIM_DEVICE inline
+    static Key decode(bit_key_type bit_key)
+    {
+        return decomposer_type::compose(tuple_codec::decode(bit_key));
+    }
 };
 
+template<class... Types>
+struct radix_key_codec_base<::rocprim::tuple<Types...>>
+    : radix_key_tuple_codec<::rocprim::tuple<Types...>> { };
+
 template<class Key>
 struct radix_key_codec_base<
     Key,
@@ -130,6 +265,47 @@ struct radix_key_codec_base<bool>
     }
 };
 
+#ifdef __SIZEOF_INT128__
+// std::is_integral is false for 128-bit integers in strict standard modes
+template<>
+struct radix_key_codec_base<unsigned __int128>
+{
+    using bit_key_type = unsigned __int128;
+
+    ROCPRIM_DEVICE inline
+    static bit_key_type encode(unsigned __int128 key)
+    {
+        return key;
+    }
+
+    ROCPRIM_DEVICE inline
+    static unsigned __int128 decode(bit_key_type bit_key)
+    {
+        return bit_key;
+    }
+};
+
+template<>
+struct radix_key_codec_base<__int128>
+{
+    using bit_key_type = unsigned __int128;
+
+    static constexpr bit_key_type sign_bit = bit_key_type(1) << 127;
+
+    ROCPRIM_DEVICE inline
+    static bit_key_type encode(__int128 key)
+    {
+        return sign_bit ^ static_cast<bit_key_type>(key);
+    }
+
+    ROCPRIM_DEVICE inline
+    static __int128 decode(bit_key_type bit_key)
+    {
+        return static_cast<__int128>(bit_key ^ sign_bit);
+    }
+};
+#endif
+
 template<>
 struct radix_key_codec_base<::rocprim::half> : radix_key_codec_floating<::rocprim::half, unsigned short> { };
 
@@ -147,6 +323,10 @@ class radix_key_codec : protected radix_key_codec_base<Key>
 public:
     using bit_key_type = typename base_type::bit_key_type;
 
+    // Number of bits of radix keys, it may be less than 8 * sizeof(Key) for tuples and
+    // user-defined keys
+    static constexpr unsigned int bits = 8 * sizeof(bit_key_type);
+
     ROCPRIM_DEVICE inline
     static bit_key_type encode(Key key)
     {
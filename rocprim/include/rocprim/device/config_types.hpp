@@ -49,9 +49,37 @@ struct kernel_config
     static constexpr unsigned int items_per_thread = ItemsPerThread;
 };
 
+/// \brief Strategy of waiting for prefixes of previous blocks in decoupled look-back
+/// (used by scan, select, partition, unique and run-length encoding).
+enum class lookback_backoff
+{
+    /// The strategy is selected for the current device at run time: \p linear on devices
+    /// which are known to suffer from contention of spinning blocks (gfx908), \p none otherwise.
+    automatic,
+    /// Busy waiting.
+    none,
+    /// The sleep time grows linearly up to a limit.
+    linear,
+    /// The sleep time doubles up to a limit.
+    exponential
+};
+
 namespace detail
 {
 
+// Configs without backoff select the strategy at run time
+template<class Config, class = void>
+struct config_lookback_backoff
+{
+    static constexpr lookback_backoff value = lookback_backoff::automatic;
+};
+
+template<class Config>
+struct config_lookback_backoff<Config, decltype((void) Config::backoff)>
+{
+    static constexpr lookback_backoff value = Config::backoff;
+};
+
 template<
     unsigned int MaxBlockSize,
     unsigned int SharedMemoryPerThread,
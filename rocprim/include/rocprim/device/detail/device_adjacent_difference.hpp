@@ -0,0 +1,250 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_ADJACENT_DIFFERENCE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_ADJACENT_DIFFERENCE_HPP_
+
+#include <type_traits>
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+#include "../../types.hpp"
+
+#include "../../block/block_load.hpp"
+#include "../../block/block_store.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Applies difference_op to an item and its neighbour (the previous one for adjacent_difference,
+// the next one for adjacent_difference_right). Items without neighbours are copied.
+template<class Result, class BinaryFunction>
+struct adjacent_difference_op
+{
+    BinaryFunction difference_op;
+
+    template<class T>
+    ROCPRIM_DEVICE inline
+    Result operator()(const T& value, const T& neighbour, bool has_neighbour)
+    {
+        return has_neighbour
+            ? static_cast<Result>(difference_op(value, neighbour))
+            : static_cast<Result>(value);
+    }
+};
+
+// The same for tuples of keys and values: values of items with different keys are copied.
+template<class Result, class BinaryFunction, class KeyCompareFunction>
+struct adjacent_difference_by_key_op
+{
+    BinaryFunction difference_op;
+    KeyCompareFunction key_compare_op;
+
+    template<class Tuple>
+    ROCPRIM_DEVICE inline
+    Result operator()(const Tuple& item, const Tuple& neighbour, bool has_neighbour)
+    {
+        return (has_neighbour && key_compare_op(::rocprim::get<0>(item), ::rocprim::get<0>(neighbour)))
+            ? static_cast<Result>(difference_op(::rocprim::get<1>(item), ::rocprim::get<1>(neighbour)))
+            : static_cast<Result>(::rocprim::get<1>(item));
+    }
+};
+
+// In-place operations: a block may overwrite items which are neighbours of items of other blocks,
+// so these items are saved before the main kernel is launched.
+// boundary_values[block_id] is the neighbour of the block's first item (or the last item if Right).
+template<
+    bool Right,
+    unsigned int ItemsPerBlock,
+    class InputIterator,
+    class InputType
+>
+ROCPRIM_DEVICE inline
+void adjacent_difference_save_boundaries_impl(InputIterator input,
+                                              InputType * boundary_values,
+                                              const unsigned int number_of_blocks)
+{
+    const unsigned int block_id =
+        ::rocprim::detail::block_id<0>() * ::rocprim::detail::block_size<0>()
+        + ::rocprim::detail::block_thread_id<0>();
+    if(Right)
+    {
+        if(block_id + 1 < number_of_blocks)
+        {
+            boundary_values[block_id] = input[static_cast<size_t>(block_id + 1) * ItemsPerBlock];
+        }
+    }
+    else
+    {
+        if(block_id > 0 && block_id < number_of_blocks)
+        {
+            boundary_values[block_id] = input[static_cast<size_t>(block_id) * ItemsPerBlock - 1];
+        }
+    }
+}
+
+template<
+    class Config,
+    bool InPlace,
+    bool Right,
+    class ResultType,
+    class InputIterator,
+    class InputType,
+    class OutputIterator,
+    class DifferenceOp
+>
+ROCPRIM_DEVICE inline
+void adjacent_difference_kernel_impl(InputIterator input,
+                                     const InputType * boundary_values,
+                                     const size_t size,
+                                     OutputIterator output,
+                                     DifferenceOp difference_op)
+{
+    constexpr unsigned int block_size = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    using input_type = InputType;
+    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using result_type =
+        typename std::conditional<
+            std::is_void<output_type>::value, ResultType, output_type
+        >::type;
+
+    using block_load_type = ::rocprim::block_load<
+        input_type, block_size, items_per_thread,
+        ::rocprim::block_load_method::block_load_transpose
+    >;
+    using block_store_type = ::rocprim::block_store<
+        result_type, block_size, items_per_thread,
+        ::rocprim::block_store_method::block_store_transpose
+    >;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type load;
+        typename block_store_type::storage_type store;
+        detail::raw_storage<input_type[block_size]> neighbours;
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const size_t block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+    const bool is_first_block = flat_block_id == 0;
+    const bool is_last_block = flat_block_id == number_of_blocks - 1;
+    const unsigned int valid_count = is_last_block
+        ? static_cast<unsigned int>(size - block_offset)
+        : items_per_block;
+
+    input_type values[items_per_thread];
+    if(is_last_block)
+    {
+        block_load_type().load(input + block_offset, values, valid_count, storage.load);
+    }
+    else
+    {
+        block_load_type().load(input + block_offset, values, storage.load);
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    // Exchange the first (or the last if Right) items of threads, the neighbour of the first
+    // (or the last) item of the tile is loaded from the previous (or the next) tile
+    input_type * neighbours = storage.neighbours.get();
+    neighbours[flat_id] = Right ? values[0] : values[items_per_thread - 1];
+    ::rocprim::syncthreads();
+    input_type thread_neighbour;
+    if(Right)
+    {
+        if(flat_id + 1 < block_size)
+        {
+            thread_neighbour = neighbours[flat_id + 1];
+        }
+        else if(!is_last_block)
+        {
+            thread_neighbour = InPlace
+                ? boundary_values[flat_block_id]
+                : static_cast<input_type>(input[block_offset + items_per_block]);
+        }
+    }
+    else
+    {
+        if(flat_id > 0)
+        {
+            thread_neighbour = neighbours[flat_id - 1];
+        }
+        else if(!is_first_block)
+        {
+            thread_neighbour = InPlace
+                ? boundary_values[flat_block_id]
+                : static_cast<input_type>(input[block_offset - 1]);
+        }
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    result_type output_values[items_per_thread];
+    #pragma unroll
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int index = flat_id * items_per_thread + i;
+        if(index < valid_count)
+        {
+            if(Right)
+            {
+                const bool is_last_item = i == items_per_thread - 1;
+                output_values[i] = difference_op(
+                    values[i],
+                    is_last_item ? thread_neighbour : values[is_last_item ? i : i + 1],
+                    index + 1 < valid_count || (is_last_item && !is_last_block)
+                );
+            }
+            else
+            {
+                const bool is_first_item = i == 0;
+                output_values[i] = difference_op(
+                    values[i],
+                    is_first_item ? thread_neighbour : values[is_first_item ? i : i - 1],
+                    index > 0 || !is_first_block
+                );
+            }
+        }
+    }
+
+    if(is_last_block)
+    {
+        block_store_type().store(output + block_offset, output_values, valid_count, storage.store);
+    }
+    else
+    {
+        block_store_type().store(output + block_offset, output_values, storage.store);
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_ADJACENT_DIFFERENCE_HPP_
@@ -21,6 +21,14 @@
 #ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BINARY_SEARCH_HPP_
 #define ROCPRIM_DEVICE_DETAIL_DEVICE_BINARY_SEARCH_HPP_
 
+#include <type_traits>
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
@@ -96,6 +104,15 @@ struct lower_bound_search_op
     {
         return lower_bound_n(haystack, size, value, compare_op);
     }
+
+    // Returns true if haystack_value is counted by the bound of value,
+    // it defines the order of the merge path of haystack and sorted needles
+    template<class CompareOp, class U, class T>
+    ROCPRIM_DEVICE inline
+    bool is_before(const U& haystack_value, const T& value, CompareOp compare_op) const
+    {
+        return compare_op(haystack_value, value);
+    }
 };
 
 struct upper_bound_search_op
@@ -106,6 +123,13 @@ struct upper_bound_search_op
     {
         return upper_bound_n(haystack, size, value, compare_op);
     }
+
+    template<class CompareOp, class U, class T>
+    ROCPRIM_DEVICE inline
+    bool is_before(const U& haystack_value, const T& value, CompareOp compare_op) const
+    {
+        return !compare_op(value, haystack_value);
+    }
 };
 
 struct binary_search_op
@@ -119,6 +143,208 @@ struct binary_search_op
     }
 };
 
+// Sorted needles: haystack and needles are merged (only conceptually), the merged sequence is split
+// into tiles of equal size. Haystack elements of a tile are loaded into shared memory and bounds of
+// needles of the tile are searched there, so the total number of global loads is
+// O(haystack_size + needles_size) instead of O(needles_size * log(haystack_size)).
+
+// Finds the number of haystack elements among the first diag elements of the merged sequence
+// (partitions[id] for diag = id * items_per_block).
+template<
+    class HaystackIterator,
+    class NeedlesIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+ROCPRIM_DEVICE inline
+void sorted_search_partition_kernel_impl(HaystackIterator haystack,
+                                         NeedlesIterator needles,
+                                         const size_t haystack_size,
+                                         const size_t needles_size,
+                                         size_t * partitions,
+                                         const size_t partitions_count,
+                                         const unsigned int items_per_block,
+                                         SearchFunction search_op,
+                                         CompareFunction compare_op)
+{
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int flat_block_size = ::rocprim::detail::block_size<0>();
+
+    const size_t id = static_cast<size_t>(flat_block_id) * flat_block_size + flat_id;
+    if(id >= partitions_count)
+    {
+        return;
+    }
+
+    const size_t diag = ::rocprim::min(id * items_per_block, haystack_size + needles_size);
+    size_t begin = diag > needles_size ? diag - needles_size : 0;
+    size_t end = ::rocprim::min(diag, haystack_size);
+    while(begin < end)
+    {
+        const size_t mid = begin + (end - begin) / 2;
+        if(search_op.is_before(haystack[mid], needles[diag - 1 - mid], compare_op))
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+    partitions[id] = begin;
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class HaystackIterator,
+    class NeedlesIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+ROCPRIM_DEVICE inline
+void sorted_search_kernel_impl(HaystackIterator haystack,
+                               NeedlesIterator needles,
+                               OutputIterator output,
+                               const size_t haystack_size,
+                               const size_t needles_size,
+                               const size_t * partitions,
+                               SearchFunction search_op,
+                               CompareFunction compare_op)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using haystack_type = typename std::iterator_traits<HaystackIterator>::value_type;
+    using needle_type = typename std::iterator_traits<NeedlesIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY detail::raw_storage<haystack_type[items_per_block]> storage;
+    haystack_type * haystack_shared = storage.get();
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+
+    const size_t diag_begin = static_cast<size_t>(flat_block_id) * items_per_block;
+    const size_t diag_end = ::rocprim::min(diag_begin + items_per_block, haystack_size + needles_size);
+    const size_t haystack_begin = partitions[flat_block_id];
+    const size_t haystack_end = partitions[flat_block_id + 1];
+    const size_t needles_begin = diag_begin - haystack_begin;
+    const unsigned int haystack_count = static_cast<unsigned int>(haystack_end - haystack_begin);
+    const unsigned int needles_count =
+        static_cast<unsigned int>((diag_end - haystack_end) - needles_begin);
+
+    for(unsigned int i = flat_id; i < haystack_count; i += BlockSize)
+    {
+        haystack_shared[i] = haystack[haystack_begin + i];
+    }
+    ::rocprim::syncthreads();
+
+    // Bounds of all needles of the tile are in [haystack_begin, haystack_end]
+    for(unsigned int i = flat_id; i < needles_count; i += BlockSize)
+    {
+        const needle_type value = needles[needles_begin + i];
+        output[needles_begin + i] =
+            haystack_begin + search_op(haystack_shared, haystack_count, value, compare_op);
+    }
+}
+
+// Search index: the sorted haystack is stored in Eytzinger (breadth-first) order of a perfect
+// binary search tree with `levels` levels, i.e. children of node k (1-based) are 2k and 2k + 1.
+// Nodes of the last level which are not covered by the haystack (padding) store the largest
+// element. The top levels of the tree are small and are accessed by all needles, so they are
+// loaded into shared memory once per block, and the remaining levels are probed in global memory.
+
+// Returns the number of levels of the smallest perfect tree which contains haystack_size elements
+ROCPRIM_HOST_DEVICE inline
+unsigned int search_index_levels(const size_t haystack_size)
+{
+    unsigned int levels = 0;
+    while((size_t(1) << levels) - 1 < haystack_size)
+    {
+        levels++;
+    }
+    return levels;
+}
+
+// Returns the rank (position in the sorted haystack) of node k, it can be greater than or equal
+// to haystack_size for padding nodes
+ROCPRIM_HOST_DEVICE inline
+size_t search_index_rank(const size_t k, const unsigned int levels)
+{
+    unsigned int depth = 0;
+    while((size_t(2) << depth) <= k)
+    {
+        depth++;
+    }
+    return ((2 * (k - (size_t(1) << depth)) + 1) << (levels - 1 - depth)) - 1;
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int SharedLevels,
+    class T,
+    class NeedlesIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+ROCPRIM_DEVICE inline
+void indexed_search_kernel_impl(const T * index,
+                                const unsigned int levels,
+                                const size_t haystack_size,
+                                NeedlesIterator needles,
+                                OutputIterator output,
+                                const size_t needles_size,
+                                SearchFunction search_op,
+                                CompareFunction compare_op)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    constexpr unsigned int max_shared_size = (1u << SharedLevels) - 1;
+
+    using needle_type = typename std::iterator_traits<NeedlesIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY detail::raw_storage<T[max_shared_size]> storage;
+    T * index_shared = storage.get();
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+
+    const unsigned int shared_levels = ::rocprim::min(SharedLevels, levels);
+    const unsigned int shared_size = (1u << shared_levels) - 1;
+    for(unsigned int i = flat_id; i < shared_size; i += BlockSize)
+    {
+        index_shared[i] = index[i];
+    }
+    ::rocprim::syncthreads();
+
+    const size_t block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const size_t id = block_offset + i * BlockSize + flat_id;
+        if(id < needles_size)
+        {
+            const needle_type value = needles[id];
+            // After all levels k - 2^levels is the number of elements of the padded haystack
+            // which are before the bound of value
+            size_t k = 1;
+            for(unsigned int level = 0; level < shared_levels; level++)
+            {
+                k = 2 * k + (search_op.is_before(index_shared[k - 1], value, compare_op) ? 1 : 0);
+            }
+            for(unsigned int level = shared_levels; level < levels; level++)
+            {
+                k = 2 * k + (search_op.is_before(index[k - 1], value, compare_op) ? 1 : 0);
+            }
+            // Padding elements are equal to the largest element, so they can only be before
+            // the bound if all elements are
+            output[id] = ::rocprim::min(k - (size_t(1) << levels), haystack_size);
+        }
+    }
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,305 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_DETERMINISTIC_SUM_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_DETERMINISTIC_SUM_HPP_
+
+#include <type_traits>
+#include <iterator>
+#include <limits>
+#include <cmath>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../functional.hpp"
+#include "../../types.hpp"
+
+#include "device_reduce.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Deterministic sums of floating-point values are calculated in two passes.
+//
+// The first pass finds the maximum absolute value of finite items, presence of
+// NaNs and infinities and the number of items to be summed (a tuple of stats).
+// The maximum defines the exponent e (all |x| < 2^e), the number of items n
+// defines the number of bits W = 63 - bit_width(n) of one level.
+//
+// The second pass splits every item into 3 integers (levels): x is approximately
+// i0 * 2^(e - W) + i1 * 2^(e - 2W) + i2 * 2^(e - 3W), |ik| < 2^W, (bits below
+// 2^(e - 3W) are discarded). Sums of levels cannot overflow and integer addition
+// is associative, so they do not depend on the order of additions, i.e. on block
+// sizes, tiling and the target architecture. Sums of levels are converted to the
+// floating-point result by a fixed sequence of operations.
+
+// Maximum of finite absolute values, flags, number of items
+using deterministic_sum_stats = ::rocprim::tuple<double, unsigned int, unsigned long long>;
+// Sums of levels
+using deterministic_sum_type = ::rocprim::tuple<long long, long long, long long>;
+
+enum deterministic_sum_flags : unsigned int
+{
+    deterministic_sum_has_nan = 1,
+    deterministic_sum_has_pos_inf = 2,
+    deterministic_sum_has_neg_inf = 4
+};
+
+struct deterministic_sum_scale
+{
+    int exponent;
+    int word_bits;
+    unsigned int flags;
+};
+
+template<class T>
+struct deterministic_sum_stats_transform_op
+{
+    ROCPRIM_HOST_DEVICE inline
+    deterministic_sum_stats operator()(const T& value) const
+    {
+        const double x = static_cast<double>(value);
+        if(x != x)
+        {
+            return deterministic_sum_stats(0.0, deterministic_sum_has_nan, 1);
+        }
+        if(::fabs(x) > std::numeric_limits<double>::max())
+        {
+            return deterministic_sum_stats(
+                0.0, x > 0.0 ? deterministic_sum_has_pos_inf : deterministic_sum_has_neg_inf, 1
+            );
+        }
+        return deterministic_sum_stats(::fabs(x), 0, 1);
+    }
+};
+
+struct deterministic_sum_flags_op
+{
+    ROCPRIM_HOST_DEVICE inline
+    unsigned int operator()(const unsigned int& a, const unsigned int& b) const
+    {
+        return a | b;
+    }
+};
+
+// Stats of all items of a range (items are counted)
+using deterministic_sum_stats_op = multi_reduce_op<
+    ::rocprim::maximum<double>,
+    deterministic_sum_flags_op,
+    ::rocprim::plus<unsigned long long>
+>;
+
+using deterministic_sum_op = multi_reduce_op<
+    ::rocprim::plus<long long>,
+    ::rocprim::plus<long long>,
+    ::rocprim::plus<long long>
+>;
+
+ROCPRIM_HOST_DEVICE inline
+deterministic_sum_scale make_deterministic_sum_scale(const deterministic_sum_stats& stats)
+{
+    deterministic_sum_scale scale;
+    ::frexp(::rocprim::get<0>(stats), &scale.exponent);
+    int count_bits = 0;
+    for(unsigned long long count = ::rocprim::get<2>(stats); count > 0; count >>= 1)
+    {
+        count_bits++;
+    }
+    scale.word_bits = 63 - count_bits;
+    scale.flags = ::rocprim::get<1>(stats);
+    return scale;
+}
+
+template<class T>
+struct deterministic_sum_split_op
+{
+    const deterministic_sum_scale * scale;
+
+    ROCPRIM_HOST_DEVICE inline
+    deterministic_sum_type operator()(const T& value) const
+    {
+        const int exponent = scale->exponent;
+        const int word_bits = scale->word_bits;
+
+        double x = static_cast<double>(value);
+        // NaNs and infinities do not take part in the sum (see flags)
+        if(!(::fabs(x) <= std::numeric_limits<double>::max()))
+        {
+            x = 0.0;
+        }
+        // All operations are exact: scaling by powers of 2 and subtraction of
+        // the integral part
+        x = ::ldexp(x, word_bits - exponent);
+        const long long i0 = static_cast<long long>(x);
+        x = ::ldexp(x - static_cast<double>(i0), word_bits);
+        const long long i1 = static_cast<long long>(x);
+        x = ::ldexp(x - static_cast<double>(i1), word_bits);
+        const long long i2 = static_cast<long long>(x);
+        return deterministic_sum_type(i0, i1, i2);
+    }
+};
+
+template<class ResultType>
+ROCPRIM_HOST_DEVICE inline
+ResultType deterministic_sum_result(const deterministic_sum_type& sum,
+                                    const deterministic_sum_scale& scale,
+                                    const double initial_value)
+{
+    if((scale.flags & deterministic_sum_has_nan)
+        || (scale.flags & deterministic_sum_has_pos_inf && scale.flags & deterministic_sum_has_neg_inf))
+    {
+        return static_cast<ResultType>(std::numeric_limits<double>::quiet_NaN());
+    }
+    if(scale.flags & deterministic_sum_has_pos_inf)
+    {
+        return static_cast<ResultType>(std::numeric_limits<double>::infinity());
+    }
+    if(scale.flags & deterministic_sum_has_neg_inf)
+    {
+        return static_cast<ResultType>(-std::numeric_limits<double>::infinity());
+    }
+    const int exponent = scale.exponent;
+    const int word_bits = scale.word_bits;
+    const double value =
+        ::ldexp(static_cast<double>(::rocprim::get<0>(sum)), exponent - word_bits)
+        + ::ldexp(static_cast<double>(::rocprim::get<1>(sum)), exponent - 2 * word_bits)
+        + ::ldexp(static_cast<double>(::rocprim::get<2>(sum)), exponent - 3 * word_bits);
+    return static_cast<ResultType>(initial_value + value);
+}
+
+// Output iterator that stores the scale calculated from stats (the result of the first pass)
+class deterministic_sum_scale_output_iterator
+{
+public:
+    struct reference
+    {
+        deterministic_sum_scale * scale;
+
+        ROCPRIM_HOST_DEVICE inline
+        reference& operator=(const deterministic_sum_stats& stats)
+        {
+            *scale = make_deterministic_sum_scale(stats);
+            return *this;
+        }
+    };
+
+    using value_type = void;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE inline
+    explicit deterministic_sum_scale_output_iterator(deterministic_sum_scale * scale)
+        : scale_(scale)
+    { }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference { scale_ };
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type) const
+    {
+        // Only one value is stored
+        return reference { scale_ };
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    deterministic_sum_scale_output_iterator operator+(difference_type) const
+    {
+        return *this;
+    }
+
+private:
+    deterministic_sum_scale * scale_;
+};
+
+// Output iterator that converts sums of levels to values of ResultType
+template<class OutputIterator, class ResultType>
+class deterministic_sum_output_iterator
+{
+public:
+    struct reference
+    {
+        OutputIterator output;
+        const deterministic_sum_scale * scale;
+        double initial_value;
+
+        ROCPRIM_HOST_DEVICE inline
+        reference& operator=(const deterministic_sum_type& sum)
+        {
+            *output = deterministic_sum_result<ResultType>(sum, *scale, initial_value);
+            return *this;
+        }
+    };
+
+    using value_type = void;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE inline
+    deterministic_sum_output_iterator(OutputIterator output,
+                                      const deterministic_sum_scale * scale,
+                                      double initial_value)
+        : output_(output), scale_(scale), initial_value_(initial_value)
+    { }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference { output_, scale_, initial_value_ };
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference { output_ + distance, scale_, initial_value_ };
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    deterministic_sum_output_iterator operator+(difference_type distance) const
+    {
+        return deterministic_sum_output_iterator(output_ + distance, scale_, initial_value_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    deterministic_sum_output_iterator& operator+=(difference_type distance)
+    {
+        output_ += distance;
+        return *this;
+    }
+
+private:
+    OutputIterator output_;
+    const deterministic_sum_scale * scale_;
+    double initial_value_;
+};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_DETERMINISTIC_SUM_HPP_
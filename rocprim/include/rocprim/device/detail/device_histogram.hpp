@@ -38,6 +38,14 @@ BEGIN_ROCPRIM_NAMESPACE
 namespace detail
 {
 
+// Distance between privatized copies of a histogram in shared memory. It is padded to an odd
+// value, so the same bin of different copies is in different banks (e.g. for 2^n bins).
+ROCPRIM_HOST_DEVICE inline
+unsigned int get_block_histogram_stride(const unsigned int bins)
+{
+    return bins | 1u;
+}
+
 // Special wrapper for passing fixed-length arrays (i.e. T values[Size]) into kernels
 template<class T, unsigned int Size>
 class fixed_array
@@ -289,17 +297,18 @@ load_samples(unsigned int flat_id,
     );
 }
 
+// Loads samples in blocked arrangement: values[i] is the sample flat_id * ItemsPerThread + i
+// of the tile. It is required when samples are matched with other data (e.g. weights).
 template<
-    unsigned int BlockSize,
     unsigned int ItemsPerThread,
     unsigned int Channels,
     class Sample,
     class SampleIterator
 >
 ROCPRIM_DEVICE inline
-void load_samples(unsigned int flat_id,
-                  SampleIterator samples,
-                  sample_vector<Sample, Channels> (&values)[ItemsPerThread])
+void load_samples_blocked(unsigned int flat_id,
+                          SampleIterator samples,
+                          sample_vector<Sample, Channels> (&values)[ItemsPerThread])
 {
     Sample tmp[Channels * ItemsPerThread];
     block_load_direct_blocked(
@@ -317,17 +326,16 @@ void load_samples(unsigned int flat_id,
 }
 
 template<
-    unsigned int BlockSize,
     unsigned int ItemsPerThread,
     unsigned int Channels,
     class Sample,
     class SampleIterator
 >
 ROCPRIM_DEVICE inline
-void load_samples(unsigned int flat_id,
-                  SampleIterator samples,
-                  sample_vector<Sample, Channels> (&values)[ItemsPerThread],
-                  unsigned int valid_count)
+void load_samples_blocked(unsigned int flat_id,
+                          SampleIterator samples,
+                          sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                          unsigned int valid_count)
 {
     Sample tmp[Channels * ItemsPerThread];
     block_load_direct_blocked(
@@ -345,6 +353,156 @@ void load_samples(unsigned int flat_id,
     }
 }
 
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    class Sample,
+    class SampleIterator
+>
+ROCPRIM_DEVICE inline
+void load_samples(unsigned int flat_id,
+                  SampleIterator samples,
+                  sample_vector<Sample, Channels> (&values)[ItemsPerThread])
+{
+    load_samples_blocked(flat_id, samples, values);
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    class Sample,
+    class SampleIterator
+>
+ROCPRIM_DEVICE inline
+void load_samples(unsigned int flat_id,
+                  SampleIterator samples,
+                  sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                  unsigned int valid_count)
+{
+    load_samples_blocked(flat_id, samples, values, valid_count);
+}
+
+// Weights of samples of (not weighted) histograms: every sample adds 1 to its bin
+struct unit_weights { };
+
+// Type of bins of block histograms (in shared memory): counts are accumulated as unsigned int
+// regardless of Counter, weights are accumulated as Counter (e.g. float or double).
+template<class Weights, class Counter>
+struct histogram_bin_counter
+{
+    using type = Counter;
+};
+
+template<class Counter>
+struct histogram_bin_counter<unit_weights, Counter>
+{
+    using type = unsigned int;
+};
+
+// Loads samples and their weights in the same arrangement. Samples of weighted histograms
+// are loaded in blocked arrangement (without vectorization) to match weights.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    class Sample,
+    class SampleIterator,
+    class T
+>
+ROCPRIM_DEVICE inline
+void load_weighted_samples(unsigned int flat_id,
+                           SampleIterator samples,
+                           unit_weights /* weights */,
+                           sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                           T (&sample_weights)[ItemsPerThread])
+{
+    load_samples<BlockSize>(flat_id, samples, values);
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        sample_weights[i] = 1;
+    }
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    class Sample,
+    class SampleIterator,
+    class T
+>
+ROCPRIM_DEVICE inline
+void load_weighted_samples(unsigned int flat_id,
+                           SampleIterator samples,
+                           unit_weights /* weights */,
+                           sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                           T (&sample_weights)[ItemsPerThread],
+                           unsigned int valid_count)
+{
+    load_samples<BlockSize>(flat_id, samples, values, valid_count);
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        sample_weights[i] = 1;
+    }
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    class Sample,
+    class SampleIterator,
+    class WeightIterator,
+    class T
+>
+ROCPRIM_DEVICE inline
+void load_weighted_samples(unsigned int flat_id,
+                           SampleIterator samples,
+                           WeightIterator weights,
+                           sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                           T (&sample_weights)[ItemsPerThread])
+{
+    load_samples_blocked(flat_id, samples, values);
+    block_load_direct_blocked(flat_id, weights, sample_weights);
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    class Sample,
+    class SampleIterator,
+    class WeightIterator,
+    class T
+>
+ROCPRIM_DEVICE inline
+void load_weighted_samples(unsigned int flat_id,
+                           SampleIterator samples,
+                           WeightIterator weights,
+                           sample_vector<Sample, Channels> (&values)[ItemsPerThread],
+                           T (&sample_weights)[ItemsPerThread],
+                           unsigned int valid_count)
+{
+    load_samples_blocked(flat_id, samples, values, valid_count);
+    block_load_direct_blocked(flat_id, weights, sample_weights, valid_count);
+}
+
+// Returns weights of samples starting from offset
+ROCPRIM_DEVICE inline
+unit_weights offset_weights(unit_weights weights, size_t /* offset */)
+{
+    return weights;
+}
+
+template<class WeightIterator>
+ROCPRIM_DEVICE inline
+WeightIterator offset_weights(WeightIterator weights, size_t offset)
+{
+    return weights + offset;
+}
+
 template<
     unsigned int BlockSize,
     unsigned int ActiveChannels,
@@ -367,25 +525,85 @@ void init_histogram(fixed_array<Counter *, ActiveChannels> histogram,
     }
 }
 
+// Pre-aggregates runs of equal bins of a thread: consecutive samples often fall into the same bin
+// (skewed distributions, smooth images), so each run is added with one atomic operation.
+// T is the type of counts (unsigned int) or sums of weights.
+template<unsigned int ActiveChannels, class T = unsigned int>
+struct bin_runs
+{
+    unsigned int bins[ActiveChannels];
+    T values[ActiveChannels];
+    bool active[ActiveChannels];
+
+    ROCPRIM_DEVICE inline
+    bin_runs()
+    {
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            active[channel] = false;
+        }
+    }
+
+    template<class Counter>
+    ROCPRIM_DEVICE inline
+    void add(Counter * (&histogram)[ActiveChannels], unsigned int channel, unsigned int bin, T value)
+    {
+        if(active[channel] && bins[channel] == bin)
+        {
+            values[channel] += value;
+            return;
+        }
+        if(active[channel])
+        {
+            ::rocprim::detail::atomic_add(&histogram[channel][bins[channel]], values[channel]);
+        }
+        active[channel] = true;
+        bins[channel] = bin;
+        values[channel] = value;
+    }
+
+    template<class Counter>
+    ROCPRIM_DEVICE inline
+    void flush(Counter * (&histogram)[ActiveChannels])
+    {
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            if(active[channel])
+            {
+                ::rocprim::detail::atomic_add(&histogram[channel][bins[channel]], values[channel]);
+            }
+        }
+    }
+};
+
+// block_histogram_start contains histograms copies of the histogram (all active channels),
+// thread flat_id updates copy flat_id % histograms, so lanes of the same wavefront
+// having the same bin update different addresses.
+// Weights is unit_weights for counting histograms or an iterator of weights of samples
+// (one weight per pixel, shared by all channels).
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     unsigned int Channels,
     unsigned int ActiveChannels,
     class SampleIterator,
+    class Weights,
     class Counter,
-    class SampleToBinOp
+    class SampleToBinOp,
+    class BinCounter
 >
 ROCPRIM_DEVICE inline
 void histogram_shared(SampleIterator samples,
+                      Weights weights,
                       unsigned int columns,
                       unsigned int rows,
                       unsigned int row_stride,
                       unsigned int rows_per_block,
+                      unsigned int histograms,
                       fixed_array<Counter *, ActiveChannels> histogram,
                       fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
                       fixed_array<unsigned int, ActiveChannels> bins,
-                      unsigned int * block_histogram_start)
+                      BinCounter * block_histogram_start)
 {
     using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
     using sample_vector_type = sample_vector<sample_type, Channels>;
@@ -397,18 +615,28 @@ void histogram_shared(SampleIterator samples,
     const unsigned int block_id1 = ::rocprim::detail::block_id<1>();
     const unsigned int grid_size0 = ::rocprim::detail::grid_size<0>();
 
-    unsigned int * block_histogram[ActiveChannels];
+    BinCounter * block_histogram[ActiveChannels];
+    unsigned int total_bins = 0;
     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
     {
-        block_histogram[channel] = block_histogram_start;
-        block_histogram_start += bins[channel];
-        for(unsigned int bin = flat_id; bin < bins[channel]; bin += BlockSize)
-        {
-            block_histogram[channel][bin] = 0;
-        }
+        block_histogram[channel] = block_histogram_start + total_bins;
+        total_bins += bins[channel];
+    }
+    const unsigned int histogram_stride = get_block_histogram_stride(total_bins);
+    for(unsigned int bin = flat_id; bin < histogram_stride * histograms; bin += BlockSize)
+    {
+        block_histogram_start[bin] = 0;
     }
     ::rocprim::syncthreads();
 
+    BinCounter * thread_histogram[ActiveChannels];
+    const unsigned int histogram_offset = (flat_id % histograms) * histogram_stride;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        thread_histogram[channel] = block_histogram[channel] + histogram_offset;
+    }
+    bin_runs<ActiveChannels, BinCounter> runs;
+
     const unsigned int start_row = block_id1 * rows_per_block;
     const unsigned int end_row = ::rocprim::min(rows, start_row + rows_per_block);
     for(unsigned int row = start_row; row < end_row; row++)
@@ -419,10 +647,16 @@ void histogram_shared(SampleIterator samples,
         while(block_offset < columns)
         {
             sample_vector_type values[ItemsPerThread];
+            BinCounter sample_weights[ItemsPerThread];
+            const auto tile_weights =
+                offset_weights(weights, static_cast<size_t>(row) * columns + block_offset);
 
             if(block_offset + items_per_block <= columns)
             {
-                load_samples<BlockSize>(flat_id, row_samples + Channels * block_offset, values);
+                load_weighted_samples<BlockSize>(
+                    flat_id, row_samples + Channels * block_offset, tile_weights,
+                    values, sample_weights
+                );
 
                 for(unsigned int i = 0; i < ItemsPerThread; i++)
                 {
@@ -431,7 +665,7 @@ void histogram_shared(SampleIterator samples,
                         unsigned int bin;
                         if(sample_to_bin_op[channel](values[i].values[channel], bin))
                         {
-                            ::rocprim::detail::atomic_add(&block_histogram[channel][bin], 1);
+                            runs.add(thread_histogram, channel, bin, sample_weights[i]);
                         }
                     }
                 }
@@ -439,7 +673,10 @@ void histogram_shared(SampleIterator samples,
             else
             {
                 const unsigned int valid_count = columns - block_offset;
-                load_samples<BlockSize>(flat_id, row_samples + Channels * block_offset, values, valid_count);
+                load_weighted_samples<BlockSize>(
+                    flat_id, row_samples + Channels * block_offset, tile_weights,
+                    values, sample_weights, valid_count
+                );
 
                 for(unsigned int i = 0; i < ItemsPerThread; i++)
                 {
@@ -450,7 +687,7 @@ void histogram_shared(SampleIterator samples,
                             unsigned int bin;
                             if(sample_to_bin_op[channel](values[i].values[channel], bin))
                             {
-                                ::rocprim::detail::atomic_add(&block_histogram[channel][bin], 1);
+                                runs.add(thread_histogram, channel, bin, sample_weights[i]);
                             }
                         }
                     }
@@ -460,15 +697,22 @@ void histogram_shared(SampleIterator samples,
             block_offset += grid_size0 * items_per_block;
         }
     }
+    runs.flush(thread_histogram);
     ::rocprim::syncthreads();
 
+    // Merge copies
     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
     {
         for(unsigned int bin = flat_id; bin < bins[channel]; bin += BlockSize)
         {
-            if(block_histogram[channel][bin] > 0)
+            BinCounter value = 0;
+            for(unsigned int h = 0; h < histograms; h++)
+            {
+                value += block_histogram[channel][h * histogram_stride + bin];
+            }
+            if(value != BinCounter(0))
             {
-                ::rocprim::detail::atomic_add(&histogram[channel][bin], block_histogram[channel][bin]);
+                ::rocprim::detail::atomic_add(&histogram[channel][bin], value);
             }
         }
     }
@@ -544,6 +788,314 @@ void histogram_global(SampleIterator samples,
     }
 }
 
+// Weighted samples cannot be aggregated with ballots like counts, instead runs of equal bins of
+// a thread are pre-aggregated (weights and samples are loaded in blocked arrangement).
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    unsigned int ActiveChannels,
+    class SampleIterator,
+    class WeightIterator,
+    class Counter,
+    class SampleToBinOp
+>
+ROCPRIM_DEVICE inline
+void histogram_global_weighted(SampleIterator samples,
+                               WeightIterator weights,
+                               unsigned int columns,
+                               unsigned int row_stride,
+                               fixed_array<Counter *, ActiveChannels> histogram,
+                               fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+    using sample_vector_type = sample_vector<sample_type, Channels>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id0 = ::rocprim::detail::block_id<0>();
+    const unsigned int block_id1 = ::rocprim::detail::block_id<1>();
+    const unsigned int block_offset = block_id0 * items_per_block;
+
+    samples += block_id1 * row_stride + Channels * block_offset;
+    weights += static_cast<size_t>(block_id1) * columns + block_offset;
+
+    sample_vector_type values[ItemsPerThread];
+    Counter sample_weights[ItemsPerThread];
+    unsigned int valid_count;
+    if(block_offset + items_per_block <= columns)
+    {
+        valid_count = items_per_block;
+        load_weighted_samples<BlockSize>(flat_id, samples, weights, values, sample_weights);
+    }
+    else
+    {
+        valid_count = columns - block_offset;
+        load_weighted_samples<BlockSize>(flat_id, samples, weights, values, sample_weights, valid_count);
+    }
+
+    Counter * thread_histogram[ActiveChannels];
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        thread_histogram[channel] = histogram[channel];
+    }
+    bin_runs<ActiveChannels, Counter> runs;
+
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        if(flat_id * ItemsPerThread + i < valid_count)
+        {
+            for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+            {
+                unsigned int bin;
+                if(sample_to_bin_op[channel](values[i].values[channel], bin))
+                {
+                    runs.add(thread_histogram, channel, bin, sample_weights[i]);
+                }
+            }
+        }
+    }
+    runs.flush(thread_histogram);
+}
+
+// Sort-based implementation: bins of all samples are stored as keys which are sorted and counted.
+// Bins of the channel are offset by the total number of bins of previous channels,
+// samples outside of histogram ranges get the key equal to the total number of bins.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    unsigned int ActiveChannels,
+    class SampleIterator,
+    class SampleToBinOp
+>
+ROCPRIM_DEVICE inline
+void histogram_sort_keys(SampleIterator samples,
+                         unsigned int columns,
+                         unsigned int row_stride,
+                         fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                         fixed_array<unsigned int, ActiveChannels> bins,
+                         unsigned int * keys)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+    using sample_vector_type = sample_vector<sample_type, Channels>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id0 = ::rocprim::detail::block_id<0>();
+    const unsigned int block_id1 = ::rocprim::detail::block_id<1>();
+    const unsigned int block_offset = block_id0 * items_per_block;
+
+    samples += block_id1 * row_stride + Channels * block_offset;
+    keys += (static_cast<size_t>(block_id1) * columns + block_offset) * ActiveChannels;
+
+    sample_vector_type values[ItemsPerThread];
+    unsigned int valid_count;
+    if(block_offset + items_per_block <= columns)
+    {
+        valid_count = items_per_block;
+        load_samples<BlockSize>(flat_id, samples, values);
+    }
+    else
+    {
+        valid_count = columns - block_offset;
+        load_samples<BlockSize>(flat_id, samples, values, valid_count);
+    }
+
+    unsigned int bins_offsets[ActiveChannels];
+    unsigned int total_bins = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        bins_offsets[channel] = total_bins;
+        total_bins += bins[channel];
+    }
+
+    // Positions of keys may differ from positions of samples (vectorized loading of full tiles),
+    // it does not matter because all keys are sorted.
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const unsigned int pos = flat_id * ItemsPerThread + i;
+        if(pos < valid_count)
+        {
+            for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+            {
+                unsigned int bin;
+                keys[pos * ActiveChannels + channel] =
+                    sample_to_bin_op[channel](values[i].values[channel], bin)
+                        ? bins_offsets[channel] + bin
+                        : total_bins;
+            }
+        }
+    }
+}
+
+// The first item of every run of equal sorted keys finds the end of the run and stores its length.
+// Bins without samples are not stored, they are initialized by init_histogram.
+template<
+    unsigned int BlockSize,
+    unsigned int ActiveChannels,
+    class Counter
+>
+ROCPRIM_DEVICE inline
+void histogram_sort_count(const unsigned int * sorted_keys,
+                          unsigned int size,
+                          fixed_array<Counter *, ActiveChannels> histogram,
+                          fixed_array<unsigned int, ActiveChannels> bins)
+{
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id = ::rocprim::detail::block_id<0>();
+
+    const unsigned int index = block_id * BlockSize + flat_id;
+    if(index >= size)
+    {
+        return;
+    }
+    const unsigned int key = sorted_keys[index];
+    if(index > 0 && sorted_keys[index - 1] == key)
+    {
+        return;
+    }
+
+    unsigned int bins_offset = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        if(key < bins_offset + bins[channel])
+        {
+            const unsigned int count = upper_bound(sorted_keys + index, size - index, key);
+            histogram[channel][key - bins_offset] = static_cast<Counter>(count);
+            return;
+        }
+        bins_offset += bins[channel];
+    }
+    // Keys of samples outside of histogram ranges are ignored
+}
+
+// Adds samples [begin, end) to thread_histogram (all threads of the block process the range)
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class SampleIterator,
+    class BinCounter,
+    class SampleToBinOp
+>
+ROCPRIM_DEVICE inline
+void segment_histogram_accumulate(SampleIterator samples,
+                                  unsigned int begin,
+                                  unsigned int end,
+                                  BinCounter * thread_histogram,
+                                  SampleToBinOp sample_to_bin_op)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+    using sample_vector_type = sample_vector<sample_type, 1>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    BinCounter * histogram[1] = { thread_histogram };
+    bin_runs<1> runs;
+
+    for(unsigned int block_offset = begin; block_offset < end; block_offset += items_per_block)
+    {
+        sample_vector_type values[ItemsPerThread];
+        unsigned int valid_count;
+        if(block_offset + items_per_block <= end)
+        {
+            valid_count = items_per_block;
+            load_samples<BlockSize>(flat_id, samples + block_offset, values);
+        }
+        else
+        {
+            valid_count = end - block_offset;
+            load_samples<BlockSize>(flat_id, samples + block_offset, values, valid_count);
+        }
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            unsigned int bin;
+            if(flat_id * ItemsPerThread + i < valid_count
+                && sample_to_bin_op(values[i].values[0], bin))
+            {
+                runs.add(histogram, 0, bin, 1u);
+            }
+        }
+    }
+    runs.flush(histogram);
+}
+
+// Segmented histogram: block segment_id computes the histogram of samples
+// [begin_offsets[segment_id], end_offsets[segment_id]) and stores it to
+// histogram + segment_id * bins. All bins are stored so histograms are not initialized separately.
+// If histograms > 0 the block histogram is accumulated in shared memory (block_histogram_start
+// contains histograms privatized copies), otherwise bins are accumulated in global memory
+// (only the current block updates them).
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class SampleIterator,
+    class OffsetIterator,
+    class Counter,
+    class SampleToBinOp
+>
+ROCPRIM_DEVICE inline
+void segmented_histogram(SampleIterator samples,
+                         OffsetIterator begin_offsets,
+                         OffsetIterator end_offsets,
+                         Counter * histogram,
+                         SampleToBinOp sample_to_bin_op,
+                         unsigned int bins,
+                         unsigned int histograms,
+                         unsigned int * block_histogram_start)
+{
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int segment_id = ::rocprim::detail::block_id<0>();
+
+    const unsigned int begin = begin_offsets[segment_id];
+    const unsigned int end = end_offsets[segment_id];
+    Counter * segment_histogram = histogram + static_cast<size_t>(segment_id) * bins;
+
+    if(histograms == 0)
+    {
+        for(unsigned int bin = flat_id; bin < bins; bin += BlockSize)
+        {
+            segment_histogram[bin] = 0;
+        }
+        ::rocprim::syncthreads();
+
+        segment_histogram_accumulate<BlockSize, ItemsPerThread>(
+            samples, begin, end, segment_histogram, sample_to_bin_op
+        );
+        return;
+    }
+
+    const unsigned int histogram_stride = get_block_histogram_stride(bins);
+    for(unsigned int bin = flat_id; bin < histogram_stride * histograms; bin += BlockSize)
+    {
+        block_histogram_start[bin] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    segment_histogram_accumulate<BlockSize, ItemsPerThread>(
+        samples, begin, end,
+        block_histogram_start + (flat_id % histograms) * histogram_stride,
+        sample_to_bin_op
+    );
+    ::rocprim::syncthreads();
+
+    // Merge copies
+    for(unsigned int bin = flat_id; bin < bins; bin += BlockSize)
+    {
+        unsigned int count = 0;
+        for(unsigned int h = 0; h < histograms; h++)
+        {
+            count += block_histogram_start[h * histogram_stride + bin];
+        }
+        segment_histogram[bin] = static_cast<Counter>(count);
+    }
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
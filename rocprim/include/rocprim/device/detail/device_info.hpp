@@ -0,0 +1,147 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_INFO_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_INFO_HPP_
+
+#include <type_traits>
+#include <atomic>
+#include <mutex>
+
+#include "../../config.hpp"
+
+#include "../config_types.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Properties of a device which are used by device-level algorithms
+struct device_info
+{
+    // Architecture, for example 803, 900, 906, 908
+    int arch;
+    unsigned int compute_units;
+    size_t shared_memory_per_block;
+    unsigned int warp_size;
+};
+
+// Returns properties of the device. hipGetDeviceProperties is slow (tens of microseconds),
+// so properties are queried only once per device and cached.
+// The cache is thread-safe: readers do not lock after the first query.
+ROCPRIM_HOST inline
+hipError_t get_device_info(const int device_id, device_info& info)
+{
+    constexpr int max_devices = 64;
+    struct cache_entry
+    {
+        std::atomic<bool> ready;
+        device_info info;
+    };
+    // Zero-initialized, i.e. all entries are not ready
+    static cache_entry cache[max_devices];
+    static std::mutex cache_mutex;
+
+    const bool is_cached = device_id >= 0 && device_id < max_devices;
+    if(is_cached && cache[device_id].ready.load(std::memory_order_acquire))
+    {
+        info = cache[device_id].info;
+        return hipSuccess;
+    }
+
+    hipDeviceProp_t prop;
+    hipError_t error = hipGetDeviceProperties(&prop, device_id);
+    if(error != hipSuccess) return error;
+
+    info.arch = prop.gcnArch;
+    info.compute_units = static_cast<unsigned int>(prop.multiProcessorCount);
+    info.shared_memory_per_block = prop.sharedMemPerBlock;
+    info.warp_size = static_cast<unsigned int>(prop.warpSize);
+
+    if(is_cached)
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if(!cache[device_id].ready.load(std::memory_order_relaxed))
+        {
+            cache[device_id].info = info;
+            cache[device_id].ready.store(true, std::memory_order_release);
+        }
+    }
+    return hipSuccess;
+}
+
+// Returns properties of the current device
+ROCPRIM_HOST inline
+hipError_t get_device_info(device_info& info)
+{
+    int device_id;
+    hipError_t error = hipGetDevice(&device_id);
+    if(error != hipSuccess) return error;
+    return get_device_info(device_id, info);
+}
+
+template<unsigned int Arch>
+using target_arch = std::integral_constant<unsigned int, Arch>;
+
+// Calls launch(target_arch<Arch>()) where Arch is the architecture used for selection of default
+// configs (default_*_config<Arch, ...>):
+// * ROCPRIM_TARGET_ARCH if it is specified at compile time or Config is a custom config;
+// * otherwise the family of the current device: 803 for gfx8, 900 for gfx9 and 0 (universal
+//   configs) for other devices.
+// Hence the same binary uses per-arch configs on all devices, and only configs which can be
+// selected are instantiated.
+template<class Config = default_config, class Launch>
+ROCPRIM_HOST inline
+auto with_target_arch(Launch&& launch)
+    -> typename std::enable_if<!std::is_same<Config, default_config>::value, hipError_t>::type
+{
+    return launch(target_arch<ROCPRIM_TARGET_ARCH>());
+}
+
+template<class Config = default_config, class Launch>
+ROCPRIM_HOST inline
+auto with_target_arch(Launch&& launch)
+    -> typename std::enable_if<std::is_same<Config, default_config>::value, hipError_t>::type
+{
+#if ROCPRIM_TARGET_ARCH != 0
+    return launch(target_arch<ROCPRIM_TARGET_ARCH>());
+#else
+    device_info info;
+    hipError_t error = get_device_info(info);
+    if(error != hipSuccess) return error;
+
+    if(info.arch >= 800 && info.arch < 900)
+    {
+        return launch(target_arch<803>());
+    }
+    else if(info.arch >= 900 && info.arch < 1000)
+    {
+        return launch(target_arch<900>());
+    }
+    return launch(target_arch<0>());
+#endif
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_INFO_HPP_
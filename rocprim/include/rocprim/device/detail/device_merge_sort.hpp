@@ -31,294 +31,402 @@
 #include "../../functional.hpp"
 #include "../../types.hpp"
 
-#include "../../block/block_load.hpp"
-#include "../../block/block_sort.hpp"
-#include "../../block/block_store.hpp"
-
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
 {
 
+// Returns how many items of the first range are among the first diag items of
+// the stable merge of [keys_input1, keys_input1 + input1_size) and
+// [keys_input2, keys_input2 + input2_size) (equal items of the first range go first).
 template<
-    bool WithValues,
-    unsigned int BlockSize,
-    class KeysInputIterator,
-    class ValuesInputIterator,
-    class Key,
-    class Value,
-    unsigned int ItemsPerThread
+    class Offset,
+    class KeysInputIterator1,
+    class KeysInputIterator2,
+    class BinaryFunction
 >
 ROCPRIM_DEVICE inline
-typename std::enable_if<!WithValues>::type
-block_load_impl(const unsigned int flat_id,
-                const unsigned int block_offset,
-                const unsigned int valid_in_last_block,
-                const bool last_block,
-                KeysInputIterator keys_input,
-                ValuesInputIterator values_input,
-                Key (&keys)[ItemsPerThread],
-                Value (&values)[ItemsPerThread])
+Offset merge_sort_merge_path(KeysInputIterator1 keys_input1,
+                             KeysInputIterator2 keys_input2,
+                             const Offset input1_size,
+                             const Offset input2_size,
+                             const Offset diag,
+                             BinaryFunction compare_function)
 {
-    (void) values_input;
-    (void) values;
+    using key_type = typename std::iterator_traits<KeysInputIterator1>::value_type;
 
-    if(last_block)
-    {
-        block_load_direct_striped<BlockSize>(
-            flat_id,
-            keys_input + block_offset,
-            keys,
-            valid_in_last_block
-        );
-    }
-    else
+    Offset begin = diag > input2_size ? diag - input2_size : 0;
+    Offset end = ::rocprim::min(diag, input1_size);
+
+    while(begin < end)
     {
-        block_load_direct_striped<BlockSize>(
-            flat_id,
-            keys_input + block_offset,
-            keys
-        );
+        const Offset a = begin + (end - begin) / 2;
+        const Offset b = diag - 1 - a;
+        const key_type input_a = keys_input1[a];
+        const key_type input_b = keys_input2[b];
+        if(!compare_function(input_b, input_a))
+        {
+            begin = a + 1;
+        }
+        else
+        {
+            end = a;
+        }
     }
 
+    return begin;
 }
 
+// Sequentially merges ItemsPerThread items of ranges [begin1, end1) and [begin2, end2)
+// of keys_shared. Positions of merged keys in keys_shared are returned in indices.
+// When both ranges are exhausted, remaining keys and indices are undefined.
+// keys_shared must be readable at end1 and end2.
 template<
-    bool WithValues,
-    unsigned int BlockSize,
-    class KeysInputIterator,
-    class ValuesInputIterator,
+    unsigned int ItemsPerThread,
     class Key,
-    class Value,
-    unsigned int ItemsPerThread
+    class BinaryFunction
 >
 ROCPRIM_DEVICE inline
-typename std::enable_if<WithValues>::type
-block_load_impl(const unsigned int flat_id,
-                const unsigned int block_offset,
-                const unsigned int valid_in_last_block,
-                const bool last_block,
-                KeysInputIterator keys_input,
-                ValuesInputIterator values_input,
-                Key (&keys)[ItemsPerThread],
-                Value (&values)[ItemsPerThread])
+void merge_sort_serial_merge(const Key * keys_shared,
+                             unsigned int begin1,
+                             const unsigned int end1,
+                             unsigned int begin2,
+                             const unsigned int end2,
+                             Key (&keys)[ItemsPerThread],
+                             unsigned int (&indices)[ItemsPerThread],
+                             BinaryFunction compare_function)
 {
-    if(last_block)
-    {
-        block_load_direct_striped<BlockSize>(
-            flat_id,
-            keys_input + block_offset,
-            keys,
-            valid_in_last_block
-        );
+    Key a = keys_shared[begin1];
+    Key b = keys_shared[begin2];
 
-        block_load_direct_striped<BlockSize>(
-            flat_id,
-            values_input + block_offset,
-            values,
-            valid_in_last_block
-        );
-    }
-    else
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
     {
-        block_load_direct_striped<BlockSize>(
-            flat_id,
-            keys_input + block_offset,
-            keys
-        );
-
-        block_load_direct_striped<BlockSize>(
-            flat_id,
-            values_input + block_offset,
-            values
-        );
+        const bool take_first = (begin2 >= end2) ||
+                                ((begin1 < end1) && !compare_function(b, a));
+        keys[i] = take_first ? a : b;
+        indices[i] = take_first ? begin1 : begin2;
+        if(take_first)
+        {
+            begin1++;
+            a = keys_shared[::rocprim::min(begin1, end1)];
+        }
+        else
+        {
+            begin2++;
+            b = keys_shared[::rocprim::min(begin2, end2)];
+        }
     }
 }
 
+// Stable odd-even transposition sort of the first valid items of a thread
 template<
-    bool WithValues,
-    unsigned int BlockSize,
-    class KeysOutputIterator,
-    class ValuesOutputIterator,
+    unsigned int ItemsPerThread,
     class Key,
-    class Value,
-    unsigned int ItemsPerThread
+    class BinaryFunction
 >
 ROCPRIM_DEVICE inline
-typename std::enable_if<!WithValues>::type
-block_store_impl(const unsigned int flat_id,
-                 const unsigned int block_offset,
-                 const unsigned int valid_in_last_block,
-                 const bool last_block,
-                 KeysOutputIterator keys_output,
-                 ValuesOutputIterator values_output,
-                 Key (&keys)[ItemsPerThread],
-                 Value (&values)[ItemsPerThread])
+void merge_sort_thread_sort(Key (&keys)[ItemsPerThread],
+                            unsigned int (&ranks)[ItemsPerThread],
+                            const unsigned int valid,
+                            BinaryFunction compare_function)
 {
-    (void) values_output;
-    (void) values;
-
-    if(last_block)
-    {
-        block_store_direct_striped<BlockSize>(
-            flat_id,
-            keys_output + block_offset,
-            keys,
-            valid_in_last_block
-        );
-    }
-    else
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
     {
-        block_store_direct_striped<BlockSize>(
-            flat_id,
-            keys_output + block_offset,
-            keys
-        );
+        #pragma unroll
+        for(unsigned int j = i & 1; j + 1 < ItemsPerThread; j += 2)
+        {
+            if(j + 1 < valid && compare_function(keys[j + 1], keys[j]))
+            {
+                const Key key = keys[j];
+                keys[j] = keys[j + 1];
+                keys[j + 1] = key;
+                const unsigned int rank = ranks[j];
+                ranks[j] = ranks[j + 1];
+                ranks[j + 1] = rank;
+            }
+        }
     }
 }
 
+template<class Key, unsigned int ItemsPerBlock>
+struct merge_sort_storage
+{
+    // One more key is required by merge_sort_serial_merge
+    typename detail::raw_storage<Key[ItemsPerBlock + 1]> keys;
+    // Ranks of keys when a tile is sorted, positions of merged keys when runs are merged
+    unsigned int indices[ItemsPerBlock];
+    size_t partitions[2];
+};
+
+// Sorts a tile of valid (at most BlockSize * ItemsPerThread) items. Every thread sorts
+// its own items, then sorted runs are merged pairwise in shared memory using merge path
+// until the whole tile is sorted. The sort is stable: ranks (positions in the tile)
+// of keys are tracked and values are scattered to their final positions only once,
+// so the tile can be sorted in place.
+// storage must not be reused before synchronization.
 template<
-    bool WithValues,
     unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class KeysInputIterator,
     class KeysOutputIterator,
+    class ValuesInputIterator,
     class ValuesOutputIterator,
     class Key,
-    class Value,
-    unsigned int ItemsPerThread
+    class BinaryFunction
 >
 ROCPRIM_DEVICE inline
-typename std::enable_if<WithValues>::type
-block_store_impl(const unsigned int flat_id,
-                 const unsigned int block_offset,
-                 const unsigned int valid_in_last_block,
-                 const bool last_block,
-                 KeysOutputIterator keys_output,
-                 ValuesOutputIterator values_output,
-                 Key (&keys)[ItemsPerThread],
-                 Value (&values)[ItemsPerThread])
+void block_sort_tile(KeysInputIterator keys_input,
+                     KeysOutputIterator keys_output,
+                     ValuesInputIterator values_input,
+                     ValuesOutputIterator values_output,
+                     const unsigned int valid,
+                     merge_sort_storage<Key, BlockSize * ItemsPerThread>& storage,
+                     BinaryFunction compare_function)
 {
-    if(last_block)
+    using key_type = Key;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int thread_offset = flat_id * ItemsPerThread;
+
+    key_type * keys_shared = storage.keys.get();
+    unsigned int * ranks_shared = storage.indices;
+
+    value_type values[ItemsPerThread];
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
     {
-        block_store_direct_striped<BlockSize>(
-            flat_id,
-            keys_output + block_offset,
-            keys,
-            valid_in_last_block
-        );
+        const unsigned int index = i * BlockSize + flat_id;
+        if(index < valid)
+        {
+            keys_shared[index] = keys_input[index];
+            if(with_values)
+            {
+                values[i] = values_input[index];
+            }
+        }
+    }
+    ::rocprim::syncthreads();
 
-        block_store_direct_striped<BlockSize>(
-            flat_id,
-            values_output + block_offset,
-            values,
-            valid_in_last_block
-        );
+    key_type keys[ItemsPerThread];
+    unsigned int ranks[ItemsPerThread];
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        if(thread_offset + i < valid)
+        {
+            keys[i] = keys_shared[thread_offset + i];
+        }
+        ranks[i] = thread_offset + i;
     }
-    else
+
+    merge_sort_thread_sort(
+        keys, ranks,
+        valid > thread_offset ? valid - thread_offset : 0,
+        compare_function
+    );
+
+    for(unsigned int width = ItemsPerThread; width < items_per_block; width *= 2)
     {
-        block_store_direct_striped<BlockSize>(
-            flat_id,
-            keys_output + block_offset,
-            keys
+        ::rocprim::syncthreads();
+        #pragma unroll
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(thread_offset + i < valid)
+            {
+                keys_shared[thread_offset + i] = keys[i];
+                ranks_shared[thread_offset + i] = ranks[i];
+            }
+        }
+        ::rocprim::syncthreads();
+
+        // All items of the thread belong to the same pair of runs
+        // because 2 * width is a multiple of ItemsPerThread
+        const unsigned int begin1 =
+            ::rocprim::min((thread_offset / (2 * width)) * (2 * width), valid);
+        const unsigned int end1 = ::rocprim::min(begin1 + width, valid);
+        const unsigned int end2 = ::rocprim::min(end1 + width, valid);
+        const unsigned int diag = ::rocprim::min(thread_offset, valid) - begin1;
+
+        const unsigned int partition = merge_sort_merge_path(
+            keys_shared + begin1, keys_shared + end1,
+            end1 - begin1, end2 - end1,
+            diag, compare_function
         );
 
-        block_store_direct_striped<BlockSize>(
-            flat_id,
-            values_output + block_offset,
-            values
+        unsigned int indices[ItemsPerThread];
+        merge_sort_serial_merge(
+            keys_shared,
+            begin1 + partition, end1,
+            end1 + diag - partition, end2,
+            keys, indices, compare_function
         );
+        #pragma unroll
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(thread_offset + i < valid)
+            {
+                ranks[i] = ranks_shared[indices[i]];
+            }
+        }
+    }
+
+    // Store sorted keys and destinations of items (inverse of ranks)
+    ::rocprim::syncthreads();
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        if(thread_offset + i < valid)
+        {
+            keys_shared[thread_offset + i] = keys[i];
+            ranks_shared[ranks[i]] = thread_offset + i;
+        }
+    }
+    ::rocprim::syncthreads();
+
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const unsigned int index = i * BlockSize + flat_id;
+        if(index < valid)
+        {
+            keys_output[index] = keys_shared[index];
+            if(with_values)
+            {
+                values_output[ranks_shared[index]] = values[i];
+            }
+        }
     }
 }
 
+// Merges sorted runs [keys_input, keys_input + size1) and
+// [keys_input + size1, keys_input + size1 + size2) and produces items
+// [diag_begin, diag_begin + BlockSize * ItemsPerThread) of the merged run. Bounds of
+// the tile in both runs are found by merge path search in global memory, then keys of
+// the tile are staged in shared memory and merged by threads (ItemsPerThread items each).
+// storage must not be reused before synchronization.
 template<
-    bool WithValues,
     unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
     class Key,
-    class Value,
     class BinaryFunction
 >
 ROCPRIM_DEVICE inline
-typename std::enable_if<!WithValues>::type
-block_sort_impl(Key& key,
-                Value& value,
-                const unsigned int valid_in_last_block,
-                const bool last_block,
-                BinaryFunction compare_function)
+void block_merge_tile(KeysInputIterator keys_input,
+                      KeysOutputIterator keys_output,
+                      ValuesInputIterator values_input,
+                      ValuesOutputIterator values_output,
+                      const size_t size1,
+                      const size_t size2,
+                      const size_t diag_begin,
+                      merge_sort_storage<Key, BlockSize * ItemsPerThread>& storage,
+                      BinaryFunction compare_function)
 {
-    using block_sort_type = ::rocprim::block_sort<
-        Key, BlockSize
-    >;
-
-    ROCPRIM_SHARED_MEMORY typename block_sort_type::storage_type storage;
+    using key_type = Key;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
-    (void) value;
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const size_t diag_end =
+        ::rocprim::min(diag_begin + items_per_block, size1 + size2);
 
-    if(last_block)
+    if(flat_id < 2)
     {
-        block_sort_type()
-            .sort(
-                key, // keys_input
-                storage,
-                valid_in_last_block,
-                compare_function
-            );
+        storage.partitions[flat_id] = merge_sort_merge_path(
+            keys_input, keys_input + size1,
+            size1, size2,
+            flat_id == 0 ? diag_begin : diag_end,
+            compare_function
+        );
     }
-    else
+    ::rocprim::syncthreads();
+
+    const size_t partition_begin = storage.partitions[0];
+    const size_t partition_end = storage.partitions[1];
+    const size_t tile_begin1 = partition_begin;
+    const size_t tile_begin2 = size1 + (diag_begin - partition_begin);
+    const unsigned int count1 = partition_end - partition_begin;
+    const unsigned int count = diag_end - diag_begin;
+    const unsigned int thread_offset = flat_id * ItemsPerThread;
+
+    key_type * keys_shared = storage.keys.get();
+    unsigned int * indices_shared = storage.indices;
+
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
     {
-        block_sort_type()
-            .sort(
-                key, // keys_input
-                storage,
-                compare_function
-            );
+        const unsigned int index = i * BlockSize + flat_id;
+        if(index < count1)
+        {
+            keys_shared[index] = keys_input[tile_begin1 + index];
+        }
+        else if(index < count)
+        {
+            keys_shared[index] = keys_input[tile_begin2 + (index - count1)];
+        }
     }
-}
+    ::rocprim::syncthreads();
 
-template<
-    bool WithValues,
-    unsigned int BlockSize,
-    class Key,
-    class Value,
-    class BinaryFunction
->
-ROCPRIM_DEVICE inline
-typename std::enable_if<WithValues>::type
-block_sort_impl(Key& key,
-                Value& value,
-                const unsigned int valid_in_last_block,
-                const bool last_block,
-                BinaryFunction compare_function)
-{
-    using block_sort_type = ::rocprim::block_sort<
-        Key, BlockSize, Value
-    >;
+    const unsigned int diag = ::rocprim::min(thread_offset, count);
+    const unsigned int partition = merge_sort_merge_path(
+        keys_shared, keys_shared + count1,
+        count1, count - count1,
+        diag, compare_function
+    );
 
-    ROCPRIM_SHARED_MEMORY typename block_sort_type::storage_type storage;
+    key_type keys[ItemsPerThread];
+    unsigned int indices[ItemsPerThread];
+    merge_sort_serial_merge(
+        keys_shared,
+        partition, count1,
+        count1 + diag - partition, count,
+        keys, indices, compare_function
+    );
+    ::rocprim::syncthreads();
 
-    if(last_block)
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
     {
-        block_sort_type()
-            .sort(
-                key, // keys_input
-                value, // values_input
-                storage,
-                valid_in_last_block,
-                compare_function
-            );
+        if(thread_offset + i < count)
+        {
+            keys_shared[thread_offset + i] = keys[i];
+            indices_shared[thread_offset + i] = indices[i];
+        }
     }
-    else
+    ::rocprim::syncthreads();
+
+    #pragma unroll
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
     {
-        block_sort_type()
-            .sort(
-                key, // keys_input
-                value, // values_input
-                storage,
-                compare_function
-            );
+        const unsigned int index = i * BlockSize + flat_id;
+        if(index < count)
+        {
+            keys_output[diag_begin + index] = keys_shared[index];
+            if(with_values)
+            {
+                const unsigned int input_index = indices_shared[index];
+                values_output[diag_begin + index] =
+                    input_index < count1
+                        ? values_input[tile_begin1 + input_index]
+                        : values_input[tile_begin2 + (input_index - count1)];
+            }
+        }
     }
 }
 
+// Sorts tiles of BlockSize * ItemsPerThread items
 template<
     unsigned int BlockSize,
+    unsigned int ItemsPerThread,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -334,62 +442,27 @@ void block_sort_kernel_impl(KeysInputIterator keys_input,
                             BinaryFunction compare_function)
 {
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
-    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
-    using stable_key_type = rocprim::tuple<key_type, unsigned int>;
-    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
-    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
-    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
-    const unsigned int block_offset = flat_block_id * BlockSize;
-    const unsigned int number_of_blocks = (input_size + BlockSize - 1)/BlockSize;
-    auto valid_in_last_block = input_size - BlockSize * (number_of_blocks - 1);
-    const bool last_block = flat_block_id == (number_of_blocks - 1);
-
-    key_type key[1];
-    value_type value[1];
-
-    block_load_impl<with_values, BlockSize>(
-        flat_id,
-        block_offset,
-        valid_in_last_block,
-        last_block,
-        keys_input,
-        values_input,
-        key,
-        value
-    );
+    ROCPRIM_SHARED_MEMORY merge_sort_storage<key_type, items_per_block> storage;
 
-    // Special comparison that preserves relative order of equal keys
-    auto stable_compare_function = [compare_function](const stable_key_type& a, const stable_key_type& b) mutable -> bool
-    {
-        const bool ab = compare_function(rocprim::get<0>(a), rocprim::get<0>(b));
-        const bool ba = compare_function(rocprim::get<0>(b), rocprim::get<0>(a));
-        return ab || (!ba && (rocprim::get<1>(a) < rocprim::get<1>(b)));
-    };
-
-    stable_key_type stable_key = rocprim::make_tuple(key[0], flat_id);
-    block_sort_impl<with_values, BlockSize>(
-        stable_key,
-        value[0],
-        valid_in_last_block,
-        last_block,
-        stable_compare_function
-    );
-    key[0] = rocprim::get<0>(stable_key);
-
-    block_store_impl<with_values, BlockSize>(
-        flat_id,
-        block_offset,
-        valid_in_last_block,
-        last_block,
-        keys_output,
-        values_output,
-        key,
-        value
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const size_t block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+    const unsigned int valid =
+        ::rocprim::min(input_size - block_offset, static_cast<size_t>(items_per_block));
+
+    block_sort_tile<BlockSize, ItemsPerThread>(
+        keys_input + block_offset, keys_output + block_offset,
+        values_input + block_offset, values_output + block_offset,
+        valid, storage, compare_function
     );
 }
 
+// Merges pairs of adjacent sorted runs of sorted_size items, every block produces
+// BlockSize * ItemsPerThread items of a merged run
 template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -402,89 +475,39 @@ void block_merge_kernel_impl(KeysInputIterator keys_input,
                              ValuesInputIterator values_input,
                              ValuesOutputIterator values_output,
                              const size_t input_size,
-                             const unsigned int block_size,
+                             const size_t sorted_size,
                              BinaryFunction compare_function)
 {
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
-    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
-    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY merge_sort_storage<key_type, items_per_block> storage;
 
-    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
     const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
-    const unsigned int flat_block_size = ::rocprim::detail::block_size<0>();
-    unsigned int id = (flat_block_id * flat_block_size) + flat_id;
 
-    if (id >= input_size)
+    const size_t merged_size = 2 * sorted_size;
+    const size_t blocks_per_merge = ::rocprim::detail::ceiling_div(
+        merged_size, static_cast<size_t>(items_per_block)
+    );
+    const size_t merge_offset = (flat_block_id / blocks_per_merge) * merged_size;
+    const size_t diag_begin = (flat_block_id % blocks_per_merge) * items_per_block;
+    if(merge_offset >= input_size)
     {
         return;
     }
-
-    key_type key;
-    value_type value;
-
-    key = keys_input[id];
-    if(with_values)
+    const size_t size1 = ::rocprim::min(sorted_size, input_size - merge_offset);
+    const size_t size2 = ::rocprim::min(sorted_size, input_size - merge_offset - size1);
+    if(diag_begin >= size1 + size2)
     {
-        value = values_input[id];
-    }
-
-    const unsigned int block_id = id / block_size;
-    const bool block_id_is_odd = block_id & 1;
-    const unsigned int next_block_id = block_id_is_odd ? block_id - 1 :
-                                                         block_id + 1;
-    const unsigned int block_start = min(block_id * block_size, (unsigned int) input_size);
-    const unsigned int next_block_start = min(next_block_id * block_size, (unsigned int) input_size);
-    const unsigned int next_block_end = min((next_block_id + 1) * block_size, (unsigned int) input_size);
-
-    if(next_block_start == input_size)
-    {
-        keys_output[id] = key;
-        if(with_values)
-        {
-            values_output[id] = value;
-        }
         return;
     }
 
-    unsigned int left_id = next_block_start;
-    unsigned int right_id = next_block_end;
-
-    while(left_id < right_id)
-    {
-        unsigned int mid_id = (left_id + right_id) / 2;
-        key_type mid_key = keys_input[mid_id];
-        bool smaller = compare_function(mid_key, key);
-        left_id = smaller ? mid_id + 1 : left_id;
-        right_id = smaller ? right_id : mid_id;
-    }
-
-    right_id = next_block_end;
-    if(block_id_is_odd && left_id != right_id)
-    {
-        key_type upper_key = keys_input[left_id];
-        while(!compare_function(upper_key, key) &&
-              !compare_function(key, upper_key) &&
-              left_id < right_id)
-        {
-            unsigned int mid_id = (left_id + right_id) / 2;
-            key_type mid_key = keys_input[mid_id];
-            bool equal = !compare_function(mid_key, key) &&
-                         !compare_function(key, mid_key);
-            left_id = equal ? mid_id + 1 : left_id + 1;
-            right_id = equal ? right_id : mid_id;
-            upper_key = keys_input[left_id];
-        }
-    }
-
-    unsigned int offset = 0;
-    offset += id - block_start;
-    offset += left_id - next_block_start;
-    offset += min(block_start, next_block_start);
-    keys_output[offset] = key;
-    if(with_values)
-    {
-        values_output[offset] = value;
-    }
+    block_merge_tile<BlockSize, ItemsPerThread>(
+        keys_input + merge_offset, keys_output + merge_offset,
+        values_input + merge_offset, values_output + merge_offset,
+        size1, size2, diag_begin,
+        storage, compare_function
+    );
 }
 
 } // end of detail namespace
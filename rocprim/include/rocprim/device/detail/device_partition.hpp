@@ -302,8 +302,9 @@ auto partition_scatter(ValueType (&values)[ItemsPerThread],
     for(unsigned int i = 0; i < ItemsPerThread; i++)
     {
         unsigned int item_index = (flat_block_thread_id * ItemsPerThread) + i;
-        unsigned int selected_item_index = output_indices[i] - selected_prefix;
-        unsigned int rejected_item_index = (item_index - selected_item_index) + selected_in_block;
+        unsigned int selected_item_index = static_cast<unsigned int>(output_indices[i] - selected_prefix);
+        unsigned int rejected_item_index =
+            (item_index - selected_item_index) + static_cast<unsigned int>(selected_in_block);
         // index of item in scatter_storage
         unsigned int scatter_index = is_selected[i] ? selected_item_index : rejected_item_index;
         scatter_storage[scatter_index] = values[i];
@@ -315,9 +316,10 @@ auto partition_scatter(ValueType (&values)[ItemsPerThread],
     {
         unsigned int item_index = (i * BlockSize) + flat_block_thread_id;
         unsigned int selected_item_index = item_index;
-        unsigned int rejected_item_index = item_index - selected_in_block;
+        unsigned int rejected_item_index = item_index - static_cast<unsigned int>(selected_in_block);
         // number of values rejected in previous blocks
-        unsigned int rejected_prefix = (flat_block_id * items_per_block) - selected_prefix;
+        OffsetType rejected_prefix =
+            static_cast<OffsetType>(flat_block_id) * items_per_block - selected_prefix;
         // destination index of item scatter_storage[item_index] in output
         OffsetType scatter_index = item_index < selected_in_block
             ? selected_prefix + selected_item_index
@@ -368,7 +370,7 @@ auto partition_scatter(ValueType (&values)[ItemsPerThread],
         #pragma unroll
         for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            unsigned int scatter_index = output_indices[i] - selected_prefix;
+            unsigned int scatter_index = static_cast<unsigned int>(output_indices[i] - selected_prefix);
             if(is_selected[i])
             {
                 scatter_storage[scatter_index] = values[i];
@@ -471,8 +473,9 @@ void partition_kernel_impl(InputIterator input,
 
     const auto flat_block_thread_id = ::rocprim::flat_block_thread_id();
     const auto flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
-    const unsigned int block_offset = flat_block_id * items_per_block;
-    const auto valid_in_last_block = size - items_per_block * (number_of_blocks - 1);
+    const size_t block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+    const unsigned int valid_in_last_block =
+        static_cast<unsigned int>(size - static_cast<size_t>(items_per_block) * (number_of_blocks - 1));
 
     value_type values[items_per_thread];
     bool is_selected[items_per_thread];
@@ -593,6 +596,383 @@ void partition_kernel_impl(InputIterator input,
     }
 }
 
+// Counts of items in every bucket of a multi-way partition. It is the value type of
+// the look-back scan state, so offsets of items in all buckets are calculated in one pass.
+template<class T, unsigned int Buckets>
+struct partition_bucket_counts
+{
+    using value_type = T;
+    static constexpr unsigned int buckets = Buckets;
+
+    T values[Buckets];
+
+    ROCPRIM_HOST_DEVICE inline
+    T& operator[](const unsigned int bucket)
+    {
+        return values[bucket];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    const T& operator[](const unsigned int bucket) const
+    {
+        return values[bucket];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    partition_bucket_counts operator+(const partition_bucket_counts& other) const
+    {
+        partition_bucket_counts result;
+        #pragma unroll
+        for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+        {
+            result.values[bucket] = values[bucket] + other.values[bucket];
+        }
+        return result;
+    }
+};
+
+// Bucket 0 - items for which the first predicate returns true,
+// bucket 1 - items for which only the second predicate returns true,
+// bucket 2 - other items.
+template<class FirstPredicate, class SecondPredicate>
+struct three_way_partition_bucket_op
+{
+    FirstPredicate select_first_part_op;
+    SecondPredicate select_second_part_op;
+
+    template<class T>
+    ROCPRIM_DEVICE inline
+    unsigned int operator()(const T& value)
+    {
+        return select_first_part_op(value) ? 0 : (select_second_part_op(value) ? 1 : 2);
+    }
+};
+
+// Every bucket of a three-way partition has its own output range.
+template<
+    class FirstOutputIterator,
+    class SecondOutputIterator,
+    class UnselectedOutputIterator
+>
+struct three_way_partition_output
+{
+    FirstOutputIterator first_output;
+    SecondOutputIterator second_output;
+    UnselectedOutputIterator unselected_output;
+
+    template<class Offset, class T>
+    ROCPRIM_DEVICE inline
+    void store(const unsigned int bucket, const Offset index, const T& value)
+    {
+        if(bucket == 0)
+        {
+            first_output[index] = value;
+        }
+        else if(bucket == 1)
+        {
+            second_output[index] = value;
+        }
+        else
+        {
+            unselected_output[index] = value;
+        }
+    }
+};
+
+// All buckets of a multi-way partition are stored contiguously in one output range,
+// bucket_offsets are offsets of the first items of buckets.
+template<class OutputIterator, class Offset>
+struct multi_partition_output
+{
+    OutputIterator output;
+    const Offset * bucket_offsets;
+
+    template<class T>
+    ROCPRIM_DEVICE inline
+    void store(const unsigned int bucket, const Offset index, const T& value)
+    {
+        output[bucket_offsets[bucket] + index] = value;
+    }
+};
+
+// Returns the bucket of a value, values greater than or equal to Buckets are clamped to
+// the last bucket (the contract of partition_multi)
+template<unsigned int Buckets, class BucketOp, class T>
+ROCPRIM_DEVICE inline
+unsigned int get_partition_bucket(BucketOp& bucket_op, const T& value)
+{
+    return ::rocprim::min(static_cast<unsigned int>(bucket_op(value)), Buckets - 1);
+}
+
+// Counts items of every bucket, it is used when positions of buckets in the output
+// must be known before the look-back pass (multi_partition_output).
+// bucket_counts must be zeroed before the kernel is launched.
+template<
+    class Config,
+    unsigned int Buckets,
+    class InputIterator,
+    class Offset,
+    class BucketOp
+>
+ROCPRIM_DEVICE inline
+void partition_multi_count_kernel_impl(InputIterator input,
+                                       const size_t size,
+                                       Offset * bucket_counts,
+                                       BucketOp bucket_op)
+{
+    constexpr unsigned int block_size = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    ROCPRIM_SHARED_MEMORY Offset block_counts[Buckets];
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const size_t block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+
+    for(unsigned int bucket = flat_id; bucket < Buckets; bucket += block_size)
+    {
+        block_counts[bucket] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    #pragma unroll
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const size_t index = block_offset + i * block_size + flat_id;
+        if(index < size)
+        {
+            const unsigned int bucket = get_partition_bucket<Buckets>(bucket_op, input[index]);
+            ::rocprim::detail::atomic_add(&block_counts[bucket], Offset(1));
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int bucket = flat_id; bucket < Buckets; bucket += block_size)
+    {
+        if(block_counts[bucket] > 0)
+        {
+            ::rocprim::detail::atomic_add(&bucket_counts[bucket], block_counts[bucket]);
+        }
+    }
+}
+
+// Replaces counts of buckets with offsets of their first items
+template<unsigned int Buckets, class Offset>
+ROCPRIM_DEVICE inline
+void partition_multi_bucket_offsets_kernel_impl(Offset * bucket_counts)
+{
+    if(::rocprim::flat_block_thread_id() == 0)
+    {
+        Offset offset = 0;
+        for(unsigned int bucket = 0; bucket < Buckets; bucket++)
+        {
+            const Offset count = bucket_counts[bucket];
+            bucket_counts[bucket] = offset;
+            offset += count;
+        }
+    }
+}
+
+// Multi-way partition with decoupled look-back.
+//
+// Items are assigned to buckets by bucket_op. Vectors of per-bucket counts
+// (partition_bucket_counts) are scanned, so for every item the exclusive scan gives
+// its index in its bucket, for all buckets in one look-back pass. Items are grouped by
+// buckets in shared memory and stored with (mostly) coalesced writes.
+// The last block stores total counts of the first counts_output_size buckets.
+template<
+    class Config,
+    class InputIterator,
+    class BucketOutput,
+    class CountsOutputIterator,
+    class BucketOp,
+    class CountsLookbackScanState
+>
+ROCPRIM_DEVICE inline
+void partition_multi_kernel_impl(InputIterator input,
+                                 BucketOutput output,
+                                 CountsOutputIterator counts_output,
+                                 const unsigned int counts_output_size,
+                                 const size_t size,
+                                 BucketOp bucket_op,
+                                 CountsLookbackScanState counts_scan_state,
+                                 const unsigned int number_of_blocks,
+                                 ordered_block_id<unsigned int> ordered_bid)
+{
+    constexpr auto block_size = Config::block_size;
+    constexpr auto items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    using counts_type = typename CountsLookbackScanState::value_type;
+    using offset_type = typename counts_type::value_type;
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    constexpr unsigned int buckets = counts_type::buckets;
+
+    // Block primitives
+    using block_load_value_type = ::rocprim::block_load<
+        value_type, block_size, items_per_thread,
+        Config::value_block_load_method
+    >;
+    using block_scan_counts_type = ::rocprim::block_scan<
+        counts_type, block_size,
+        Config::block_scan_method
+    >;
+    using order_bid_type = ordered_block_id<unsigned int>;
+
+    // Counts prefix operation type
+    using counts_scan_prefix_op_type = offset_lookback_scan_prefix_op<
+        counts_type, CountsLookbackScanState
+    >;
+
+    // Memory required for 2-phase scatter
+    using exchange_storage_type = value_type[items_per_block];
+    using raw_exchange_storage_type = typename detail::raw_storage<exchange_storage_type>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        typename counts_scan_prefix_op_type::storage_type prefix_op;
+        // Offsets of buckets in exchange_values
+        offset_type block_bucket_offsets[buckets];
+        union
+        {
+            raw_exchange_storage_type exchange_values;
+            typename block_load_value_type::storage_type load_values;
+            typename block_scan_counts_type::storage_type scan_counts;
+        };
+    } storage;
+
+    const auto flat_block_thread_id = ::rocprim::flat_block_thread_id();
+    const auto flat_block_id = ordered_bid.get(flat_block_thread_id, storage.ordered_bid);
+    const size_t block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+    const bool is_last_block = flat_block_id == (number_of_blocks - 1);
+    const unsigned int valid_count = is_last_block
+        ? static_cast<unsigned int>(size - block_offset)
+        : items_per_block;
+
+    value_type values[items_per_thread];
+    if(is_last_block)
+    {
+        block_load_value_type()
+            .load(input + block_offset, values, valid_count, storage.load_values);
+    }
+    else
+    {
+        block_load_value_type()
+            .load(input + block_offset, values, storage.load_values);
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    // Invalid items get bucket == buckets, they are not counted. Results of bucket_op are
+    // clamped, so every valid item is counted and stored.
+    unsigned int item_buckets[items_per_thread];
+    counts_type item_ranks[items_per_thread];
+    #pragma unroll
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int index = flat_block_thread_id * items_per_thread + i;
+        item_buckets[i] = index < valid_count
+            ? get_partition_bucket<buckets>(bucket_op, values[i])
+            : buckets;
+        #pragma unroll
+        for(unsigned int bucket = 0; bucket < buckets; bucket++)
+        {
+            item_ranks[i][bucket] = item_buckets[i] == bucket ? 1 : 0;
+        }
+    }
+
+    if(flat_block_id == 0)
+    {
+        counts_type zero;
+        #pragma unroll
+        for(unsigned int bucket = 0; bucket < buckets; bucket++)
+        {
+            zero[bucket] = 0;
+        }
+        counts_type reduction;
+        block_scan_counts_type()
+            .exclusive_scan(
+                item_ranks, item_ranks, zero, reduction,
+                storage.scan_counts, ::rocprim::plus<counts_type>()
+            );
+        if(flat_block_thread_id == 0)
+        {
+            counts_scan_state.set_complete(flat_block_id, reduction);
+            storage.prefix_op.block_reduction = reduction;
+            storage.prefix_op.exclusive_prefix = zero;
+        }
+    }
+    // The same workaround as in partition_kernel_impl (Fiji)
+    ::rocprim::syncthreads();
+    if(flat_block_id > 0)
+    {
+        auto prefix_op = counts_scan_prefix_op_type(
+            flat_block_id, counts_scan_state, storage.prefix_op
+        );
+        block_scan_counts_type()
+            .exclusive_scan(
+                item_ranks, item_ranks,
+                storage.scan_counts, prefix_op, ::rocprim::plus<counts_type>()
+            );
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    const counts_type block_prefix = storage.prefix_op.exclusive_prefix;
+    const counts_type block_reduction = storage.prefix_op.block_reduction;
+    if(flat_block_thread_id == 0)
+    {
+        offset_type offset = 0;
+        for(unsigned int bucket = 0; bucket < buckets; bucket++)
+        {
+            storage.block_bucket_offsets[bucket] = offset;
+            offset += block_reduction[bucket];
+        }
+    }
+    ::rocprim::syncthreads();
+
+    // Group values by buckets in shared memory
+    value_type * exchange_values = storage.exchange_values.get();
+    #pragma unroll
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int bucket = item_buckets[i];
+        if(bucket < buckets)
+        {
+            const offset_type rank = item_ranks[i][bucket] - block_prefix[bucket];
+            exchange_values[storage.block_bucket_offsets[bucket] + rank] = values[i];
+        }
+    }
+    ::rocprim::syncthreads();
+
+    #pragma unroll
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int item_index = i * block_size + flat_block_thread_id;
+        if(item_index < valid_count)
+        {
+            // Empty buckets are skipped because their offsets are equal to offsets of next buckets
+            unsigned int bucket = 0;
+            while(bucket + 1 < buckets && item_index >= storage.block_bucket_offsets[bucket + 1])
+            {
+                bucket++;
+            }
+            const offset_type rank = item_index - storage.block_bucket_offsets[bucket];
+            output.store(bucket, block_prefix[bucket] + rank, exchange_values[item_index]);
+        }
+    }
+
+    // Last block in grid stores total counts
+    if(is_last_block && flat_block_thread_id == 0)
+    {
+        for(unsigned int bucket = 0; bucket < counts_output_size; bucket++)
+        {
+            counts_output[bucket] = block_prefix[bucket] + block_reduction[bucket];
+        }
+    }
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
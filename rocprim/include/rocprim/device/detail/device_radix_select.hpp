@@ -0,0 +1,259 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SELECT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SELECT_HPP_
+
+#include <type_traits>
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../detail/radix_sort.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+#include "../../types.hpp"
+
+#include "../../block/block_load_func.hpp"
+#include "../../block/block_scan.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// State of radix select of one item, it is updated on device after every pass.
+// The selected item is the item with (bit key, index) == (key_prefix, index_prefix) when all
+// passes are done.
+template<class BitKey>
+struct radix_select_state
+{
+    // Digits of the bit key of the selected item found so far
+    BitKey key_prefix;
+    // Digits of the index of the selected item among items with the same key
+    size_t index_prefix;
+    // Rank of the selected item among items matching both prefixes
+    size_t rank;
+    // Number of items matching both prefixes
+    size_t count;
+};
+
+// Mask of bits [bit; 8 * sizeof(T))
+template<class T>
+ROCPRIM_HOST_DEVICE inline
+T radix_select_high_bits_mask(unsigned int bit)
+{
+    return bit >= 8 * sizeof(T) ? T(0) : static_cast<T>(~((T(1) << bit) - T(1)));
+}
+
+// Every block initializes one state (the item of rank ranks[block id] is selected)
+// and its digit counts
+template<unsigned int RadixSize, class RanksIterator, class BitKey>
+ROCPRIM_DEVICE inline
+void radix_select_init(radix_select_state<BitKey> * states,
+                       unsigned long long * digit_counts,
+                       RanksIterator ranks,
+                       size_t size)
+{
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int selection = ::rocprim::detail::block_id<0>();
+    if(flat_id == 0)
+    {
+        radix_select_state<BitKey> state;
+        state.key_prefix = 0;
+        state.index_prefix = 0;
+        state.rank = ranks[selection];
+        state.count = size;
+        states[selection] = state;
+    }
+    for(unsigned int digit = flat_id; digit < RadixSize; digit += ::rocprim::flat_block_size())
+    {
+        digit_counts[selection * RadixSize + digit] = 0;
+    }
+}
+
+// Counts digits [bit; bit + current_radix_bits) of items matching prefixes of every state.
+// If ByIndex is false, digits of bit keys are counted (higher bits of keys are compared with
+// key_prefix), otherwise digits of indices of items with bit keys equal to key_prefix.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    unsigned int MaxSelections,
+    bool Descending,
+    bool ByIndex,
+    class KeysInputIterator,
+    class BitKey
+>
+ROCPRIM_DEVICE inline
+void radix_select_digit_counts(KeysInputIterator keys_input,
+                               size_t size,
+                               const radix_select_state<BitKey> * states,
+                               unsigned int selections,
+                               unsigned long long * digit_counts,
+                               unsigned int bit,
+                               unsigned int current_radix_bits)
+{
+    constexpr unsigned int radix_size = 1 << RadixBits;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using key_codec = radix_key_codec<key_type, Descending>;
+    using bit_key_type = typename key_codec::bit_key_type;
+    static_assert(std::is_same<bit_key_type, BitKey>::value, "BitKey must be the bit key type of keys");
+
+    ROCPRIM_SHARED_MEMORY unsigned int block_digit_counts[MaxSelections * radix_size];
+    ROCPRIM_SHARED_MEMORY bit_key_type key_prefixes[MaxSelections];
+    ROCPRIM_SHARED_MEMORY size_t index_prefixes[MaxSelections];
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int radix_mask = (1u << current_radix_bits) - 1;
+
+    for(unsigned int i = flat_id; i < selections * radix_size; i += BlockSize)
+    {
+        block_digit_counts[i] = 0;
+    }
+    if(flat_id < selections)
+    {
+        key_prefixes[flat_id] = states[flat_id].key_prefix;
+        index_prefixes[flat_id] = states[flat_id].index_prefix;
+    }
+    ::rocprim::syncthreads();
+
+    const bit_key_type key_mask = radix_select_high_bits_mask<bit_key_type>(ByIndex ? 0 : bit + current_radix_bits);
+    const size_t index_mask = radix_select_high_bits_mask<size_t>(bit + current_radix_bits);
+
+    // Every block processes several tiles, so the number of global atomics does not depend
+    // on size
+    const size_t tiles = ::rocprim::detail::ceiling_div(size, size_t(items_per_block));
+    for(size_t tile = ::rocprim::detail::block_id<0>(); tile < tiles; tile += ::rocprim::detail::grid_size<0>())
+    {
+        const size_t block_offset = tile * items_per_block;
+        const unsigned int valid_count =
+            static_cast<unsigned int>(::rocprim::min(size - block_offset, size_t(items_per_block)));
+
+        // Order of items is irrelevant, only totals matter
+        key_type keys[ItemsPerThread];
+        block_load_direct_striped<BlockSize>(flat_id, keys_input + block_offset, keys, valid_count);
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int pos = i * BlockSize + flat_id;
+            if(pos < valid_count)
+            {
+                const bit_key_type bit_key = key_codec::encode(keys[i]);
+                const size_t index = block_offset + pos;
+                const unsigned int digit = ByIndex
+                    ? static_cast<unsigned int>(index >> bit) & radix_mask
+                    : static_cast<unsigned int>(bit_key >> bit) & radix_mask;
+                for(unsigned int s = 0; s < selections; s++)
+                {
+                    if((bit_key & key_mask) == key_prefixes[s]
+                        && (!ByIndex || (index & index_mask) == index_prefixes[s]))
+                    {
+                        ::rocprim::detail::atomic_add(&block_digit_counts[s * radix_size + digit], 1u);
+                    }
+                }
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int i = flat_id; i < selections * radix_size; i += BlockSize)
+    {
+        const unsigned int count = block_digit_counts[i];
+        if(count > 0)
+        {
+            ::rocprim::detail::atomic_add(&digit_counts[i], static_cast<unsigned long long>(count));
+        }
+    }
+}
+
+// Finds the digit of the selected item and appends it to the prefix of the state.
+// Every block of 2^RadixBits threads processes one state. Resets digit counts for the next pass.
+template<unsigned int RadixBits, bool ByIndex, class BitKey>
+ROCPRIM_DEVICE inline
+void radix_select_digit(radix_select_state<BitKey> * states,
+                        unsigned long long * digit_counts,
+                        size_t size,
+                        unsigned int bit,
+                        bool last_key_pass)
+{
+    constexpr unsigned int radix_size = 1 << RadixBits;
+
+    using scan_type = ::rocprim::block_scan<unsigned long long, radix_size>;
+
+    ROCPRIM_SHARED_MEMORY typename scan_type::storage_type storage;
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int selection = ::rocprim::detail::block_id<0>();
+
+    radix_select_state<BitKey> * state = states + selection;
+    digit_counts += selection * radix_size;
+
+    const size_t rank = state->rank;
+    const unsigned long long count = digit_counts[flat_id];
+    digit_counts[flat_id] = 0;
+
+    unsigned long long digit_start;
+    scan_type().exclusive_scan(count, digit_start, 0ull, storage);
+
+    if(rank >= digit_start && rank < digit_start + count)
+    {
+        if(ByIndex)
+        {
+            state->index_prefix |= static_cast<size_t>(flat_id) << bit;
+        }
+        else
+        {
+            state->key_prefix |= static_cast<BitKey>(flat_id) << bit;
+        }
+        state->rank = rank - digit_start;
+        state->count = count;
+        if(last_key_pass)
+        {
+            // If all items equal to the selected key precede the selected item, passes over
+            // indices are not needed
+            state->index_prefix = (count == rank - digit_start + 1) ? size - 1 : 0;
+        }
+    }
+}
+
+template<class Key, bool Descending, class OutputIterator, class BitKey>
+ROCPRIM_DEVICE inline
+void radix_select_output(const radix_select_state<BitKey> * states,
+                         OutputIterator output,
+                         unsigned int selections)
+{
+    using key_codec = radix_key_codec<Key, Descending>;
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    if(flat_id < selections)
+    {
+        output[flat_id] = key_codec::decode(states[flat_id].key_prefix);
+    }
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SELECT_HPP_
@@ -39,6 +39,9 @@
 #include "../../block/block_scan.hpp"
 #include "../../block/block_radix_sort.hpp"
 
+#include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
+
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
@@ -194,7 +197,8 @@ template<
     unsigned int RadixBits,
     bool Descending,
     class Key,
-    class Value
+    class Value,
+    class Offset = unsigned int
 >
 struct radix_sort_and_scatter_helper
 {
@@ -234,7 +238,7 @@ struct radix_sort_and_scatter_helper
         unsigned short starts[radix_size];
         unsigned short ends[radix_size];
 
-        unsigned int digit_starts[radix_size];
+        Offset digit_starts[radix_size];
     };
 
     template<
@@ -253,7 +257,7 @@ struct radix_sort_and_scatter_helper
                           unsigned int end_offset,
                           unsigned int bit,
                           unsigned int current_radix_bits,
-                          unsigned int digit_start, // i-th thread must pass i-th digit's value
+                          Offset digit_start, // i-th thread must pass i-th digit's value
                           storage_type& storage)
     {
         const unsigned int radix_mask = (1u << current_radix_bits) - 1;
@@ -351,7 +355,7 @@ struct radix_sort_and_scatter_helper
                 const unsigned int pos = i * BlockSize + flat_id;
                 if(IsFull || (pos < valid_count))
                 {
-                    const unsigned int dst = pos - storage.starts[digit] + storage.digit_starts[digit];
+                    const Offset dst = pos - storage.starts[digit] + storage.digit_starts[digit];
                     keys_output[dst] = key_codec::decode(bit_keys[i]);
                     if(with_values)
                     {
@@ -502,6 +506,37 @@ void scan_digits(unsigned int * digit_counts)
     digit_counts[flat_id] = value;
 }
 
+// Computes global starts of every (chunk, digit) pair when the input is sorted in chunks.
+// The starts are ordered by digit first and by chunk second so that all chunks are
+// scattered into one sorted sequence.
+template<unsigned int RadixBits>
+ROCPRIM_DEVICE inline
+void scan_chunks(const unsigned int * chunk_digit_counts,
+                 size_t * chunk_digit_starts,
+                 unsigned int chunks)
+{
+    constexpr unsigned int radix_size = 1 << RadixBits;
+
+    using scan_type = typename ::rocprim::block_scan<size_t, radix_size>;
+
+    const unsigned int digit = ::rocprim::flat_block_thread_id();
+
+    size_t digit_count = 0;
+    for(unsigned int chunk = 0; chunk < chunks; chunk++)
+    {
+        digit_count += chunk_digit_counts[chunk * radix_size + digit];
+    }
+
+    size_t digit_start;
+    scan_type().exclusive_scan(digit_count, digit_start, 0);
+
+    for(unsigned int chunk = 0; chunk < chunks; chunk++)
+    {
+        chunk_digit_starts[chunk * radix_size + digit] = digit_start;
+        digit_start += chunk_digit_counts[chunk * radix_size + digit];
+    }
+}
+
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
@@ -510,7 +545,8 @@ template<
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
-    class ValuesOutputIterator
+    class ValuesOutputIterator,
+    class Offset
 >
 ROCPRIM_DEVICE inline
 void sort_and_scatter(KeysInputIterator keys_input,
@@ -519,7 +555,7 @@ void sort_and_scatter(KeysInputIterator keys_input,
                       ValuesOutputIterator values_output,
                       unsigned int size,
                       const unsigned int * batch_digit_starts,
-                      const unsigned int * digit_starts,
+                      const Offset * digit_starts,
                       unsigned int bit,
                       unsigned int current_radix_bits,
                       unsigned int blocks_per_full_batch,
@@ -533,7 +569,7 @@ void sort_and_scatter(KeysInputIterator keys_input,
 
     using sort_and_scatter_helper = radix_sort_and_scatter_helper<
         BlockSize, ItemsPerThread, RadixBits, Descending,
-        key_type, value_type
+        key_type, value_type, Offset
     >;
 
     ROCPRIM_SHARED_MEMORY typename sort_and_scatter_helper::storage_type storage;
@@ -555,7 +591,7 @@ void sort_and_scatter(KeysInputIterator keys_input,
     }
     block_offset *= items_per_block;
 
-    unsigned int digit_start = 0;
+    Offset digit_start = 0;
     if(flat_id < radix_size)
     {
         digit_start = digit_starts[flat_id] + batch_digit_starts[batch_id * radix_size + flat_id];
@@ -583,6 +619,413 @@ void sort_and_scatter(KeysInputIterator keys_input,
     }
 }
 
+// Onesweep radix sort was implemented based on:
+// Adinets, A. and Merrill, D. Onesweep: A Faster Least Significant Digit Radix Sort for GPUs.
+// arXiv:2206.01784. 2022.
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    class KeysInputIterator
+>
+ROCPRIM_DEVICE inline
+void onesweep_histograms(KeysInputIterator keys_input,
+                         unsigned int size,
+                         unsigned int * digit_counts,
+                         unsigned int begin_bit,
+                         unsigned int end_bit,
+                         unsigned int blocks_per_full_batch,
+                         unsigned int full_batches)
+{
+    constexpr unsigned int radix_size = 1 << RadixBits;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using key_codec = radix_key_codec<key_type, Descending>;
+    using bit_key_type = typename key_codec::bit_key_type;
+
+    constexpr unsigned int max_places = ::rocprim::detail::ceiling_div<unsigned int>(
+        sizeof(bit_key_type) * 8, RadixBits
+    );
+
+    struct storage_type
+    {
+        unsigned int digit_counts[max_places][radix_size];
+    };
+    ROCPRIM_SHARED_MEMORY storage_type storage;
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int batch_id = ::rocprim::detail::block_id<0>();
+
+    const unsigned int places = ::rocprim::detail::ceiling_div(end_bit - begin_bit, RadixBits);
+
+    for(unsigned int i = flat_id; i < places * radix_size; i += BlockSize)
+    {
+        storage.digit_counts[i / radix_size][i % radix_size] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    unsigned int block_offset;
+    unsigned int blocks_per_batch;
+    if(batch_id < full_batches)
+    {
+        blocks_per_batch = blocks_per_full_batch;
+        block_offset = batch_id * blocks_per_batch;
+    }
+    else
+    {
+        blocks_per_batch = blocks_per_full_batch - 1;
+        block_offset = batch_id * blocks_per_batch + full_batches;
+    }
+    block_offset *= items_per_block;
+    const unsigned int end_offset = ::rocprim::min(size, block_offset + blocks_per_batch * items_per_block);
+
+    for(; block_offset < end_offset; block_offset += items_per_block)
+    {
+        key_type keys[ItemsPerThread];
+        // Use loading into a striped arrangement because an order of items is irrelevant,
+        // only totals matter
+        const unsigned int valid_count = ::rocprim::min(items_per_block, end_offset - block_offset);
+        block_load_direct_striped<BlockSize>(flat_id, keys_input + block_offset, keys, valid_count);
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(i * BlockSize + flat_id < valid_count)
+            {
+                const bit_key_type bit_key = key_codec::encode(keys[i]);
+                for(unsigned int place = 0; place < places; place++)
+                {
+                    const unsigned int bit = begin_bit + place * RadixBits;
+                    const unsigned int current_radix_bits = ::rocprim::min(RadixBits, end_bit - bit);
+                    const unsigned int digit = (bit_key >> bit) & ((1u << current_radix_bits) - 1);
+                    ::rocprim::detail::atomic_add(&storage.digit_counts[place][digit], 1u);
+                }
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int i = flat_id; i < places * radix_size; i += BlockSize)
+    {
+        const unsigned int count = storage.digit_counts[i / radix_size][i % radix_size];
+        if(count > 0)
+        {
+            ::rocprim::detail::atomic_add(&digit_counts[i], count);
+        }
+    }
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    class Key,
+    class Value
+>
+struct radix_sort_onesweep_helper
+{
+    static constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    static constexpr unsigned int radix_size = 1 << RadixBits;
+
+    // Every digit is handled by its own thread (counts, look-back and digit starts)
+    static_assert(
+        BlockSize >= radix_size,
+        "BlockSize of onesweep radix sort must be greater than or equal to 2^RadixBits"
+    );
+
+    using key_type = Key;
+    using value_type = Value;
+
+    using key_codec = radix_key_codec<key_type, Descending>;
+    using bit_key_type = typename key_codec::bit_key_type;
+    using keys_load_type = ::rocprim::block_load<
+        key_type, BlockSize, ItemsPerThread,
+        ::rocprim::block_load_method::block_load_transpose>;
+    using values_load_type = ::rocprim::block_load<
+        value_type, BlockSize, ItemsPerThread,
+        ::rocprim::block_load_method::block_load_transpose>;
+    using sort_type = ::rocprim::block_radix_sort<bit_key_type, BlockSize, ItemsPerThread, value_type>;
+    using discontinuity_type = ::rocprim::block_discontinuity<unsigned int, BlockSize>;
+    using bit_keys_exchange_type = ::rocprim::block_exchange<bit_key_type, BlockSize, ItemsPerThread>;
+    using values_exchange_type = ::rocprim::block_exchange<value_type, BlockSize, ItemsPerThread>;
+    using digits_scan_type = ::rocprim::block_scan<unsigned int, BlockSize>;
+    using ordered_block_id_type = ordered_block_id<unsigned int>;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    struct storage_type
+    {
+        union
+        {
+            typename digits_scan_type::storage_type digits_scan;
+            typename keys_load_type::storage_type keys_load;
+            typename values_load_type::storage_type values_load;
+            typename sort_type::storage_type sort;
+            typename discontinuity_type::storage_type discontinuity;
+            typename bit_keys_exchange_type::storage_type bit_keys_exchange;
+            typename values_exchange_type::storage_type values_exchange;
+        };
+
+        typename ordered_block_id_type::storage_type ordered_bid;
+
+        unsigned short starts[radix_size];
+        unsigned short ends[radix_size];
+
+        unsigned int digit_starts[radix_size];
+    };
+
+    template<
+        class KeysInputIterator,
+        class KeysOutputIterator,
+        class ValuesInputIterator,
+        class ValuesOutputIterator,
+        class LookbackScanState
+    >
+    ROCPRIM_DEVICE inline
+    void sort_and_scatter(KeysInputIterator keys_input,
+                          KeysOutputIterator keys_output,
+                          ValuesInputIterator values_input,
+                          ValuesOutputIterator values_output,
+                          unsigned int size,
+                          const unsigned int * digit_counts,
+                          LookbackScanState lookback_scan_state,
+                          ordered_block_id_type ordered_bid,
+                          LookbackScanState next_lookback_scan_state,
+                          ordered_block_id_type next_ordered_bid,
+                          unsigned int number_of_blocks,
+                          unsigned int bit,
+                          unsigned int current_radix_bits,
+                          storage_type& storage)
+    {
+        const unsigned int radix_mask = (1u << current_radix_bits) - 1;
+
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+        // Blocks must get their ids in the order they start execution, otherwise the look-back
+        // could wait for a block that has not been scheduled yet.
+        const unsigned int block_id = ordered_bid.get(flat_id, storage.ordered_bid);
+
+        // Prepare the look-back state of the next iteration, it is not used by this one
+        if(block_id == 0 && flat_id == 0)
+        {
+            next_ordered_bid.reset();
+        }
+        for(unsigned int i = flat_id; i < radix_size; i += BlockSize)
+        {
+            next_lookback_scan_state.initialize_prefix(block_id * radix_size + i, number_of_blocks * radix_size);
+        }
+
+        // Global starts of digits (exclusive scan of the histogram of the current iteration)
+        unsigned int digit_start = flat_id < radix_size ? digit_counts[flat_id] : 0;
+        digits_scan_type().exclusive_scan(digit_start, digit_start, 0, storage.digits_scan);
+
+        const unsigned int block_offset = block_id * items_per_block;
+        const bool is_full = block_offset + items_per_block <= size;
+
+        key_type keys[ItemsPerThread];
+        value_type values[ItemsPerThread];
+        unsigned int valid_count;
+        ::rocprim::syncthreads();
+        if(is_full)
+        {
+            valid_count = items_per_block;
+            keys_load_type().load(keys_input + block_offset, keys, storage.keys_load);
+            if(with_values)
+            {
+                ::rocprim::syncthreads();
+                values_load_type().load(values_input + block_offset, values, storage.values_load);
+            }
+        }
+        else
+        {
+            valid_count = size - block_offset;
+            // Sort will leave "invalid" (out of size) items at the end of the sorted sequence
+            const key_type out_of_bounds = key_codec::decode(bit_key_type(-1));
+            keys_load_type().load(keys_input + block_offset, keys, valid_count, out_of_bounds, storage.keys_load);
+            if(with_values)
+            {
+                ::rocprim::syncthreads();
+                values_load_type().load(values_input + block_offset, values, valid_count, storage.values_load);
+            }
+        }
+        bit_key_type bit_keys[ItemsPerThread];
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            bit_keys[i] = key_codec::encode(keys[i]);
+        }
+
+        if(flat_id < radix_size)
+        {
+            storage.starts[flat_id] = valid_count;
+            storage.ends[flat_id] = valid_count;
+        }
+
+        ::rocprim::syncthreads();
+        sort_block(sort_type(), bit_keys, values, storage.sort, bit, bit + current_radix_bits);
+
+        unsigned int digits[ItemsPerThread];
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            digits[i] = (bit_keys[i] >> bit) & radix_mask;
+        }
+
+        bool head_flags[ItemsPerThread];
+        bool tail_flags[ItemsPerThread];
+        ::rocprim::not_equal_to<unsigned int> flag_op;
+
+        ::rocprim::syncthreads();
+        discontinuity_type().flag_heads_and_tails(head_flags, tail_flags, digits, flag_op, storage.discontinuity);
+
+        // Fill start and end position of subsequence for every digit
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int digit = digits[i];
+            const unsigned int pos = flat_id * ItemsPerThread + i;
+            if(head_flags[i])
+            {
+                storage.starts[digit] = pos;
+            }
+            if(tail_flags[i])
+            {
+                storage.ends[digit] = pos;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        // Every thread looks back for its own digit: counts of the digit in previous blocks
+        // are accumulated until a block with an inclusive (complete) count is found.
+        if(flat_id < radix_size)
+        {
+            const unsigned int digit = flat_id;
+            const unsigned int start = storage.starts[digit];
+            const unsigned int end = storage.ends[digit];
+            const unsigned int count = start < valid_count
+                ? (::rocprim::min(valid_count - 1, end) - start + 1)
+                : 0;
+
+            unsigned int block_prefix = 0;
+            if(block_id == 0)
+            {
+                lookback_scan_state.set_complete(digit, count);
+            }
+            else
+            {
+                lookback_scan_state.set_partial(block_id * radix_size + digit, count);
+
+                unsigned int previous_block_id = block_id - 1;
+                typename LookbackScanState::flag_type flag;
+                do
+                {
+                    unsigned int previous_count;
+                    lookback_scan_state.get(previous_block_id * radix_size + digit, flag, previous_count);
+                    block_prefix += previous_count;
+                    previous_block_id--;
+                } while(flag != PREFIX_COMPLETE);
+
+                lookback_scan_state.set_complete(block_id * radix_size + digit, block_prefix + count);
+            }
+            storage.digit_starts[digit] = digit_start + block_prefix;
+        }
+
+        // Rearrange to striped arrangement to have faster coalesced writes instead of
+        // scattering of blocked-arranged items
+        bit_keys_exchange_type().blocked_to_striped(bit_keys, bit_keys, storage.bit_keys_exchange);
+        if(with_values)
+        {
+            ::rocprim::syncthreads();
+            values_exchange_type().blocked_to_striped(values, values, storage.values_exchange);
+        }
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int digit = (bit_keys[i] >> bit) & radix_mask;
+            const unsigned int pos = i * BlockSize + flat_id;
+            if(is_full || (pos < valid_count))
+            {
+                const unsigned int dst = pos - storage.starts[digit] + storage.digit_starts[digit];
+                keys_output[dst] = key_codec::decode(bit_keys[i]);
+                if(with_values)
+                {
+                    values_output[dst] = values[i];
+                }
+            }
+        }
+    }
+};
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class LookbackScanState
+>
+ROCPRIM_DEVICE inline
+void onesweep_iteration(KeysInputIterator keys_input,
+                        KeysOutputIterator keys_output,
+                        ValuesInputIterator values_input,
+                        ValuesOutputIterator values_output,
+                        unsigned int size,
+                        const unsigned int * digit_counts,
+                        LookbackScanState lookback_scan_state,
+                        ordered_block_id<unsigned int> ordered_bid,
+                        LookbackScanState next_lookback_scan_state,
+                        ordered_block_id<unsigned int> next_ordered_bid,
+                        unsigned int number_of_blocks,
+                        unsigned int bit,
+                        unsigned int current_radix_bits)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using onesweep_helper = radix_sort_onesweep_helper<
+        BlockSize, ItemsPerThread, RadixBits, Descending,
+        key_type, value_type
+    >;
+
+    ROCPRIM_SHARED_MEMORY typename onesweep_helper::storage_type storage;
+
+    onesweep_helper().sort_and_scatter(
+        keys_input, keys_output, values_input, values_output, size,
+        digit_counts,
+        lookback_scan_state, ordered_bid,
+        next_lookback_scan_state, next_ordered_bid,
+        number_of_blocks,
+        bit, current_radix_bits,
+        storage
+    );
+}
+
+template<class LookbackScanState>
+ROCPRIM_DEVICE inline
+void onesweep_init(unsigned int * digit_counts,
+                   unsigned int digit_counts_size,
+                   LookbackScanState lookback_scan_state,
+                   unsigned int lookback_scan_state_size,
+                   ordered_block_id<unsigned int> ordered_bid)
+{
+    const unsigned int block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int block_size = ::rocprim::detail::block_size<0>();
+    const unsigned int block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int id = (block_id * block_size) + block_thread_id;
+
+    if(id == 0)
+    {
+        ordered_bid.reset();
+    }
+    if(id < digit_counts_size)
+    {
+        digit_counts[id] = 0;
+    }
+    lookback_scan_state.initialize_prefix(id, lookback_scan_state_size);
+}
+
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
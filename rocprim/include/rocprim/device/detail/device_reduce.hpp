@@ -34,6 +34,8 @@
 #include "../../block/block_load.hpp"
 #include "../../block/block_reduce.hpp"
 
+#include "ordered_block_id.hpp"
+
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
@@ -164,6 +166,225 @@ void block_reduce_kernel_impl(InputIterator input,
     }
 }
 
+// Reduces all items assigned to the block in the grid-stride loop: full tiles
+// block_id, block_id + grid_size, ... and the last incomplete tile (if any).
+// Returns the number of threads that hold valid values.
+template<
+    class Config,
+    class ResultType,
+    class InputIterator,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE inline
+unsigned int grid_stride_thread_reduce(InputIterator input,
+                                       const size_t input_size,
+                                       ResultType& thread_value,
+                                       BinaryFunction reduce_op)
+{
+    constexpr unsigned int block_size = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+
+    const size_t full_tiles = input_size / items_per_block;
+    const unsigned int valid_in_last_tile = input_size - full_tiles * items_per_block;
+
+    ResultType values[items_per_thread];
+    unsigned int valid_threads = block_size;
+    size_t tile = flat_block_id;
+    if(tile < full_tiles)
+    {
+        block_load_direct_striped<block_size>(
+            flat_id,
+            input + tile * items_per_block,
+            values
+        );
+        thread_value = values[0];
+        #pragma unroll
+        for(unsigned int i = 1; i < items_per_thread; i++)
+        {
+            thread_value = reduce_op(thread_value, values[i]);
+        }
+
+        for(tile += number_of_blocks; tile < full_tiles; tile += number_of_blocks)
+        {
+            block_load_direct_striped<block_size>(
+                flat_id,
+                input + tile * items_per_block,
+                values
+            );
+            #pragma unroll
+            for(unsigned int i = 0; i < items_per_thread; i++)
+            {
+                thread_value = reduce_op(thread_value, values[i]);
+            }
+        }
+    }
+
+    if(tile == full_tiles && valid_in_last_tile > 0)
+    {
+        block_load_direct_striped<block_size>(
+            flat_id,
+            input + tile * items_per_block,
+            values,
+            valid_in_last_tile
+        );
+        // The block has not reduced any full tiles, so some threads may have no items at all
+        const bool has_value = flat_block_id < full_tiles;
+        if(!has_value)
+        {
+            thread_value = values[0];
+            valid_threads = ::rocprim::min(valid_in_last_tile, block_size);
+        }
+        #pragma unroll
+        for(unsigned int i = has_value ? 0 : 1; i < items_per_thread; i++)
+        {
+            if(flat_id + i * block_size < valid_in_last_tile)
+            {
+                thread_value = reduce_op(thread_value, values[i]);
+            }
+        }
+    }
+    return valid_threads;
+}
+
+// Single-launch reduction: persistent blocks reduce tiles in a grid-stride loop and
+// store partial results, the last block to finish (determined by an atomic ticket)
+// reduces partial results of all blocks in order and stores the final value.
+// The grid size must not be greater than the number of tiles (so every block has
+// at least one tile), the ticket counter must be zero before the launch.
+template<
+    bool WithInitialValue,
+    class Config,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE inline
+void grid_stride_reduce_kernel_impl(InputIterator input,
+                                    const size_t input_size,
+                                    OutputIterator output,
+                                    ResultType * block_results,
+                                    ordered_block_id<unsigned int> finished_blocks,
+                                    InitValueType initial_value,
+                                    BinaryFunction reduce_op)
+{
+    constexpr unsigned int block_size = Config::block_size;
+
+    using result_type = ResultType;
+
+    using block_reduce_type = ::rocprim::block_reduce<
+        result_type, block_size,
+        Config::block_reduce_method
+    >;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_reduce_type::storage_type reduce;
+        typename ordered_block_id<unsigned int>::storage_type finished_blocks;
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+
+    result_type thread_value;
+    const unsigned int valid_threads =
+        grid_stride_thread_reduce<Config>(input, input_size, thread_value, reduce_op);
+
+    result_type block_value;
+    block_reduce_type().reduce(thread_value, block_value, valid_threads, storage.reduce, reduce_op);
+
+    if(flat_id == 0)
+    {
+        block_results[flat_block_id] = block_value;
+        // Make the partial result visible to the last block before taking a ticket
+        ::rocprim::detail::memory_fence_device();
+    }
+    ::rocprim::syncthreads();
+
+    const unsigned int ticket = finished_blocks.get(flat_id, storage.finished_blocks);
+    if(ticket != number_of_blocks - 1)
+    {
+        return;
+    }
+    ::rocprim::detail::memory_fence_device();
+
+    // The last block: partial results are reduced in the order of blocks, so the result
+    // does not depend on the order in which blocks finish
+    thread_value = block_results[flat_id < number_of_blocks ? flat_id : 0];
+    for(unsigned int i = flat_id + block_size; i < number_of_blocks; i += block_size)
+    {
+        thread_value = reduce_op(thread_value, block_results[i]);
+    }
+    ::rocprim::syncthreads();
+    block_reduce_type().reduce(
+        thread_value, block_value,
+        ::rocprim::min(number_of_blocks, block_size),
+        storage.reduce, reduce_op
+    );
+
+    if(flat_id == 0)
+    {
+        output[0] = reduce_with_initial<WithInitialValue>(
+            block_value,
+            static_cast<result_type>(initial_value),
+            reduce_op
+        );
+        // Reset the ticket counter, so the temporary storage can be reused
+        finished_blocks.reset();
+    }
+}
+
+// Converts an input value to a tuple of values of all reductions of multi_reduce
+template<class ResultTuple>
+struct multi_reduce_broadcast_op;
+
+template<class... Results>
+struct multi_reduce_broadcast_op<::rocprim::tuple<Results...>>
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline
+    ::rocprim::tuple<Results...> operator()(const T& value) const
+    {
+        return ::rocprim::tuple<Results...>(static_cast<Results>(value)...);
+    }
+};
+
+// Applies every reduction operator to the corresponding elements of tuples
+template<class... BinaryFunctions>
+struct multi_reduce_op
+{
+    ::rocprim::tuple<BinaryFunctions...> reduce_ops;
+
+    template<class... Results>
+    ROCPRIM_HOST_DEVICE inline
+    ::rocprim::tuple<Results...> operator()(const ::rocprim::tuple<Results...>& a,
+                                            const ::rocprim::tuple<Results...>& b) const
+    {
+        return apply(a, b, ::rocprim::index_sequence_for<Results...>());
+    }
+
+private:
+    template<class... Results, size_t... Indices>
+    ROCPRIM_HOST_DEVICE inline
+    ::rocprim::tuple<Results...> apply(const ::rocprim::tuple<Results...>& a,
+                                       const ::rocprim::tuple<Results...>& b,
+                                       ::rocprim::index_sequence<Indices...>) const
+    {
+        return ::rocprim::tuple<Results...>(
+            static_cast<Results>(
+                ::rocprim::get<Indices>(reduce_ops)(::rocprim::get<Indices>(a), ::rocprim::get<Indices>(b))
+            )...
+        );
+    }
+};
+
 // Returns size of temporary storage in bytes.
 template<class T>
 size_t reduce_get_temporary_storage_bytes(size_t input_size,
@@ -0,0 +1,234 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_ENCODE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_ENCODE_HPP_
+
+#include <type_traits>
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+
+#include "../../block/block_discontinuity.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_scan.hpp"
+
+#include "device_reduce_by_key.hpp"
+#include "device_scan_lookback.hpp"
+#include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Single-pass encoding of non-trivial runs.
+//
+// Every block flags heads and tails of runs in its tile. Heads of non-trivial runs (heads which
+// are not tails at the same time) are scanned with decoupled look-back as pairs
+// (number of non-trivial runs, offset of the last non-trivial run) using scan_by_key_op, so
+// for every item the inclusive scan gives the index of the current non-trivial run and
+// the offset of its first item, even if the run has started in one of the previous blocks:
+// input:
+//   keys          | 1 1 1 2 3 3 4 4 |
+//   heads         | +     + +   +   |
+//   tails         |     + + +   + + |
+//   pair keys     | 1 0 0 0 1 0 0 0 |
+//   pair values   | 0 0 0 0 4 0 0 0 |
+// result:
+//   scan keys     | 1 1 1 1 2 2 2 2 |
+//   scan values   | 0 0 0 0 4 4 4 4 |
+// Both the offset and the count of a non-trivial run are stored by its tail.
+template<
+    class Config,
+    class InputIterator,
+    class OffsetsOutputIterator,
+    class CountsOutputIterator,
+    class RunsCountOutputIterator,
+    class EqualityOp,
+    class LookbackScanState
+>
+ROCPRIM_DEVICE inline
+void non_trivial_runs_kernel_impl(InputIterator input,
+                                  const unsigned int size,
+                                  OffsetsOutputIterator offsets_output,
+                                  CountsOutputIterator counts_output,
+                                  RunsCountOutputIterator runs_count_output,
+                                  EqualityOp equality_op,
+                                  LookbackScanState scan_state,
+                                  const unsigned int number_of_blocks,
+                                  ordered_block_id<unsigned int> ordered_bid)
+{
+    constexpr unsigned int block_size = Config::block_size;
+    constexpr unsigned int items_per_thread = Config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using pair_type = typename LookbackScanState::value_type;
+    using scan_op_type = scan_by_key_op<pair_type, ::rocprim::plus<unsigned int>>;
+
+    using block_load_type = ::rocprim::block_load<
+        input_type, block_size, items_per_thread,
+        Config::value_block_load_method
+    >;
+    using block_discontinuity_type = ::rocprim::block_discontinuity<input_type, block_size>;
+    using block_scan_type = ::rocprim::block_scan<
+        pair_type, block_size,
+        Config::block_scan_method
+    >;
+    using prefix_op_type = lookback_scan_prefix_op<pair_type, scan_op_type, LookbackScanState>;
+    using order_bid_type = ordered_block_id<unsigned int>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename order_bid_type::storage_type ordered_bid;
+        union
+        {
+            typename block_load_type::storage_type load;
+            typename block_discontinuity_type::storage_type discontinuity;
+            typename block_scan_type::storage_type scan;
+        };
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int flat_block_id = ordered_bid.get(flat_id, storage.ordered_bid);
+    const unsigned int block_offset = flat_block_id * items_per_block;
+    const bool is_first_block = flat_block_id == 0;
+    const bool is_last_block = flat_block_id == (number_of_blocks - 1);
+    const unsigned int valid_count = is_last_block ? size - block_offset : items_per_block;
+
+    input_type values[items_per_thread];
+    if(is_last_block)
+    {
+        block_load_type().load(input + block_offset, values, valid_count, storage.load);
+    }
+    else
+    {
+        block_load_type().load(input + block_offset, values, storage.load);
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    bool head_flags[items_per_thread];
+    bool tail_flags[items_per_thread];
+    // Items of the previous and the next tiles are read only by the first and the last threads
+    input_type predecessor = values[0];
+    input_type successor = values[items_per_thread - 1];
+    if(!is_first_block && flat_id == 0)
+    {
+        predecessor = input[block_offset - 1];
+    }
+    if(!is_last_block && flat_id == block_size - 1)
+    {
+        successor = input[block_offset + items_per_block];
+    }
+    if(is_last_block)
+    {
+        // The last valid item is a tail, items after it are never used
+        const auto flag_op = guarded_key_flag_op<input_type, EqualityOp>(equality_op, valid_count);
+        if(is_first_block)
+        {
+            block_discontinuity_type().flag_heads_and_tails(
+                head_flags, tail_flags, successor, values, flag_op, storage.discontinuity
+            );
+        }
+        else
+        {
+            block_discontinuity_type().flag_heads_and_tails(
+                head_flags, predecessor, tail_flags, successor, values, flag_op, storage.discontinuity
+            );
+        }
+    }
+    else
+    {
+        const auto flag_op = key_flag_op<input_type, EqualityOp>(equality_op);
+        if(is_first_block)
+        {
+            block_discontinuity_type().flag_heads_and_tails(
+                head_flags, tail_flags, successor, values, flag_op, storage.discontinuity
+            );
+        }
+        else
+        {
+            block_discontinuity_type().flag_heads_and_tails(
+                head_flags, predecessor, tail_flags, successor, values, flag_op, storage.discontinuity
+            );
+        }
+    }
+    ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+    pair_type pairs[items_per_thread];
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int index = flat_id * items_per_thread + i;
+        const bool is_valid = index < valid_count;
+        pairs[i].key = (is_valid && head_flags[i] && !tail_flags[i]) ? 1 : 0;
+        pairs[i].value = pairs[i].key != 0 ? block_offset + index : 0;
+        // Trivial runs and invalid items are ignored
+        tail_flags[i] = is_valid && tail_flags[i] && !head_flags[i];
+    }
+
+    scan_op_type scan_op = scan_op_type(::rocprim::plus<unsigned int>());
+    if(is_first_block)
+    {
+        pair_type reduction;
+        block_scan_type().inclusive_scan(pairs, pairs, reduction, storage.scan, scan_op);
+        if(flat_id == 0)
+        {
+            scan_state.set_complete(flat_block_id, reduction);
+        }
+    }
+    // The same workaround as in partition_kernel_impl (Fiji)
+    ::rocprim::syncthreads();
+    if(!is_first_block)
+    {
+        auto prefix_op = prefix_op_type(flat_block_id, scan_op, scan_state);
+        block_scan_type().inclusive_scan(pairs, pairs, storage.scan, prefix_op, scan_op);
+    }
+
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int index = block_offset + flat_id * items_per_thread + i;
+        const unsigned int run_id = pairs[i].key - 1;
+        if(tail_flags[i])
+        {
+            // pairs[i].value is the offset of the head of the current run
+            offsets_output[run_id] = pairs[i].value;
+            counts_output[run_id] = index - pairs[i].value + 1;
+        }
+    }
+
+    // The last thread of the last block stores the total number of non-trivial runs,
+    // invalid items do not change it
+    if(is_last_block && flat_id == block_size - 1)
+    {
+        runs_count_output[0] = pairs[items_per_thread - 1].key;
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_ENCODE_HPP_
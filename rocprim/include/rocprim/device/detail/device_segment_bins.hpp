@@ -0,0 +1,236 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENT_BINS_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENT_BINS_HPP_
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../types.hpp"
+#include "../../iterator/zip_iterator.hpp"
+
+#include "../device_partition.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Size-binned dispatch of segmented sorts: segments are partitioned by their lengths into
+// short (sorted by logical warps), medium (sorted by blocks) and long segments (sorted one by one
+// by device-wide sorts).
+
+template<class Offset>
+struct segment_longer_than
+{
+    unsigned int length;
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const ::rocprim::tuple<Offset, Offset>& segment) const
+    {
+        return static_cast<size_t>(::rocprim::get<1>(segment) - ::rocprim::get<0>(segment))
+            > static_cast<size_t>(length);
+    }
+};
+
+// Ranges of offsets of segments in bins, they point to temporary storage
+template<class Offset>
+struct segment_bins
+{
+    unsigned int short_segments;
+    unsigned int medium_segments;
+    unsigned int long_segments;
+
+    Offset * short_begin_offsets;
+    Offset * short_end_offsets;
+    Offset * medium_begin_offsets;
+    Offset * medium_end_offsets;
+    Offset * long_begin_offsets;
+    Offset * long_end_offsets;
+};
+
+// Segments with at most short_length items are short, segments with more than long_length
+// items are long. Returns the required size of temporary_storage in storage_size if
+// temporary_storage is a null pointer. Numbers of segments in bins are copied to the host,
+// so the function synchronizes the stream.
+template<class OffsetIterator>
+inline
+hipError_t partition_segment_bins(void * temporary_storage,
+                                  size_t& storage_size,
+                                  unsigned int segments,
+                                  OffsetIterator begin_offsets,
+                                  OffsetIterator end_offsets,
+                                  unsigned int short_length,
+                                  unsigned int long_length,
+                                  segment_bins<typename std::iterator_traits<OffsetIterator>::value_type>& bins,
+                                  hipStream_t stream,
+                                  bool debug_synchronous)
+{
+    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+
+    const auto segments_input = ::rocprim::make_zip_iterator(::rocprim::make_tuple(begin_offsets, end_offsets));
+    offset_type * ranges[4] = { };
+    size_t partition_bytes[2];
+    hipError_t error = ::rocprim::partition(
+        nullptr, partition_bytes[0],
+        segments_input,
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(ranges[0], ranges[1])),
+        static_cast<unsigned int *>(nullptr),
+        segments,
+        segment_longer_than<offset_type> { short_length },
+        stream
+    );
+    if(error != hipSuccess) return error;
+    error = ::rocprim::partition(
+        nullptr, partition_bytes[1],
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(ranges[0], ranges[1])),
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(ranges[2], ranges[3])),
+        static_cast<unsigned int *>(nullptr),
+        segments,
+        segment_longer_than<offset_type> { long_length },
+        stream
+    );
+    if(error != hipSuccess) return error;
+
+    const size_t partition_storage_bytes =
+        ::rocprim::detail::align_size(std::max(partition_bytes[0], partition_bytes[1]));
+    const size_t ranges_bytes = ::rocprim::detail::align_size(segments * sizeof(offset_type));
+    const size_t counts_bytes = ::rocprim::detail::align_size(2 * sizeof(unsigned int));
+    if(temporary_storage == nullptr)
+    {
+        storage_size = partition_storage_bytes + 4 * ranges_bytes + counts_bytes;
+        return hipSuccess;
+    }
+
+    char * ptr = reinterpret_cast<char *>(temporary_storage);
+    void * partition_storage = ptr;
+    ptr += partition_storage_bytes;
+    for(unsigned int i = 0; i < 4; i++)
+    {
+        ranges[i] = reinterpret_cast<offset_type *>(ptr);
+        ptr += ranges_bytes;
+    }
+    unsigned int * counts = reinterpret_cast<unsigned int *>(ptr);
+
+    // Segments that are not short are moved to the beginning of ranges[0..1],
+    // short segments to the end
+    error = ::rocprim::partition(
+        partition_storage, partition_bytes[0],
+        segments_input,
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(ranges[0], ranges[1])),
+        counts,
+        segments,
+        segment_longer_than<offset_type> { short_length },
+        stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+    unsigned int not_short_segments;
+    error = hipMemcpyAsync(&not_short_segments, counts, sizeof(unsigned int), hipMemcpyDeviceToHost, stream);
+    if(error != hipSuccess) return error;
+    error = hipStreamSynchronize(stream);
+    if(error != hipSuccess) return error;
+
+    // Long segments are moved to the beginning of ranges[2..3], medium segments to the end
+    error = ::rocprim::partition(
+        partition_storage, partition_bytes[1],
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(ranges[0], ranges[1])),
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(ranges[2], ranges[3])),
+        counts + 1,
+        not_short_segments,
+        segment_longer_than<offset_type> { long_length },
+        stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+    unsigned int long_segments;
+    error = hipMemcpyAsync(&long_segments, counts + 1, sizeof(unsigned int), hipMemcpyDeviceToHost, stream);
+    if(error != hipSuccess) return error;
+    error = hipStreamSynchronize(stream);
+    if(error != hipSuccess) return error;
+
+    bins.short_segments = segments - not_short_segments;
+    bins.medium_segments = not_short_segments - long_segments;
+    bins.long_segments = long_segments;
+    bins.short_begin_offsets = ranges[0] + not_short_segments;
+    bins.short_end_offsets = ranges[1] + not_short_segments;
+    bins.medium_begin_offsets = ranges[2] + long_segments;
+    bins.medium_end_offsets = ranges[3] + long_segments;
+    bins.long_begin_offsets = ranges[2];
+    bins.long_end_offsets = ranges[3];
+
+    if(debug_synchronous)
+    {
+        std::cout << "short_segments " << bins.short_segments << '\n';
+        std::cout << "medium_segments " << bins.medium_segments << '\n';
+        std::cout << "long_segments " << bins.long_segments << '\n';
+    }
+
+    return hipSuccess;
+}
+
+// Calls sort_segment(begin_offset, segment_size) for every long segment, both arguments
+// are size_t. Offsets of long segments are copied to the host, so the function synchronizes
+// the stream.
+template<class Offset, class SortSegment>
+inline
+hipError_t for_each_long_segment(const segment_bins<Offset>& bins,
+                                 SortSegment sort_segment,
+                                 hipStream_t stream)
+{
+    if(bins.long_segments == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::vector<Offset> begin_offsets(bins.long_segments);
+    std::vector<Offset> end_offsets(bins.long_segments);
+    hipError_t error = hipMemcpyAsync(
+        begin_offsets.data(), bins.long_begin_offsets, bins.long_segments * sizeof(Offset),
+        hipMemcpyDeviceToHost, stream
+    );
+    if(error != hipSuccess) return error;
+    error = hipMemcpyAsync(
+        end_offsets.data(), bins.long_end_offsets, bins.long_segments * sizeof(Offset),
+        hipMemcpyDeviceToHost, stream
+    );
+    if(error != hipSuccess) return error;
+    error = hipStreamSynchronize(stream);
+    if(error != hipSuccess) return error;
+
+    for(unsigned int segment = 0; segment < bins.long_segments; segment++)
+    {
+        const size_t begin_offset = static_cast<size_t>(begin_offsets[segment]);
+        const size_t segment_size = static_cast<size_t>(end_offsets[segment] - begin_offsets[segment]);
+        error = sort_segment(begin_offset, segment_size);
+        if(error != hipSuccess) return error;
+    }
+    return hipSuccess;
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENT_BINS_HPP_
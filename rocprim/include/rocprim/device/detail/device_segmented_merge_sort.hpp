@@ -0,0 +1,245 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+
+#include <type_traits>
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+#include "../../types.hpp"
+
+#include "../../warp/warp_sort.hpp"
+
+#include "device_merge_sort.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<unsigned int LogicalWarpSize, class Value>
+ROCPRIM_DEVICE inline
+Value segmented_merge_sort_shuffle_value(const Value& value, const unsigned int src_lane)
+{
+    return ::rocprim::warp_shuffle(value, src_lane, LogicalWarpSize);
+}
+
+template<unsigned int LogicalWarpSize>
+ROCPRIM_DEVICE inline
+empty_type segmented_merge_sort_shuffle_value(const empty_type& value, const unsigned int src_lane)
+{
+    (void) src_lane;
+    return value;
+}
+
+// Every logical warp sorts one segment of at most LogicalWarpSize items
+template<
+    unsigned int LogicalWarpSize,
+    unsigned int BlockSize,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE inline
+void segmented_merge_sort_warp(KeysInputIterator keys_input,
+                               KeysOutputIterator keys_output,
+                               ValuesInputIterator values_input,
+                               ValuesOutputIterator values_output,
+                               unsigned int segments,
+                               OffsetIterator begin_offsets,
+                               OffsetIterator end_offsets,
+                               BinaryFunction compare_function)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+    using stable_key_type = ::rocprim::tuple<key_type, unsigned int>;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    constexpr unsigned int warps_per_block = BlockSize / LogicalWarpSize;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int lane = flat_id % LogicalWarpSize;
+    const unsigned int segment_id =
+        ::rocprim::detail::block_id<0>() * warps_per_block + flat_id / LogicalWarpSize;
+
+    // All lanes take part in the warp sort, even if the logical warp has no segment
+    offset_type begin_offset = 0;
+    unsigned int length = 0;
+    if(segment_id < segments)
+    {
+        begin_offset = begin_offsets[segment_id];
+        length = end_offsets[segment_id] - begin_offset;
+    }
+
+    stable_key_type key;
+    ::rocprim::get<1>(key) = lane;
+    value_type value;
+    if(lane < length)
+    {
+        ::rocprim::get<0>(key) = keys_input[begin_offset + lane];
+        if(with_values)
+        {
+            value = values_input[begin_offset + lane];
+        }
+    }
+
+    // Special comparison that preserves relative order of equal keys and moves
+    // items beyond the end of the segment to the end
+    auto stable_compare_function =
+        [compare_function, length](const stable_key_type& a, const stable_key_type& b) mutable -> bool
+        {
+            const unsigned int index_a = ::rocprim::get<1>(a);
+            const unsigned int index_b = ::rocprim::get<1>(b);
+            if(index_a >= length || index_b >= length)
+            {
+                return index_a < index_b;
+            }
+            const bool ab = compare_function(::rocprim::get<0>(a), ::rocprim::get<0>(b));
+            const bool ba = compare_function(::rocprim::get<0>(b), ::rocprim::get<0>(a));
+            return ab || (!ba && (index_a < index_b));
+        };
+
+    ::rocprim::warp_sort<stable_key_type, LogicalWarpSize>().sort(key, stable_compare_function);
+    value = segmented_merge_sort_shuffle_value<LogicalWarpSize>(value, ::rocprim::get<1>(key));
+
+    if(lane < length)
+    {
+        keys_output[begin_offset + lane] = ::rocprim::get<0>(key);
+        if(with_values)
+        {
+            values_output[begin_offset + lane] = value;
+        }
+    }
+}
+
+// Every block sorts one segment: tiles of BlockSize * ItemsPerThread items are sorted,
+// then sorted runs are merged pairwise (tile by tile) until the whole segment is sorted.
+// Merge passes ping-pong between the output and the buffer, tiles are sorted to the buffer
+// if the number of passes is odd so the last pass writes to the output.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE inline
+void segmented_merge_sort_block(KeysInputIterator keys_input,
+                                typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                ValuesOutputIterator values_output,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                BinaryFunction compare_function)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY merge_sort_storage<key_type, items_per_block> storage;
+
+    const unsigned int segment_id = ::rocprim::detail::block_id<0>();
+    const offset_type begin_offset = begin_offsets[segment_id];
+    const unsigned int length = end_offsets[segment_id] - begin_offset;
+
+    unsigned int merge_passes = 0;
+    for(unsigned int sorted_size = items_per_block; sorted_size < length; sorted_size *= 2)
+    {
+        merge_passes++;
+    }
+    bool from_tmp = merge_passes % 2 == 1;
+
+    for(unsigned int tile_offset = 0; tile_offset < length; tile_offset += items_per_block)
+    {
+        const unsigned int offset = begin_offset + tile_offset;
+        const unsigned int valid = ::rocprim::min(length - tile_offset, items_per_block);
+        if(from_tmp)
+        {
+            block_sort_tile<BlockSize, ItemsPerThread>(
+                keys_input + offset, keys_tmp + offset,
+                values_input + offset, values_tmp + offset,
+                valid, storage, compare_function
+            );
+        }
+        else
+        {
+            block_sort_tile<BlockSize, ItemsPerThread>(
+                keys_input + offset, keys_output + offset,
+                values_input + offset, values_output + offset,
+                valid, storage, compare_function
+            );
+        }
+        ::rocprim::syncthreads();
+    }
+
+    for(unsigned int sorted_size = items_per_block; sorted_size < length; sorted_size *= 2)
+    {
+        for(unsigned int merge_offset = 0; merge_offset < length; merge_offset += 2 * sorted_size)
+        {
+            const unsigned int offset = begin_offset + merge_offset;
+            const unsigned int size1 = ::rocprim::min(sorted_size, length - merge_offset);
+            const unsigned int size2 = ::rocprim::min(sorted_size, length - merge_offset - size1);
+            for(unsigned int diag = 0; diag < size1 + size2; diag += items_per_block)
+            {
+                if(from_tmp)
+                {
+                    block_merge_tile<BlockSize, ItemsPerThread>(
+                        keys_tmp + offset, keys_output + offset,
+                        values_tmp + offset, values_output + offset,
+                        size1, size2, diag,
+                        storage, compare_function
+                    );
+                }
+                else
+                {
+                    block_merge_tile<BlockSize, ItemsPerThread>(
+                        keys_output + offset, keys_tmp + offset,
+                        values_output + offset, values_tmp + offset,
+                        size1, size2, diag,
+                        storage, compare_function
+                    );
+                }
+                ::rocprim::syncthreads();
+            }
+        }
+        from_tmp = !from_tmp;
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_MERGE_SORT_HPP_
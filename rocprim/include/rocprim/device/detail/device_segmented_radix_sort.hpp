@@ -32,6 +32,7 @@
 #include "../../types.hpp"
 
 #include "../../block/block_scan.hpp"
+#include "../../warp/warp_sort.hpp"
 
 #include "device_radix_sort.hpp"
 
@@ -463,6 +464,118 @@ public:
     }
 };
 
+template<
+    class Key,
+    class Value,
+    unsigned int LogicalWarpSize,
+    bool Descending
+>
+class segmented_radix_sort_warp_helper
+{
+    using key_type = Key;
+    using value_type = Value;
+
+    using key_codec = radix_key_codec<key_type, Descending>;
+    using bit_key_type = typename key_codec::bit_key_type;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    // Keys are sorted together with their positions in the segment, so the bitonic sort is stable
+    struct sort_key
+    {
+        bit_key_type bit_key;
+        unsigned int index;
+    };
+
+    struct compare_op
+    {
+        bit_key_type mask;
+
+        ROCPRIM_DEVICE inline
+        bool operator()(const sort_key& a, const sort_key& b) const
+        {
+            const bit_key_type a_bits = a.bit_key & mask;
+            const bit_key_type b_bits = b.bit_key & mask;
+            return a_bits < b_bits || (a_bits == b_bits && a.index < b.index);
+        }
+    };
+
+    using sort_type = ::rocprim::warp_sort<sort_key, LogicalWarpSize, value_type>;
+
+    template<class SortValue>
+    ROCPRIM_DEVICE inline
+    void sort_warp(sort_key& key, SortValue& value, compare_op compare)
+    {
+        sort_type().sort(key, value, compare);
+    }
+
+    ROCPRIM_DEVICE inline
+    void sort_warp(sort_key& key, ::rocprim::empty_type& value, compare_op compare)
+    {
+        (void) value;
+        sort_type().sort(key, compare);
+    }
+
+public:
+
+    // All threads of the logical warp must call the function with the same segment
+    template<
+        class KeysInputIterator,
+        class KeysOutputIterator,
+        class ValuesInputIterator,
+        class ValuesOutputIterator
+    >
+    ROCPRIM_DEVICE inline
+    void sort(KeysInputIterator keys_input,
+              KeysOutputIterator keys_output,
+              ValuesInputIterator values_input,
+              ValuesOutputIterator values_output,
+              unsigned int begin_offset,
+              unsigned int end_offset,
+              unsigned int begin_bit,
+              unsigned int end_bit)
+    {
+        const unsigned int lane_id = ::rocprim::detail::logical_lane_id<LogicalWarpSize>();
+        const unsigned int valid_count = end_offset - begin_offset;
+
+        // Items are loaded before sorting, so the output range can be the same as the input range
+        sort_key key;
+        value_type value;
+        key.index = lane_id;
+        if(lane_id < valid_count)
+        {
+            key.bit_key = key_codec::encode(keys_input[begin_offset + lane_id]);
+            if(with_values)
+            {
+                value = values_input[begin_offset + lane_id];
+            }
+        }
+        else
+        {
+            // Out of size items are placed after valid items with the same (maximum) key
+            key.bit_key = bit_key_type(-1);
+        }
+
+        const unsigned int bits = end_bit - begin_bit;
+        compare_op compare;
+        compare.mask = static_cast<bit_key_type>(
+            (bits == 8 * sizeof(bit_key_type)
+                ? bit_key_type(-1)
+                : static_cast<bit_key_type>((bit_key_type(1) << bits) - 1)) << begin_bit
+        );
+        sort_warp(key, value, compare);
+
+        if(lane_id < valid_count)
+        {
+            keys_output[begin_offset + lane_id] = key_codec::decode(key.bit_key);
+            if(with_values)
+            {
+                values_output[begin_offset + lane_id] = value;
+            }
+        }
+    }
+};
+
 template<
     class Config,
     bool Descending,
@@ -574,6 +687,78 @@ void segmented_sort(KeysInputIterator keys_input,
     }
 }
 
+template<
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator
+>
+ROCPRIM_DEVICE inline
+void segmented_warp_sort(KeysInputIterator keys_input,
+                         typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                         KeysOutputIterator keys_output,
+                         ValuesInputIterator values_input,
+                         typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                         ValuesOutputIterator values_output,
+                         bool to_output,
+                         unsigned int segments,
+                         OffsetIterator begin_offsets,
+                         OffsetIterator end_offsets,
+                         unsigned int begin_bit,
+                         unsigned int end_bit)
+{
+    constexpr unsigned int logical_warp_size = Config::bins::logical_warp_size;
+    constexpr unsigned int warps_per_block = Config::bins::block_size / logical_warp_size;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using warp_helper_type = segmented_radix_sort_warp_helper<
+        key_type, value_type,
+        logical_warp_size,
+        Descending
+    >;
+
+    const unsigned int segment_id =
+        ::rocprim::detail::block_id<0>() * warps_per_block
+        + ::rocprim::flat_block_thread_id() / logical_warp_size;
+
+    // All threads of the logical warp exit together
+    if(segment_id >= segments)
+    {
+        return;
+    }
+
+    const unsigned int begin_offset = begin_offsets[segment_id];
+    const unsigned int end_offset = end_offsets[segment_id];
+
+    // Empty segment
+    if(end_offset <= begin_offset)
+    {
+        return;
+    }
+
+    if(to_output)
+    {
+        warp_helper_type().sort(
+            keys_input, keys_output, values_input, values_output,
+            begin_offset, end_offset,
+            begin_bit, end_bit
+        );
+    }
+    else
+    {
+        warp_helper_type().sort(
+            keys_input, keys_tmp, values_input, values_tmp,
+            begin_offset, end_offset,
+            begin_bit, end_bit
+        );
+    }
+}
+
 } // end namespace detail
 
 END_ROCPRIM_NAMESPACE
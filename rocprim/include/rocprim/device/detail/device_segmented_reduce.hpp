@@ -32,6 +32,9 @@
 
 #include "../../block/block_load_func.hpp"
 #include "../../block/block_reduce.hpp"
+#include "../../warp/warp_reduce.hpp"
+
+#include "device_binary_search.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -159,6 +162,330 @@ void segmented_reduce(InputIterator input,
     }
 }
 
+// Load-balanced segmented reduce.
+//
+// Segments with at most warp_items items are reduced by logical warps (one segment per warp).
+// Longer segments are split into chunks of items_per_block items, chunks of all long segments
+// are numbered consecutively (chunk_offsets is an exclusive scan of numbers of chunks) and
+// distributed evenly among a fixed number of blocks: each block reduces a contiguous range of
+// chunks. Segments that are entirely within a block's range are written directly; pieces of
+// segments crossing ranges' boundaries are stored as head (continuation of a segment started
+// by a previous block) and tail (beginning of a segment continued by next blocks) values and
+// combined in order by segmented_reduce_fixup.
+
+template<class Config>
+struct segmented_reduce_balanced_params
+{
+    static constexpr unsigned int block_size = Config::block_size;
+    static constexpr unsigned int items_per_thread = Config::items_per_thread;
+    static constexpr unsigned int items_per_block = block_size * items_per_thread;
+    static constexpr unsigned int logical_warp_size =
+        ::rocprim::min(block_size, ::rocprim::warp_size());
+    static constexpr unsigned int warps_per_block = block_size / logical_warp_size;
+    static constexpr unsigned int warp_items = logical_warp_size * items_per_thread;
+
+    static_assert(
+        ::rocprim::detail::is_power_of_two(logical_warp_size),
+        "block_size must be a power of two or a multiple of the warp size"
+    );
+};
+
+template<class OffsetIterator>
+struct segmented_reduce_chunks_op
+{
+    OffsetIterator begin_offsets;
+    OffsetIterator end_offsets;
+    unsigned int segments;
+    unsigned int warp_items;
+    unsigned int items_per_block;
+
+    ROCPRIM_HOST_DEVICE inline
+    unsigned int operator()(unsigned int segment_id) const
+    {
+        if(segment_id >= segments)
+        {
+            return 0;
+        }
+        const unsigned int begin_offset = begin_offsets[segment_id];
+        const unsigned int end_offset = end_offsets[segment_id];
+        if(end_offset <= begin_offset || end_offset - begin_offset <= warp_items)
+        {
+            return 0;
+        }
+        return ::rocprim::detail::ceiling_div(end_offset - begin_offset, items_per_block);
+    }
+};
+
+// The first chunk of the range of chunks reduced by the block
+ROCPRIM_DEVICE inline
+unsigned int segmented_reduce_chunk_begin(unsigned int chunks,
+                                          unsigned int block_id,
+                                          unsigned int number_of_blocks)
+{
+    return static_cast<unsigned int>(
+        static_cast<unsigned long long>(chunks) * block_id / number_of_blocks
+    );
+}
+
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE inline
+void segmented_reduce_short(InputIterator input,
+                            OutputIterator output,
+                            unsigned int segments,
+                            OffsetIterator begin_offsets,
+                            OffsetIterator end_offsets,
+                            BinaryFunction reduce_op,
+                            ResultType initial_value)
+{
+    using params = segmented_reduce_balanced_params<Config>;
+    constexpr unsigned int logical_warp_size = params::logical_warp_size;
+
+    using warp_reduce_type = ::rocprim::warp_reduce<ResultType, logical_warp_size>;
+
+    ROCPRIM_SHARED_MEMORY typename warp_reduce_type::storage_type
+        reduce_storage[params::warps_per_block];
+
+    const unsigned int warp_id = ::rocprim::flat_block_thread_id() / logical_warp_size;
+    const unsigned int lane_id = ::rocprim::flat_block_thread_id() % logical_warp_size;
+    const unsigned int segment_id =
+        ::rocprim::detail::block_id<0>() * params::warps_per_block + warp_id;
+
+    // All threads of the logical warp exit together
+    if(segment_id >= segments)
+    {
+        return;
+    }
+
+    const unsigned int begin_offset = begin_offsets[segment_id];
+    const unsigned int end_offset = end_offsets[segment_id];
+
+    // Empty segment
+    if(end_offset <= begin_offset)
+    {
+        if(lane_id == 0)
+        {
+            output[segment_id] = initial_value;
+        }
+        return;
+    }
+
+    // Long segments are reduced by segmented_reduce_long
+    const unsigned int valid_count = end_offset - begin_offset;
+    if(valid_count > params::warp_items)
+    {
+        return;
+    }
+
+    ResultType result;
+    if(lane_id < valid_count)
+    {
+        unsigned int offset = begin_offset + lane_id;
+        result = input[offset];
+        offset += logical_warp_size;
+        while(offset < end_offset)
+        {
+            result = reduce_op(result, static_cast<ResultType>(input[offset]));
+            offset += logical_warp_size;
+        }
+    }
+    warp_reduce_type().reduce(
+        result, result,
+        static_cast<int>(::rocprim::min(valid_count, logical_warp_size)),
+        reduce_storage[warp_id], reduce_op
+    );
+
+    if(lane_id == 0)
+    {
+        output[segment_id] = reduce_op(initial_value, result);
+    }
+}
+
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE inline
+void segmented_reduce_long(InputIterator input,
+                           OutputIterator output,
+                           unsigned int segments,
+                           OffsetIterator begin_offsets,
+                           OffsetIterator end_offsets,
+                           const unsigned int * chunk_offsets,
+                           ResultType * head_values,
+                           unsigned int * head_complete,
+                           ResultType * tail_values,
+                           unsigned int * tail_segments,
+                           BinaryFunction reduce_op,
+                           ResultType initial_value)
+{
+    using params = segmented_reduce_balanced_params<Config>;
+    constexpr unsigned int block_size = params::block_size;
+    constexpr unsigned int items_per_thread = params::items_per_thread;
+    constexpr unsigned int items_per_block = params::items_per_block;
+
+    using reduce_type = ::rocprim::block_reduce<
+        ResultType, block_size,
+        Config::block_reduce_method
+    >;
+
+    ROCPRIM_SHARED_MEMORY typename reduce_type::storage_type reduce_storage;
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    const unsigned int block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+
+    const unsigned int chunks = chunk_offsets[segments];
+    const unsigned int chunk_begin = segmented_reduce_chunk_begin(chunks, block_id, number_of_blocks);
+    const unsigned int chunk_end = segmented_reduce_chunk_begin(chunks, block_id + 1, number_of_blocks);
+
+    if(flat_id == 0)
+    {
+        // No tail by default
+        tail_segments[block_id] = segments;
+    }
+    if(chunk_begin == chunk_end)
+    {
+        return;
+    }
+
+    // The segment of the first chunk: the last segment (i.e. skipping short segments without
+    // chunks) with chunk_offsets[segment_id] <= chunk_begin
+    unsigned int segment_id = upper_bound_n(
+        chunk_offsets, segments + 1, chunk_begin, ::rocprim::less<unsigned int>()
+    ) - 1;
+    unsigned int segment_chunk_begin = chunk_offsets[segment_id];
+    unsigned int segment_chunk_end = chunk_offsets[segment_id + 1];
+
+    ResultType accumulator;
+    for(unsigned int chunk = chunk_begin; chunk < chunk_end; chunk++)
+    {
+        while(chunk >= segment_chunk_end)
+        {
+            segment_id++;
+            segment_chunk_begin = segment_chunk_end;
+            segment_chunk_end = chunk_offsets[segment_id + 1];
+        }
+
+        const unsigned int block_offset =
+            static_cast<unsigned int>(begin_offsets[segment_id])
+            + (chunk - segment_chunk_begin) * items_per_block;
+        const unsigned int end_offset = end_offsets[segment_id];
+        const unsigned int valid_count = ::rocprim::min(end_offset - block_offset, items_per_block);
+
+        ResultType values[items_per_thread];
+        ResultType result;
+        block_load_direct_striped<block_size>(flat_id, input + block_offset, values, valid_count);
+        if(flat_id < valid_count)
+        {
+            result = values[0];
+            for(unsigned int i = 1; i < items_per_thread; i++)
+            {
+                if(i * block_size + flat_id < valid_count)
+                {
+                    result = reduce_op(result, values[i]);
+                }
+            }
+        }
+        if(valid_count >= block_size)
+        {
+            reduce_type().reduce(result, result, reduce_storage, reduce_op);
+        }
+        else
+        {
+            reduce_type().reduce(result, result, valid_count, reduce_storage, reduce_op);
+        }
+
+        if(flat_id == 0)
+        {
+            const bool first_chunk = chunk == segment_chunk_begin || chunk == chunk_begin;
+            accumulator = first_chunk ? result : reduce_op(accumulator, result);
+
+            const bool starts_here = segment_chunk_begin >= chunk_begin;
+            const bool ends_here = chunk + 1 == segment_chunk_end;
+            if(ends_here && starts_here)
+            {
+                output[segment_id] = reduce_op(initial_value, accumulator);
+            }
+            else if(ends_here || chunk + 1 == chunk_end)
+            {
+                if(starts_here)
+                {
+                    tail_values[block_id] = accumulator;
+                    tail_segments[block_id] = segment_id;
+                }
+                else
+                {
+                    head_values[block_id] = accumulator;
+                    head_complete[block_id] = ends_here ? 1 : 0;
+                }
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+}
+
+template<
+    unsigned int BlockSize,
+    class OutputIterator,
+    class ResultType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE inline
+void segmented_reduce_fixup(OutputIterator output,
+                            unsigned int segments,
+                            const unsigned int * chunk_offsets,
+                            const ResultType * head_values,
+                            const unsigned int * head_complete,
+                            const ResultType * tail_values,
+                            const unsigned int * tail_segments,
+                            unsigned int number_of_blocks,
+                            BinaryFunction reduce_op,
+                            ResultType initial_value)
+{
+    const unsigned int id =
+        ::rocprim::detail::block_id<0>() * BlockSize + ::rocprim::flat_block_thread_id();
+    if(id >= number_of_blocks)
+    {
+        return;
+    }
+
+    // Every segment split between blocks is finalized by the block which has started it
+    const unsigned int segment_id = tail_segments[id];
+    if(segment_id >= segments)
+    {
+        return;
+    }
+
+    const unsigned int chunks = chunk_offsets[segments];
+    ResultType accumulator = tail_values[id];
+    for(unsigned int block_id = id + 1; block_id < number_of_blocks; block_id++)
+    {
+        // Skip blocks without chunks
+        if(segmented_reduce_chunk_begin(chunks, block_id, number_of_blocks)
+            == segmented_reduce_chunk_begin(chunks, block_id + 1, number_of_blocks))
+        {
+            continue;
+        }
+        accumulator = reduce_op(accumulator, head_values[block_id]);
+        if(head_complete[block_id])
+        {
+            break;
+        }
+    }
+    output[segment_id] = reduce_op(initial_value, accumulator);
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
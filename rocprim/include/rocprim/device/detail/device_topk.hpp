@@ -0,0 +1,87 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_TOPK_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_TOPK_HPP_
+
+#include <type_traits>
+#include <iterator>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../detail/radix_sort.hpp"
+
+#include "../../intrinsics.hpp"
+#include "../../functional.hpp"
+#include "../../types.hpp"
+
+#include "../../iterator/zip_iterator.hpp"
+
+#include "device_radix_select.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Flags items that precede the k-th item (and the k-th item itself)
+template<class Key, bool Descending>
+struct topk_flag_op
+{
+    using key_codec = radix_key_codec<Key, Descending>;
+    using bit_key_type = typename key_codec::bit_key_type;
+
+    const radix_select_state<bit_key_type> * state;
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const ::rocprim::tuple<Key, size_t>& item) const
+    {
+        const bit_key_type bit_key = key_codec::encode(::rocprim::get<0>(item));
+        return bit_key < state->key_prefix
+            || (bit_key == state->key_prefix && ::rocprim::get<1>(item) <= state->index_prefix);
+    }
+};
+
+// Keys are selected alone or zipped with values
+template<bool WithValues, class KeysIterator, class ValuesIterator>
+inline
+auto make_topk_select_iterator(KeysIterator keys, ValuesIterator values)
+    -> typename std::enable_if<!WithValues, KeysIterator>::type
+{
+    (void) values;
+    return keys;
+}
+
+template<bool WithValues, class KeysIterator, class ValuesIterator>
+inline
+auto make_topk_select_iterator(KeysIterator keys, ValuesIterator values)
+    -> typename std::enable_if<
+        WithValues,
+        ::rocprim::zip_iterator<::rocprim::tuple<KeysIterator, ValuesIterator>>
+    >::type
+{
+    return ::rocprim::make_zip_iterator(::rocprim::make_tuple(keys, values));
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_TOPK_HPP_
@@ -23,6 +23,7 @@
 
 #include <type_traits>
 
+#include "../../config.hpp"
 #include "../../intrinsics.hpp"
 #include "../../types.hpp"
 #include "../../type_traits.hpp"
@@ -33,6 +34,9 @@
 #include "../../detail/various.hpp"
 #include "../../detail/binary_op_wrappers.hpp"
 
+#include "../config_types.hpp"
+#include "device_info.hpp"
+
 extern "C"
 {
     void __builtin_amdgcn_s_sleep(int);
@@ -58,43 +62,164 @@ enum prefix_flag
     PREFIX_COMPLETE = 2
 };
 
+// Back-off policies of blocks waiting for prefixes of previous blocks.
+// A policy object is created for every wait, operator() is called after every failed attempt.
+template<lookback_backoff Backoff>
+struct lookback_backoff_policy;
+
+template<>
+struct lookback_backoff_policy<lookback_backoff::none>
+{
+    ROCPRIM_DEVICE inline
+    void operator()()
+    {
+    }
+};
+
+template<>
+struct lookback_backoff_policy<lookback_backoff::linear>
+{
+    static constexpr unsigned int max_sleeps = 32;
+    unsigned int sleeps = 1;
+
+    ROCPRIM_DEVICE inline
+    void operator()()
+    {
+        for(unsigned int i = 0; i < sleeps; i++)
+        {
+            __builtin_amdgcn_s_sleep(1);
+        }
+        if(sleeps < max_sleeps)
+        {
+            sleeps++;
+        }
+    }
+};
+
+template<>
+struct lookback_backoff_policy<lookback_backoff::exponential>
+{
+    static constexpr unsigned int max_sleeps = 64;
+    unsigned int sleeps = 1;
+
+    ROCPRIM_DEVICE inline
+    void operator()()
+    {
+        for(unsigned int i = 0; i < sleeps; i++)
+        {
+            __builtin_amdgcn_s_sleep(1);
+        }
+        sleeps = 2 * sleeps < max_sleeps ? 2 * sleeps : max_sleeps;
+    }
+};
+
+// Packing of flag and prefix value into an integer which can be loaded/stored using
+// a single atomic instruction.
+template<class T, bool IsWide = (sizeof(T) > 4)>
+struct lookback_scan_prefix_packing;
+
+// Flag and value are stored next to each other in a 32-bit or 64-bit int.
+template<class T>
+struct lookback_scan_prefix_packing<T, false>
+{
+    using flag_type = char;
+    using underlying_type =
+        typename std::conditional<
+            (sizeof(T) > 2),
+            unsigned long long,
+            unsigned int
+        >::type;
+
+    struct prefix_type
+    {
+        flag_type flag;
+        T value;
+    } __attribute__((aligned(sizeof(underlying_type))));
+
+    static_assert(sizeof(underlying_type) == sizeof(prefix_type), "");
+
+    ROCPRIM_DEVICE static inline
+    underlying_type pack(const flag_type flag, const T value)
+    {
+        prefix_type prefix = { flag, value };
+        underlying_type p;
+        __builtin_memcpy(&p, &prefix, sizeof(prefix_type));
+        return p;
+    }
+
+    ROCPRIM_DEVICE static inline
+    void unpack(const underlying_type p, flag_type& flag, T& value)
+    {
+        prefix_type prefix;
+        __builtin_memcpy(&prefix, &p, sizeof(prefix_type));
+        flag = prefix.flag;
+        value = prefix.value;
+    }
+};
+
+// 64-bit integers (offsets and counts) never reach 2^62, so the flag is stored
+// in the 2 highest bits of the value.
+template<class T>
+struct lookback_scan_prefix_packing<T, true>
+{
+    static_assert(
+        std::is_integral<T>::value && sizeof(T) == 8,
+        "Only 64-bit integers can be packed with flags"
+    );
+
+    using flag_type = char;
+    using underlying_type = unsigned long long;
+
+    static constexpr unsigned int value_bits = 62;
+    static constexpr underlying_type value_mask = (underlying_type(1) << value_bits) - 1;
+
+    ROCPRIM_DEVICE static inline
+    underlying_type pack(const flag_type flag, const T value)
+    {
+        // PREFIX_INVALID (-1) is stored as 3
+        return (static_cast<underlying_type>(flag & 3) << value_bits)
+            | (static_cast<underlying_type>(value) & value_mask);
+    }
+
+    ROCPRIM_DEVICE static inline
+    void unpack(const underlying_type p, flag_type& flag, T& value)
+    {
+        const flag_type f = static_cast<flag_type>(p >> value_bits);
+        flag = f == 3 ? flag_type(PREFIX_INVALID) : f;
+        value = static_cast<T>(p & value_mask);
+    }
+};
+
 // lookback_scan_state object keeps track of prefixes status for
 // a look-back prefix scan. Initially every prefix can be either
 // invalid (padding values) or empty. One thread in a block should
 // later set it to partial, and later to complete.
-template<class T, bool UseSleep = false, bool IsSmall = (sizeof(T) <= 4)>
+//
+// The packed variant (IsSmall) is used by default for types of at most 4 bytes,
+// it can be also explicitly requested for 64-bit offsets and counts.
+template<
+    class T,
+    class BackoffPolicy = lookback_backoff_policy<lookback_backoff::none>,
+    bool IsSmall = (sizeof(T) <= 4)
+>
 struct lookback_scan_state;
 
 // Packed flag and prefix value are loaded/stored in one atomic operation.
-template<class T, bool UseSleep>
-struct lookback_scan_state<T, UseSleep, true>
+template<class T, class BackoffPolicy>
+struct lookback_scan_state<T, BackoffPolicy, true>
 {
 private:
-    using flag_type_ = char;
+    using packing = lookback_scan_prefix_packing<T>;
 
     // Type which is used in store/load operations of block prefix (flag and value).
     // It is 32-bit or 64-bit int and can be loaded/stored using single atomic instruction.
-    using prefix_underlying_type =
-        typename std::conditional<
-            (sizeof(T) > 2),
-            unsigned long long,
-            unsigned int
-        >::type;
+    using prefix_underlying_type = typename packing::underlying_type;
 
     static constexpr unsigned int padding = ::rocprim::warp_size();
 
-    // Helper struct
-    struct prefix_type
-    {
-        flag_type_ flag;
-        T value;
-    } __attribute__((aligned(sizeof(prefix_underlying_type))));
-
-    static_assert(sizeof(prefix_underlying_type) == sizeof(prefix_type), "");
-
 public:
     // Type used for flag/flag of block prefix
-    using flag_type = flag_type_;
+    using flag_type = typename packing::flag_type;
     using value_type = T;
 
     // temp_storage must point to allocation of get_storage_size(number_of_blocks) bytes
@@ -119,19 +244,11 @@ public:
     {
         if(block_id < number_of_blocks)
         {
-            prefix_type prefix;
-            prefix.flag = PREFIX_EMPTY;
-            prefix_underlying_type p;
-            __builtin_memcpy(&p, &prefix, sizeof(prefix_type));
-            prefixes[padding + block_id] = p;
+            prefixes[padding + block_id] = packing::pack(PREFIX_EMPTY, T());
         }
         if(block_id < padding)
         {
-            prefix_type prefix;
-            prefix.flag = PREFIX_INVALID;
-            prefix_underlying_type p;
-            __builtin_memcpy(&p, &prefix, sizeof(prefix_type));
-            prefixes[block_id] = p;
+            prefixes[block_id] = packing::pack(PREFIX_INVALID, T());
         }
     }
 
@@ -151,52 +268,46 @@ public:
     ROCPRIM_DEVICE inline
     void get(const unsigned int block_id, flag_type& flag, T& value)
     {
-        prefix_type prefix;
-        
-        const uint SLEEP_MAX = 32;
-        uint times_through = 1;
+        BackoffPolicy backoff;
 
+        // atomic_add(..., 0) is used to load values atomically
         prefix_underlying_type p = ::rocprim::detail::atomic_add(&prefixes[padding + block_id], 0);
-        __builtin_memcpy(&prefix, &p, sizeof(prefix_type));
-        while(prefix.flag == PREFIX_EMPTY)
+        packing::unpack(p, flag, value);
+        while(flag == PREFIX_EMPTY)
         {
-            if (UseSleep)
-            {
-                for (uint j = 0; j < times_through; j++)
-                    __builtin_amdgcn_s_sleep(1);
-                if (times_through < SLEEP_MAX)
-                    times_through++;
-            }
-            // atomic_add(..., 0) is used to load values atomically
-            prefix_underlying_type p = ::rocprim::detail::atomic_add(&prefixes[padding + block_id], 0);
-            __builtin_memcpy(&prefix, &p, sizeof(prefix_type));
+            backoff();
+            p = ::rocprim::detail::atomic_add(&prefixes[padding + block_id], 0);
+            packing::unpack(p, flag, value);
         }
-
-        // return
-        flag = prefix.flag;
-        value = prefix.value;
     }
 
 private:
     ROCPRIM_DEVICE inline
     void set(const unsigned int block_id, const flag_type flag, const T value)
     {
-        prefix_type prefix = { flag, value };
-        prefix_underlying_type p;
-        __builtin_memcpy(&p, &prefix, sizeof(prefix_type));
-        ::rocprim::detail::atomic_exch(&prefixes[padding + block_id], p);
+        ::rocprim::detail::atomic_exch(&prefixes[padding + block_id], packing::pack(flag, value));
     }
 
     prefix_underlying_type * prefixes;
 };
 
-// Flag, partial and final prefixes are stored in separate arrays.
-// Consistency ensured by memory fences between flag and prefixes load/store operations.
-template<class T, bool UseSleep>
-struct lookback_scan_state<T, UseSleep, false>
+// Every 32 bits of the prefix value are stored in a 64-bit word together with a copy of the flag.
+// Words are loaded/stored atomically, and partial and complete prefixes of a block are set only
+// once, so a loaded value is consistent if flags of all its words are equal. Otherwise (e.g. some
+// words are already complete while others are still partial) the prefix is loaded again.
+// Unlike storing flags and values in separate arrays, this requires neither memory fences between
+// flag and value operations nor dependent loads of flags and values during look-back.
+// (AMD GPUs do not have 128-bit atomics, which would allow to pack flags with 64-bit values.)
+template<class T, class BackoffPolicy>
+struct lookback_scan_state<T, BackoffPolicy, false>
 {
 private:
+    using word_type = unsigned long long;
+    using payload_type = unsigned int;
+
     static constexpr unsigned int padding = ::rocprim::warp_size();
+    static constexpr unsigned int words_no =
+        (sizeof(T) + sizeof(payload_type) - 1) / sizeof(payload_type);
 
 public:
     using flag_type = char;
@@ -206,28 +317,16 @@ public:
     ROCPRIM_HOST static inline
     lookback_scan_state create(void* temp_storage, const unsigned int number_of_blocks)
     {
-        const auto n = padding + number_of_blocks;
+        (void) number_of_blocks;
         lookback_scan_state state;
-
-        auto ptr = reinterpret_cast<char*>(temp_storage);
-
-        state.prefixes_flags = reinterpret_cast<flag_type*>(ptr);
-        ptr += ::rocprim::detail::align_size(n * sizeof(flag_type));
-
-        state.prefixes_partial_values = reinterpret_cast<T*>(ptr);
-        ptr += ::rocprim::detail::align_size(n * sizeof(T));
-
-        state.prefixes_complete_values = reinterpret_cast<T*>(ptr);
+        state.prefixes = reinterpret_cast<word_type*>(temp_storage);
         return state;
     }
 
     ROCPRIM_HOST static inline
     size_t get_storage_size(const unsigned int number_of_blocks)
     {
-        const auto n = padding + number_of_blocks;
-        size_t size = ::rocprim::detail::align_size(n * sizeof(flag_type));
-        size += 2 * ::rocprim::detail::align_size(n * sizeof(T));
-        return size;
+        return sizeof(word_type) * words_no * (padding + number_of_blocks);
     }
 
     ROCPRIM_DEVICE inline
@@ -236,66 +335,85 @@ public:
     {
         if(block_id < number_of_blocks)
         {
-            prefixes_flags[padding + block_id] = PREFIX_EMPTY;
+            this->set(padding + block_id, PREFIX_EMPTY, T());
         }
         if(block_id < padding)
         {
-            prefixes_flags[block_id] = PREFIX_INVALID;
+            this->set(block_id, PREFIX_INVALID, T());
         }
     }
 
     ROCPRIM_DEVICE inline
     void set_partial(const unsigned int block_id, const T value)
     {
-        store_volatile(&prefixes_partial_values[padding + block_id], value);
-        ::rocprim::detail::memory_fence_device();
-        store_volatile<flag_type>(&prefixes_flags[padding + block_id], PREFIX_PARTIAL);
+        this->set(padding + block_id, PREFIX_PARTIAL, value);
     }
 
     ROCPRIM_DEVICE inline
     void set_complete(const unsigned int block_id, const T value)
     {
-        store_volatile(&prefixes_complete_values[padding + block_id], value);
-        ::rocprim::detail::memory_fence_device();
-        store_volatile<flag_type>(&prefixes_flags[padding + block_id], PREFIX_COMPLETE);
+        this->set(padding + block_id, PREFIX_COMPLETE, value);
     }
 
     // block_id must be > 0
     ROCPRIM_DEVICE inline
     void get(const unsigned int block_id, flag_type& flag, T& value)
     {
-        const uint SLEEP_MAX = 32;
-        uint times_through = 1;
+        BackoffPolicy backoff;
 
-        flag = load_volatile(&prefixes_flags[padding + block_id]);
-        ::rocprim::detail::memory_fence_device();
+        this->load(padding + block_id, flag, value);
         while(flag == PREFIX_EMPTY)
         {
-            if (UseSleep)
-            {
-                for (uint j = 0; j < times_through; j++)
-                    __builtin_amdgcn_s_sleep(1);
-                if (times_through < SLEEP_MAX)
-                    times_through++;
-            }
+            backoff();
+            this->load(padding + block_id, flag, value);
+        }
+    }
 
-            flag = load_volatile(&prefixes_flags[padding + block_id]);
-            ::rocprim::detail::memory_fence_device();
-        } 
+private:
+    ROCPRIM_DEVICE inline
+    void set(const unsigned int index, const flag_type flag, const T value)
+    {
+        payload_type payloads[words_no];
+        payloads[words_no - 1] = 0;
+        __builtin_memcpy(payloads, &value, sizeof(T));
 
-        if(flag == PREFIX_PARTIAL)
-            value = load_volatile(&prefixes_partial_values[padding + block_id]);
-        else
-            value = load_volatile(&prefixes_complete_values[padding + block_id]);
+        const word_type tag = static_cast<word_type>(static_cast<payload_type>(flag)) << 32;
+        #pragma unroll
+        for(unsigned int i = 0; i < words_no; i++)
+        {
+            ::rocprim::detail::atomic_exch(&prefixes[index * words_no + i], tag | payloads[i]);
+        }
     }
 
-private:
-    flag_type * prefixes_flags;
-    // We need to separate arrays for partial and final prefixes, because
-    // value can be overwritten before flag is changed (flag and value are
-    // not stored in single instruction).
-    T * prefixes_partial_values;
-    T * prefixes_complete_values;
+    // Inconsistent values are returned as empty
+    ROCPRIM_DEVICE inline
+    void load(const unsigned int index, flag_type& flag, T& value)
+    {
+        word_type words[words_no];
+        #pragma unroll
+        for(unsigned int i = 0; i < words_no; i++)
+        {
+            // atomic_add(..., 0) is used to load words atomically (as in the packed state)
+            words[i] = ::rocprim::detail::atomic_add(&prefixes[index * words_no + i], 0);
+        }
+
+        payload_type payloads[words_no];
+        const payload_type tag = static_cast<payload_type>(words[0] >> 32);
+        bool is_consistent = true;
+        #pragma unroll
+        for(unsigned int i = 0; i < words_no; i++)
+        {
+            payloads[i] = static_cast<payload_type>(words[i]);
+            is_consistent &= static_cast<payload_type>(words[i] >> 32) == tag;
+        }
+
+        flag = is_consistent
+            ? static_cast<flag_type>(static_cast<int>(tag))
+            : static_cast<flag_type>(PREFIX_EMPTY);
+        __builtin_memcpy(&value, payloads, sizeof(T));
+    }
+
+    word_type * prefixes;
 };
 
 template<class T, class BinaryFunction, class LookbackScanState>
@@ -404,6 +522,46 @@ protected:
     LookbackScanState& scan_state_;
 };
 
+// Returns the back-off strategy used for lookback_backoff::automatic on the current device
+ROCPRIM_HOST inline
+hipError_t get_device_lookback_backoff(lookback_backoff& backoff)
+{
+    device_info info;
+    hipError_t error = get_device_info(info);
+    if(error != hipSuccess) return error;
+
+    // Spinning blocks of decoupled look-back slow down gfx908 considerably
+    backoff = info.arch == 908 ? lookback_backoff::linear : lookback_backoff::none;
+    return hipSuccess;
+}
+
+// Calls launch(BackoffPolicy()) with the policy of Backoff, so the same host code launches
+// kernels with any back-off policy.
+template<lookback_backoff Backoff, class Launch>
+ROCPRIM_HOST inline
+auto with_lookback_backoff(Launch&& launch)
+    -> typename std::enable_if<Backoff != lookback_backoff::automatic, hipError_t>::type
+{
+    return launch(lookback_backoff_policy<Backoff>());
+}
+
+template<lookback_backoff Backoff, class Launch>
+ROCPRIM_HOST inline
+auto with_lookback_backoff(Launch&& launch)
+    -> typename std::enable_if<Backoff == lookback_backoff::automatic, hipError_t>::type
+{
+    lookback_backoff backoff;
+    hipError_t error = get_device_lookback_backoff(backoff);
+    if(error != hipSuccess) return error;
+
+    // Only strategies which can be selected automatically are instantiated
+    if(backoff == lookback_backoff::linear)
+    {
+        return launch(lookback_backoff_policy<lookback_backoff::linear>());
+    }
+    return launch(lookback_backoff_policy<lookback_backoff::none>());
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,594 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_ADJACENT_DIFFERENCE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_ADJACENT_DIFFERENCE_HPP_
+
+#include <type_traits>
+#include <iterator>
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../detail/various.hpp"
+#include "../detail/match_result_type.hpp"
+#include "../types/tuple.hpp"
+#include "../iterator/zip_iterator.hpp"
+
+#include "device_adjacent_difference_config.hpp"
+#include "detail/device_adjacent_difference.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<
+    bool Right,
+    unsigned int ItemsPerBlock,
+    class InputIterator,
+    class InputType
+>
+__global__
+void adjacent_difference_save_boundaries_kernel(InputIterator input,
+                                                InputType * boundary_values,
+                                                const unsigned int number_of_blocks)
+{
+    adjacent_difference_save_boundaries_impl<Right, ItemsPerBlock>(
+        input, boundary_values, number_of_blocks
+    );
+}
+
+template<
+    class Config,
+    bool InPlace,
+    bool Right,
+    class ResultType,
+    class InputIterator,
+    class InputType,
+    class OutputIterator,
+    class DifferenceOp
+>
+__global__
+void adjacent_difference_kernel(InputIterator input,
+                                const InputType * boundary_values,
+                                const size_t size,
+                                OutputIterator output,
+                                DifferenceOp difference_op)
+{
+    adjacent_difference_kernel_impl<Config, InPlace, Right, ResultType>(
+        input, boundary_values, size, output, difference_op
+    );
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto error = hipPeekAtLastError(); \
+        if(error != hipSuccess) return error; \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto error = hipStreamSynchronize(stream); \
+            if(error != hipSuccess) return error; \
+            auto end = std::chrono::high_resolution_clock::now(); \
+            auto d = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+            std::cout << " " << d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<
+    class Config,
+    bool InPlace,
+    bool Right,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class DifferenceOp
+>
+inline
+hipError_t adjacent_difference_impl(void * temporary_storage,
+                                    size_t& storage_size,
+                                    InputIterator input,
+                                    OutputIterator output,
+                                    const size_t size,
+                                    DifferenceOp difference_op,
+                                    const hipStream_t stream,
+                                    bool debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = default_or_custom_config<
+        Config,
+        default_adjacent_difference_config<ROCPRIM_TARGET_ARCH, input_type>
+    >;
+
+    constexpr unsigned int block_size = config::block_size;
+    constexpr unsigned int items_per_thread = config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    const unsigned int number_of_blocks =
+        static_cast<unsigned int>(::rocprim::detail::ceiling_div<size_t>(size, items_per_block));
+
+    // Boundary items of all tiles are saved before in-place operations
+    const size_t boundary_values_bytes = InPlace ? number_of_blocks * sizeof(input_type) : 0;
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr when size is zero.
+        storage_size = boundary_values_bytes == 0 ? 4 : boundary_values_bytes;
+        return hipSuccess;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    input_type * boundary_values = InPlace
+        ? reinterpret_cast<input_type *>(temporary_storage)
+        : nullptr;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(InPlace && number_of_blocks > 1)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(adjacent_difference_save_boundaries_kernel<Right, items_per_block>),
+            dim3(::rocprim::detail::ceiling_div(number_of_blocks, block_size)), dim3(block_size), 0, stream,
+            input, boundary_values, number_of_blocks
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("adjacent_difference_save_boundaries_kernel", number_of_blocks, start);
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(adjacent_difference_kernel<config, InPlace, Right, ResultType>),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        input, const_cast<const input_type *>(boundary_values), size, output, difference_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("adjacent_difference_kernel", size, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end of detail namespace
+
+/// \brief Parallel adjacent difference primitive for device level.
+///
+/// adjacent_difference function computes differences between every item of \p input
+/// and the previous one using \p difference_op. The first item is copied to \p output:
+/// <tt>output[0] = input[0]</tt>, <tt>output[i] = difference_op(input[i], input[i - 1])</tt>.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * Every item of \p input is loaded once, neighbours of items are exchanged within
+/// blocks.
+/// * Ranges specified by \p input and \p output must not overlap, see
+/// \p adjacent_difference_inplace for in-place operation.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p adjacent_difference_config or a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for differences.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range of values.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] difference_op - binary operation function object that will be applied to
+/// every item and its predecessor. Default is \p rocprim::minus<T>, where \p T is
+/// a \p value_type of \p InputIterator. The signature of the function should be equivalent
+/// to the following: <tt>U f(const T &a, const T &b);</tt>. The signature does not need
+/// to have <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level adjacent difference is used for delta encoding of
+/// a sorted array of integer values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;     // e.g., 8
+/// int * input;           // e.g., [1, 3, 3, 4, 8, 9, 12, 20]
+/// int * output;          // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::adjacent_difference(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform adjacent difference
+/// rocprim::adjacent_difference(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// // output: [1, 2, 0, 1, 4, 1, 3, 8]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class BinaryFunction = ::rocprim::minus<typename std::iterator_traits<InputIterator>::value_type>
+>
+inline
+hipError_t adjacent_difference(void * temporary_storage,
+                               size_t& storage_size,
+                               InputIterator input,
+                               OutputIterator output,
+                               const size_t size,
+                               BinaryFunction difference_op = BinaryFunction(),
+                               const hipStream_t stream = 0,
+                               bool debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type = typename ::rocprim::detail::match_result_type<
+        input_type, BinaryFunction
+    >::type;
+
+    return detail::adjacent_difference_impl<Config, false, false, result_type>(
+        temporary_storage, storage_size,
+        input, output, size,
+        detail::adjacent_difference_op<result_type, BinaryFunction> { difference_op },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel in-place adjacent difference primitive for device level.
+///
+/// adjacent_difference_inplace function performs the same operation as
+/// \p adjacent_difference, results are written to \p values.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p values must have at least \p size elements.
+/// * The required size of \p temporary_storage is proportional to the number of tiles
+/// (the first item of every tile needs the last item of the previous tile, which can be
+/// overwritten before it is read).
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p adjacent_difference_config or a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the range. Must meet the
+/// requirements of C++ InputIterator and OutputIterator concepts. It can be a simple
+/// pointer type.
+/// \tparam BinaryFunction - type of binary function used for differences.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] values - iterator to the first element in the range of values.
+/// \param [in] size - number of element in the range.
+/// \param [in] difference_op - binary operation function object that will be applied to
+/// every item and its predecessor. Default is \p rocprim::minus<T>. Its result must be
+/// convertible to \p T.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class InputIterator,
+    class BinaryFunction = ::rocprim::minus<typename std::iterator_traits<InputIterator>::value_type>
+>
+inline
+hipError_t adjacent_difference_inplace(void * temporary_storage,
+                                       size_t& storage_size,
+                                       InputIterator values,
+                                       const size_t size,
+                                       BinaryFunction difference_op = BinaryFunction(),
+                                       const hipStream_t stream = 0,
+                                       bool debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    return detail::adjacent_difference_impl<Config, true, false, input_type>(
+        temporary_storage, storage_size,
+        values, values, size,
+        detail::adjacent_difference_op<input_type, BinaryFunction> { difference_op },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel right adjacent difference primitive for device level.
+///
+/// adjacent_difference_right function computes differences between every item of \p input
+/// and the next one using \p difference_op. The last item is copied to \p output:
+/// <tt>output[i] = difference_op(input[i], input[i + 1])</tt>,
+/// <tt>output[size - 1] = input[size - 1]</tt>.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * Ranges specified by \p input and \p output must not overlap, see
+/// \p adjacent_difference_right_inplace for in-place operation.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p adjacent_difference_config or a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for differences.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range of values.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] difference_op - binary operation function object that will be applied to
+/// every item and its successor. Default is \p rocprim::minus<T>, where \p T is
+/// a \p value_type of \p InputIterator.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class BinaryFunction = ::rocprim::minus<typename std::iterator_traits<InputIterator>::value_type>
+>
+inline
+hipError_t adjacent_difference_right(void * temporary_storage,
+                                     size_t& storage_size,
+                                     InputIterator input,
+                                     OutputIterator output,
+                                     const size_t size,
+                                     BinaryFunction difference_op = BinaryFunction(),
+                                     const hipStream_t stream = 0,
+                                     bool debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type = typename ::rocprim::detail::match_result_type<
+        input_type, BinaryFunction
+    >::type;
+
+    return detail::adjacent_difference_impl<Config, false, true, result_type>(
+        temporary_storage, storage_size,
+        input, output, size,
+        detail::adjacent_difference_op<result_type, BinaryFunction> { difference_op },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel in-place right adjacent difference primitive for device level.
+///
+/// adjacent_difference_right_inplace function performs the same operation as
+/// \p adjacent_difference_right, results are written to \p values.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p values must have at least \p size elements.
+/// * The required size of \p temporary_storage is proportional to the number of tiles.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p adjacent_difference_config or a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the range. Must meet the
+/// requirements of C++ InputIterator and OutputIterator concepts. It can be a simple
+/// pointer type.
+/// \tparam BinaryFunction - type of binary function used for differences.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] values - iterator to the first element in the range of values.
+/// \param [in] size - number of element in the range.
+/// \param [in] difference_op - binary operation function object that will be applied to
+/// every item and its successor. Default is \p rocprim::minus<T>. Its result must be
+/// convertible to \p T.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class InputIterator,
+    class BinaryFunction = ::rocprim::minus<typename std::iterator_traits<InputIterator>::value_type>
+>
+inline
+hipError_t adjacent_difference_right_inplace(void * temporary_storage,
+                                             size_t& storage_size,
+                                             InputIterator values,
+                                             const size_t size,
+                                             BinaryFunction difference_op = BinaryFunction(),
+                                             const hipStream_t stream = 0,
+                                             bool debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    return detail::adjacent_difference_impl<Config, true, true, input_type>(
+        temporary_storage, storage_size,
+        values, values, size,
+        detail::adjacent_difference_op<input_type, BinaryFunction> { difference_op },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel adjacent difference by key primitive for device level.
+///
+/// adjacent_difference_by_key function computes differences between values of every
+/// item and the previous one if their keys are equal. Values of first items of runs of
+/// equal keys are copied: <tt>values_output[i] = difference_op(values_input[i], values_input[i - 1])</tt>
+/// if <tt>key_compare_op(keys_input[i], keys_input[i - 1])</tt>, otherwise
+/// <tt>values_output[i] = values_input[i]</tt>.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p keys_input, \p values_input and \p values_output must have
+/// at least \p size elements.
+/// * Ranges specified by \p values_input and \p values_output may be the same
+/// (in-place operation), other overlaps are not allowed.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p adjacent_difference_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for differences.
+/// \tparam KeyCompareFunction - type of binary function used to compare keys.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first element in the range of keys.
+/// \param [in] values_input - iterator to the first element in the range of values.
+/// \param [out] values_output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] difference_op - binary operation function object that will be applied to
+/// values of every item and its predecessor. Default is \p rocprim::minus<V>, where \p V is
+/// a \p value_type of \p ValuesInputIterator.
+/// \param [in] key_compare_op - binary operation function object that will be used to
+/// determine keys equality. Default is \p rocprim::equal_to<K>, where \p K is a \p value_type
+/// of \p KeysInputIterator.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;     // e.g., 8
+/// int * keys_input;      // e.g., [1, 1, 1, 2, 2, 3, 3, 3]
+/// int * values_input;    // e.g., [1, 3, 4, 2, 8, 9, 12, 20]
+/// int * values_output;   // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::adjacent_difference_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, values_input, values_output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform adjacent difference
+/// rocprim::adjacent_difference_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, values_input, values_output, input_size
+/// );
+/// // values_output: [1, 2, 1, 2, 6, 9, 3, 8]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class BinaryFunction = ::rocprim::minus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
+    class KeyCompareFunction = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t adjacent_difference_by_key(void * temporary_storage,
+                                      size_t& storage_size,
+                                      KeysInputIterator keys_input,
+                                      ValuesInputIterator values_input,
+                                      ValuesOutputIterator values_output,
+                                      const size_t size,
+                                      BinaryFunction difference_op = BinaryFunction(),
+                                      KeyCompareFunction key_compare_op = KeyCompareFunction(),
+                                      const hipStream_t stream = 0,
+                                      bool debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using result_type = typename ::rocprim::detail::match_result_type<
+        value_type, BinaryFunction
+    >::type;
+
+    // Values of the previous tile can be overwritten before they are read, so boundaries
+    // are always saved (the overhead is negligible compared to the main kernel)
+    return detail::adjacent_difference_impl<Config, true, false, result_type>(
+        temporary_storage, storage_size,
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(keys_input, values_input)),
+        values_output, size,
+        detail::adjacent_difference_by_key_op<result_type, BinaryFunction, KeyCompareFunction> {
+            difference_op, key_compare_op
+        },
+        stream, debug_synchronous
+    );
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_ADJACENT_DIFFERENCE_HPP_
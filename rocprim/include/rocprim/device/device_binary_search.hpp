@@ -27,8 +27,11 @@
 #include "../config.hpp"
 #include "../detail/various.hpp"
 
+#include "device_binary_search_config.hpp"
 #include "detail/device_binary_search.hpp"
 
+#include "../iterator/counting_iterator.hpp"
+
 #include "device_transform.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -83,6 +86,255 @@ hipError_t binary_search(void * temporary_storage,
     );
 }
 
+template<
+    class HaystackIterator,
+    class NeedlesIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+__global__
+void sorted_search_partition_kernel(HaystackIterator haystack,
+                                    NeedlesIterator needles,
+                                    const size_t haystack_size,
+                                    const size_t needles_size,
+                                    size_t * partitions,
+                                    const size_t partitions_count,
+                                    const unsigned int items_per_block,
+                                    SearchFunction search_op,
+                                    CompareFunction compare_op)
+{
+    sorted_search_partition_kernel_impl(
+        haystack, needles, haystack_size, needles_size,
+        partitions, partitions_count, items_per_block,
+        search_op, compare_op
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class HaystackIterator,
+    class NeedlesIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+__global__
+void sorted_search_kernel(HaystackIterator haystack,
+                          NeedlesIterator needles,
+                          OutputIterator output,
+                          const size_t haystack_size,
+                          const size_t needles_size,
+                          const size_t * partitions,
+                          SearchFunction search_op,
+                          CompareFunction compare_op)
+{
+    sorted_search_kernel_impl<BlockSize, ItemsPerThread>(
+        haystack, needles, output, haystack_size, needles_size,
+        partitions, search_op, compare_op
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int SharedLevels,
+    class T,
+    class NeedlesIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+__global__
+void indexed_search_kernel(const T * index,
+                           const unsigned int levels,
+                           const size_t haystack_size,
+                           NeedlesIterator needles,
+                           OutputIterator output,
+                           const size_t needles_size,
+                           SearchFunction search_op,
+                           CompareFunction compare_op)
+{
+    indexed_search_kernel_impl<BlockSize, ItemsPerThread, SharedLevels>(
+        index, levels, haystack_size, needles, output, needles_size,
+        search_op, compare_op
+    );
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto error = hipPeekAtLastError(); \
+        if(error != hipSuccess) return error; \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto error = hipStreamSynchronize(stream); \
+            if(error != hipSuccess) return error; \
+            auto end = std::chrono::high_resolution_clock::now(); \
+            auto d = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+            std::cout << " " << d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<
+    class Config,
+    class HaystackIterator,
+    class NeedlesIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+inline
+hipError_t sorted_search(void * temporary_storage,
+                         size_t& storage_size,
+                         HaystackIterator haystack,
+                         NeedlesIterator needles,
+                         OutputIterator output,
+                         size_t haystack_size,
+                         size_t needles_size,
+                         SearchFunction search_op,
+                         CompareFunction compare_op,
+                         hipStream_t stream,
+                         bool debug_synchronous)
+{
+    using haystack_type = typename std::iterator_traits<HaystackIterator>::value_type;
+
+    using config = default_or_custom_config<
+        Config,
+        default_sorted_search_config<ROCPRIM_TARGET_ARCH, haystack_type>
+    >;
+
+    constexpr unsigned int block_size = config::block_size;
+    constexpr unsigned int items_per_thread = config::items_per_thread;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+    constexpr unsigned int partition_block_size = 256;
+
+    const size_t number_of_blocks =
+        ::rocprim::detail::ceiling_div(haystack_size + needles_size, items_per_block);
+    const size_t partitions_count = number_of_blocks + 1;
+    const size_t partitions_bytes = partitions_count * sizeof(size_t);
+
+    if(temporary_storage == nullptr)
+    {
+        // storage_size is never zero
+        storage_size = partitions_bytes;
+        return hipSuccess;
+    }
+
+    if(needles_size == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    size_t * partitions = reinterpret_cast<size_t *>(temporary_storage);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(sorted_search_partition_kernel),
+        dim3(::rocprim::detail::ceiling_div<size_t>(partitions_count, partition_block_size)),
+        dim3(partition_block_size), 0, stream,
+        haystack, needles, haystack_size, needles_size,
+        partitions, partitions_count, items_per_block,
+        search_op, compare_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sorted_search_partition_kernel", partitions_count, start);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(sorted_search_kernel<block_size, items_per_thread>),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        haystack, needles, output, haystack_size, needles_size,
+        partitions, search_op, compare_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sorted_search_kernel", needles_size, start);
+
+    return hipSuccess;
+}
+
+template<
+    class Config,
+    class T,
+    class NeedlesIterator,
+    class OutputIterator,
+    class SearchFunction,
+    class CompareFunction
+>
+inline
+hipError_t indexed_search(void * temporary_storage,
+                          size_t& storage_size,
+                          const T * index,
+                          size_t haystack_size,
+                          NeedlesIterator needles,
+                          OutputIterator output,
+                          size_t needles_size,
+                          SearchFunction search_op,
+                          CompareFunction compare_op,
+                          hipStream_t stream,
+                          bool debug_synchronous)
+{
+    using config = default_or_custom_config<
+        Config,
+        default_search_index_config<ROCPRIM_TARGET_ARCH, T>
+    >;
+
+    constexpr unsigned int block_size = config::block_size;
+    constexpr unsigned int items_per_thread = config::items_per_thread;
+    constexpr unsigned int shared_levels = config::shared_levels;
+    constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, otherwise
+        // user may again pass nullptr as temporary_storage
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(needles_size == 0)
+    {
+        return hipSuccess;
+    }
+
+    const unsigned int levels = search_index_levels(haystack_size);
+    const size_t number_of_blocks = ::rocprim::detail::ceiling_div(needles_size, items_per_block);
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        std::cout << "levels " << levels << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(indexed_search_kernel<block_size, items_per_thread, shared_levels>),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        index, levels, haystack_size, needles, output, needles_size,
+        search_op, compare_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("indexed_search_kernel", needles_size, start);
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
 } // end of detail namespace
 
 template<
@@ -169,6 +421,213 @@ hipError_t binary_search(void * temporary_storage,
     );
 }
 
+/// \brief The same as \p lower_bound but needles must be sorted by \p compare_op.
+///
+/// Haystack and needles are co-iterated along the merge path, so the number of (coalesced)
+/// global loads is O(\p haystack_size + \p needles_size) instead of
+/// O(\p needles_size * log(\p haystack_size)). Use \p lower_bound for unsorted needles.
+/// \p Config can be \p sorted_search_config.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class NeedlesIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t lower_bound_sorted_needles(void * temporary_storage,
+                                      size_t& storage_size,
+                                      HaystackIterator haystack,
+                                      NeedlesIterator needles,
+                                      OutputIterator output,
+                                      size_t haystack_size,
+                                      size_t needles_size,
+                                      CompareFunction compare_op = CompareFunction(),
+                                      hipStream_t stream = 0,
+                                      bool debug_synchronous = false)
+{
+    return detail::sorted_search<Config>(
+        temporary_storage, storage_size,
+        haystack, needles, output,
+        haystack_size, needles_size,
+        detail::lower_bound_search_op(), compare_op,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief The same as \p upper_bound but needles must be sorted by \p compare_op.
+///
+/// See \p lower_bound_sorted_needles.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class NeedlesIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t upper_bound_sorted_needles(void * temporary_storage,
+                                      size_t& storage_size,
+                                      HaystackIterator haystack,
+                                      NeedlesIterator needles,
+                                      OutputIterator output,
+                                      size_t haystack_size,
+                                      size_t needles_size,
+                                      CompareFunction compare_op = CompareFunction(),
+                                      hipStream_t stream = 0,
+                                      bool debug_synchronous = false)
+{
+    return detail::sorted_search<Config>(
+        temporary_storage, storage_size,
+        haystack, needles, output,
+        haystack_size, needles_size,
+        detail::upper_bound_search_op(), compare_op,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Search index of a sorted haystack for repeated searches.
+///
+/// The index stores elements of the haystack in Eytzinger (breadth-first) order of a perfect
+/// binary search tree: the root, then 2 elements of the second level, 4 elements of the third
+/// level and so on. Hence probes of the top levels are close to each other in memory and are
+/// shared by all needles; \p lower_bound and \p upper_bound which consume the index load
+/// these levels into shared memory once per block.
+///
+/// \p values must point to \p search_index_size(haystack_size) elements, they are filled by
+/// \p build_search_index.
+template<class T>
+struct search_index
+{
+    /// Elements of the index.
+    T * values;
+    /// Size of the haystack (not the index).
+    size_t haystack_size;
+};
+
+/// \brief Returns a \p search_index of a haystack of \p haystack_size elements stored in
+/// \p values.
+template<class T>
+inline
+search_index<T> make_search_index(T * values, size_t haystack_size)
+{
+    return search_index<T> { values, haystack_size };
+}
+
+/// \brief Returns the number of elements of \p search_index for a haystack of
+/// \p haystack_size elements, it is less than 2 * \p haystack_size.
+inline
+size_t search_index_size(size_t haystack_size)
+{
+    return (size_t(1) << detail::search_index_levels(haystack_size)) - 1;
+}
+
+/// \brief Builds a search index of a sorted haystack.
+///
+/// The index must be rebuilt when the haystack is changed; it does not reference the haystack
+/// so the haystack can be freed after the index is built.
+template<
+    class Config = default_config,
+    class HaystackIterator,
+    class T
+>
+inline
+hipError_t build_search_index(void * temporary_storage,
+                              size_t& storage_size,
+                              HaystackIterator haystack,
+                              search_index<T> index,
+                              hipStream_t stream = 0,
+                              bool debug_synchronous = false)
+{
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, otherwise
+        // user may again pass nullptr as temporary_storage
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    const size_t haystack_size = index.haystack_size;
+    const unsigned int levels = detail::search_index_levels(haystack_size);
+    const size_t index_size = search_index_size(haystack_size);
+    if(index_size == 0)
+    {
+        return hipSuccess;
+    }
+
+    return transform<Config>(
+        ::rocprim::counting_iterator<size_t>(1), index.values,
+        index_size,
+        [haystack, haystack_size, levels]
+        ROCPRIM_DEVICE
+        (const size_t k)
+        {
+            // Padding nodes store the largest element
+            return haystack[::rocprim::min(detail::search_index_rank(k, levels), haystack_size - 1)];
+        },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief The same as \p lower_bound but the haystack is represented by \p search_index built
+/// by \p build_search_index. \p compare_op must be the order of the haystack.
+/// \p Config can be \p search_index_config.
+template<
+    class Config = default_config,
+    class T,
+    class NeedlesIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t lower_bound(void * temporary_storage,
+                       size_t& storage_size,
+                       search_index<T> index,
+                       NeedlesIterator needles,
+                       OutputIterator output,
+                       size_t needles_size,
+                       CompareFunction compare_op = CompareFunction(),
+                       hipStream_t stream = 0,
+                       bool debug_synchronous = false)
+{
+    return detail::indexed_search<Config>(
+        temporary_storage, storage_size,
+        index.values, index.haystack_size,
+        needles, output, needles_size,
+        detail::lower_bound_search_op(), compare_op,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief The same as \p upper_bound but the haystack is represented by \p search_index built
+/// by \p build_search_index. See \p lower_bound with \p search_index.
+template<
+    class Config = default_config,
+    class T,
+    class NeedlesIterator,
+    class OutputIterator,
+    class CompareFunction = ::rocprim::less<>
+>
+inline
+hipError_t upper_bound(void * temporary_storage,
+                       size_t& storage_size,
+                       search_index<T> index,
+                       NeedlesIterator needles,
+                       OutputIterator output,
+                       size_t needles_size,
+                       CompareFunction compare_op = CompareFunction(),
+                       hipStream_t stream = 0,
+                       bool debug_synchronous = false)
+{
+    return detail::indexed_search<Config>(
+        temporary_storage, storage_size,
+        index.values, index.haystack_size,
+        needles, output, needles_size,
+        detail::upper_bound_search_op(), compare_op,
+        stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
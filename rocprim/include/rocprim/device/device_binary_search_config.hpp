@@ -0,0 +1,143 @@
+// Copyright (c) 2019 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BINARY_SEARCH_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BINARY_SEARCH_CONFIG_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Configuration of device-level search primitives with sorted needles
+/// (\p lower_bound_sorted_needles and \p upper_bound_sorted_needles).
+///
+/// \p BlockSize * \p ItemsPerThread is the number of haystack elements and needles processed
+/// by one block, haystack elements are stored in shared memory.
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+using sorted_search_config = kernel_config<BlockSize, ItemsPerThread>;
+
+/// \brief Configuration of device-level search primitives which use a search index
+/// (\p lower_bound and \p upper_bound with \p search_index).
+///
+/// \tparam BlockSize - number of threads in a block.
+/// \tparam ItemsPerThread - number of needles processed by each thread.
+/// \tparam SharedLevels - number of top levels of the index which are loaded into shared memory
+/// by each block, i.e. (2^SharedLevels - 1) elements. Larger values reduce the number of global
+/// memory probes per needle but increase the cost of loading the index by each block.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int SharedLevels
+>
+struct search_index_config
+{
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    static constexpr unsigned int block_size = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+    static constexpr unsigned int shared_levels = SharedLevels;
+#endif
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int SharedLevels>
+constexpr unsigned int
+search_index_config<BlockSize, ItemsPerThread, SharedLevels>::block_size;
+template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int SharedLevels>
+constexpr unsigned int
+search_index_config<BlockSize, ItemsPerThread, SharedLevels>::items_per_thread;
+template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int SharedLevels>
+constexpr unsigned int
+search_index_config<BlockSize, ItemsPerThread, SharedLevels>::shared_levels;
+#endif
+
+namespace detail
+{
+
+template<class Value>
+struct sorted_search_config_803
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Value), sizeof(int));
+
+    using type = sorted_search_config<256, ::rocprim::max(1u, 8u / item_scale)>;
+};
+
+template<class Value>
+struct sorted_search_config_900
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Value), sizeof(int));
+
+    using type = sorted_search_config<256, ::rocprim::max(1u, 8u / item_scale)>;
+};
+
+template<unsigned int TargetArch, class Value>
+struct default_sorted_search_config
+    : select_arch<
+        TargetArch,
+        select_arch_case<803, sorted_search_config_803<Value>>,
+        select_arch_case<900, sorted_search_config_900<Value>>,
+        sorted_search_config_900<Value>
+    > { };
+
+template<class Value>
+struct search_index_config_803
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Value), sizeof(int));
+
+    // 4 KB of shared memory for 4-byte values
+    using type = search_index_config<256, 8, (item_scale >= 4 ? 8 : (item_scale >= 2 ? 9 : 10))>;
+};
+
+template<class Value>
+struct search_index_config_900
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Value), sizeof(int));
+
+    using type = search_index_config<256, 8, (item_scale >= 4 ? 8 : (item_scale >= 2 ? 9 : 10))>;
+};
+
+template<unsigned int TargetArch, class Value>
+struct default_search_index_config
+    : select_arch<
+        TargetArch,
+        select_arch_case<803, search_index_config_803<Value>>,
+        select_arch_case<900, search_index_config_900<Value>>,
+        search_index_config_900<Value>
+    > { };
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DEVICE_BINARY_SEARCH_CONFIG_HPP_
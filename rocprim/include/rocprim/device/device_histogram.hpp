@@ -24,12 +24,14 @@
 #include <cmath>
 #include <type_traits>
 #include <iterator>
+#include <limits>
 
 #include "../config.hpp"
 #include "../functional.hpp"
 #include "../detail/various.hpp"
 
 #include "device_histogram_config.hpp"
+#include "device_radix_sort.hpp"
 #include "detail/device_histogram.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -58,26 +60,32 @@ template<
     unsigned int Channels,
     unsigned int ActiveChannels,
     class SampleIterator,
+    class Weights,
     class Counter,
     class SampleToBinOp
 >
 __global__
 void histogram_shared_kernel(SampleIterator samples,
+                             Weights weights,
                              unsigned int columns,
                              unsigned int rows,
                              unsigned int row_stride,
                              unsigned int rows_per_block,
+                             unsigned int histograms,
                              fixed_array<Counter *, ActiveChannels> histogram,
                              fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
                              fixed_array<unsigned int, ActiveChannels> bins)
 {
-    HIP_DYNAMIC_SHARED(unsigned int, block_histogram);
+    using bin_counter_type = typename histogram_bin_counter<Weights, Counter>::type;
+
+    // The same declaration is used for all bin counter types (their size is at most 8 bytes)
+    HIP_DYNAMIC_SHARED(unsigned long long, block_histogram);
 
     histogram_shared<BlockSize, ItemsPerThread, Channels, ActiveChannels>(
-        samples, columns, rows, row_stride, rows_per_block,
+        samples, weights, columns, rows, row_stride, rows_per_block, histograms,
         histogram,
         sample_to_bin_op, bins,
-        block_histogram
+        reinterpret_cast<bin_counter_type *>(block_histogram)
     );
 }
 
@@ -105,6 +113,160 @@ void histogram_global_kernel(SampleIterator samples,
     );
 }
 
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    unsigned int ActiveChannels,
+    class SampleIterator,
+    class WeightIterator,
+    class Counter,
+    class SampleToBinOp
+>
+__global__
+void histogram_global_weighted_kernel(SampleIterator samples,
+                                      WeightIterator weights,
+                                      unsigned int columns,
+                                      unsigned int row_stride,
+                                      fixed_array<Counter *, ActiveChannels> histogram,
+                                      fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op)
+{
+    histogram_global_weighted<BlockSize, ItemsPerThread, Channels, ActiveChannels>(
+        samples, weights, columns, row_stride,
+        histogram,
+        sample_to_bin_op
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    unsigned int ActiveChannels,
+    class SampleIterator,
+    class SampleToBinOp
+>
+__global__
+void histogram_sort_keys_kernel(SampleIterator samples,
+                                unsigned int columns,
+                                unsigned int row_stride,
+                                fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                                fixed_array<unsigned int, ActiveChannels> bins,
+                                unsigned int * keys)
+{
+    histogram_sort_keys<BlockSize, ItemsPerThread, Channels, ActiveChannels>(
+        samples, columns, row_stride,
+        sample_to_bin_op, bins,
+        keys
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ActiveChannels,
+    class Counter
+>
+__global__
+void histogram_sort_count_kernel(const unsigned int * sorted_keys,
+                                 unsigned int size,
+                                 fixed_array<Counter *, ActiveChannels> histogram,
+                                 fixed_array<unsigned int, ActiveChannels> bins)
+{
+    histogram_sort_count<BlockSize, ActiveChannels>(sorted_keys, size, histogram, bins);
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class SampleIterator,
+    class OffsetIterator,
+    class Counter,
+    class SampleToBinOp
+>
+__global__
+void segmented_histogram_kernel(SampleIterator samples,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                Counter * histogram,
+                                SampleToBinOp sample_to_bin_op,
+                                unsigned int bins,
+                                unsigned int histograms)
+{
+    HIP_DYNAMIC_SHARED(unsigned long long, block_histogram);
+
+    segmented_histogram<BlockSize, ItemsPerThread>(
+        samples, begin_offsets, end_offsets,
+        histogram,
+        sample_to_bin_op, bins, histograms,
+        reinterpret_cast<unsigned int *>(block_histogram)
+    );
+}
+
+// Launches the global memory implementation: ballot-aggregated counting for not weighted
+// histograms or pre-aggregated runs of weights for weighted histograms.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    unsigned int ActiveChannels,
+    class SampleIterator,
+    class Counter,
+    class SampleToBinOp
+>
+inline
+void launch_histogram_global(dim3 grid_size,
+                             hipStream_t stream,
+                             SampleIterator samples,
+                             unit_weights /* weights */,
+                             unsigned int columns,
+                             unsigned int row_stride,
+                             fixed_array<Counter *, ActiveChannels> histogram,
+                             fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                             fixed_array<unsigned int, ActiveChannels> bins_bits)
+{
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(histogram_global_kernel<
+            BlockSize, ItemsPerThread, Channels, ActiveChannels
+        >),
+        grid_size, dim3(BlockSize, 1), 0, stream,
+        samples, columns, row_stride,
+        histogram,
+        sample_to_bin_op, bins_bits
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int Channels,
+    unsigned int ActiveChannels,
+    class SampleIterator,
+    class WeightIterator,
+    class Counter,
+    class SampleToBinOp
+>
+inline
+void launch_histogram_global(dim3 grid_size,
+                             hipStream_t stream,
+                             SampleIterator samples,
+                             WeightIterator weights,
+                             unsigned int columns,
+                             unsigned int row_stride,
+                             fixed_array<Counter *, ActiveChannels> histogram,
+                             fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                             fixed_array<unsigned int, ActiveChannels> /* bins_bits */)
+{
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(histogram_global_weighted_kernel<
+            BlockSize, ItemsPerThread, Channels, ActiveChannels
+        >),
+        grid_size, dim3(BlockSize, 1), 0, stream,
+        samples, weights, columns, row_stride,
+        histogram,
+        sample_to_bin_op
+    );
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
     { \
         auto error = hipPeekAtLastError(); \
@@ -125,6 +287,7 @@ template<
     unsigned int ActiveChannels,
     class Config,
     class SampleIterator,
+    class Weights,
     class Counter,
     class SampleToBinOp
 >
@@ -132,6 +295,7 @@ inline
 hipError_t histogram_impl(void * temporary_storage,
                           size_t& storage_size,
                           SampleIterator samples,
+                          Weights weights,
                           unsigned int columns,
                           unsigned int rows,
                           size_t row_stride_bytes,
@@ -142,6 +306,7 @@ hipError_t histogram_impl(void * temporary_storage,
                           bool debug_synchronous)
 {
     using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+    using bin_counter_type = typename histogram_bin_counter<Weights, Counter>::type;
 
     using config = default_or_custom_config<
         Config,
@@ -151,6 +316,14 @@ hipError_t histogram_impl(void * temporary_storage,
     constexpr unsigned int block_size = config::histogram::block_size;
     constexpr unsigned int items_per_thread = config::histogram::items_per_thread;
     constexpr unsigned int items_per_block = block_size * items_per_thread;
+    constexpr bool is_weighted = !std::is_same<Weights, unit_weights>::value;
+    // shared_impl_max_bins is specified for unsigned int counters, bins of weighted histograms
+    // may be larger (e.g. double), the same amount of shared memory is used
+    constexpr unsigned int shared_impl_max_bins =
+        config::shared_impl_max_bins * sizeof(unsigned int) / sizeof(bin_counter_type);
+    constexpr unsigned int shared_impl_histograms =
+        select_config_shared_impl_histograms<config>::value;
+    constexpr unsigned int sort_impl_min_bins = select_config_sort_impl_min_bins<config>::value;
 
     if(row_stride_bytes % sizeof(sample_type) != 0)
     {
@@ -161,11 +334,51 @@ hipError_t histogram_impl(void * temporary_storage,
     const unsigned int blocks_x = ::rocprim::detail::ceiling_div(columns, items_per_block);
     const unsigned int row_stride = row_stride_bytes / sizeof(sample_type);
 
+    unsigned int bins[ActiveChannels];
+    unsigned int bins_bits[ActiveChannels];
+    unsigned int total_bins = 0;
+    unsigned int max_bins = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        bins[channel] = levels[channel] - 1;
+        bins_bits[channel] = static_cast<unsigned int>(std::log2(detail::next_power_of_two(bins[channel])));
+        total_bins += bins[channel];
+        max_bins = std::max(max_bins, bins[channel]);
+    }
+
+    // Keys of the sort-based implementation are bins of all samples of active channels
+    const size_t keys_count = static_cast<size_t>(columns) * rows * ActiveChannels;
+    // Weights are not supported by the sort-based implementation
+    const bool use_sort_impl =
+        !is_weighted
+        && total_bins > shared_impl_max_bins
+        && total_bins >= sort_impl_min_bins
+        && keys_count >= sort_impl_min_bins
+        && keys_count <= std::numeric_limits<unsigned int>::max();
+    // Keys are in [0, total_bins], total_bins is used for samples outside of histogram ranges
+    const unsigned int keys_bits =
+        static_cast<unsigned int>(std::log2(detail::next_power_of_two(total_bins + 1)));
+
+    size_t keys_bytes = 0;
+    size_t sort_storage_bytes = 0;
+    if(use_sort_impl)
+    {
+        keys_bytes = ::rocprim::detail::align_size(keys_count * sizeof(unsigned int));
+        double_buffer<unsigned int> keys;
+        hipError_t error = ::rocprim::radix_sort_keys(
+            nullptr, sort_storage_bytes,
+            keys, keys_count,
+            0, keys_bits,
+            stream, debug_synchronous
+        );
+        if(error != hipSuccess) return error;
+    }
+
     if(temporary_storage == nullptr)
     {
         // Make sure user won't try to allocate 0 bytes memory, because
         // hipMalloc will return nullptr.
-        storage_size = 4;
+        storage_size = use_sort_impl ? 2 * keys_bytes + sort_storage_bytes : 4;
         return hipSuccess;
     }
 
@@ -178,18 +391,6 @@ hipError_t histogram_impl(void * temporary_storage,
         if(error != hipSuccess) return error;
     }
 
-    unsigned int bins[ActiveChannels];
-    unsigned int bins_bits[ActiveChannels];
-    unsigned int total_bins = 0;
-    unsigned int max_bins = 0;
-    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
-    {
-        bins[channel] = levels[channel] - 1;
-        bins_bits[channel] = static_cast<unsigned int>(std::log2(detail::next_power_of_two(bins[channel])));
-        total_bins += bins[channel];
-        max_bins = std::max(max_bins, bins[channel]);
-    }
-
     std::chrono::high_resolution_clock::time_point start;
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
@@ -206,12 +407,19 @@ hipError_t histogram_impl(void * temporary_storage,
         return hipSuccess;
     }
 
-    if(total_bins <= config::shared_impl_max_bins)
+    if(total_bins <= shared_impl_max_bins)
     {
         dim3 grid_size;
         grid_size.x = std::min(config::max_grid_size, blocks_x);
         grid_size.y = std::min(rows, config::max_grid_size / grid_size.x);
-        const size_t block_histogram_bytes = total_bins * sizeof(unsigned int);
+        // Privatized copies of the histogram must fit in shared_impl_max_bins
+        const unsigned int histogram_stride = get_block_histogram_stride(total_bins);
+        const unsigned int histograms = std::max(1u, std::min(
+            shared_impl_histograms,
+            shared_impl_max_bins / histogram_stride
+        ));
+        const size_t block_histogram_bytes =
+            histograms * histogram_stride * sizeof(bin_counter_type);
         const unsigned int rows_per_block = ::rocprim::detail::ceiling_div(rows, grid_size.y);
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
         hipLaunchKernelGGL(
@@ -219,22 +427,60 @@ hipError_t histogram_impl(void * temporary_storage,
                 block_size, items_per_thread, Channels, ActiveChannels
             >),
             grid_size, dim3(block_size, 1), block_histogram_bytes, stream,
-            samples, columns, rows, row_stride, rows_per_block,
+            samples, weights, columns, rows, row_stride, rows_per_block, histograms,
             fixed_array<Counter *, ActiveChannels>(histogram),
             fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
             fixed_array<unsigned int, ActiveChannels>(bins)
         );
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_shared", grid_size.x * grid_size.y * block_size, start);
     }
-    else
+    else if(use_sort_impl)
     {
+        char * ptr = reinterpret_cast<char *>(temporary_storage);
+        unsigned int * keys_input = reinterpret_cast<unsigned int *>(ptr);
+        ptr += keys_bytes;
+        unsigned int * keys_alternate = reinterpret_cast<unsigned int *>(ptr);
+        ptr += keys_bytes;
+        void * sort_storage = ptr;
+
         if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(histogram_global_kernel<
+            HIP_KERNEL_NAME(histogram_sort_keys_kernel<
                 block_size, items_per_thread, Channels, ActiveChannels
             >),
             dim3(blocks_x, rows), dim3(block_size, 1), 0, stream,
             samples, columns, row_stride,
+            fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
+            fixed_array<unsigned int, ActiveChannels>(bins),
+            keys_input
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_sort_keys", keys_count, start);
+
+        double_buffer<unsigned int> keys(keys_input, keys_alternate);
+        hipError_t error = ::rocprim::radix_sort_keys(
+            sort_storage, sort_storage_bytes,
+            keys, keys_count,
+            0, keys_bits,
+            stream, debug_synchronous
+        );
+        if(error != hipSuccess) return error;
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(histogram_sort_count_kernel<block_size, ActiveChannels>),
+            dim3(::rocprim::detail::ceiling_div<size_t>(keys_count, block_size)), dim3(block_size), 0, stream,
+            keys.current(), static_cast<unsigned int>(keys_count),
+            fixed_array<Counter *, ActiveChannels>(histogram),
+            fixed_array<unsigned int, ActiveChannels>(bins)
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_sort_count", keys_count, start);
+    }
+    else
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        launch_histogram_global<block_size, items_per_thread, Channels, ActiveChannels>(
+            dim3(blocks_x, rows), stream,
+            samples, weights, columns, row_stride,
             fixed_array<Counter *, ActiveChannels>(histogram),
             fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
             fixed_array<unsigned int, ActiveChannels>(bins_bits)
@@ -250,6 +496,7 @@ template<
     unsigned int ActiveChannels,
     class Config,
     class SampleIterator,
+    class Weights,
     class Counter,
     class Level
 >
@@ -257,6 +504,7 @@ inline
 hipError_t histogram_even_impl(void * temporary_storage,
                                size_t& storage_size,
                                SampleIterator samples,
+                               Weights weights,
                                unsigned int columns,
                                unsigned int rows,
                                size_t row_stride_bytes,
@@ -287,7 +535,7 @@ hipError_t histogram_even_impl(void * temporary_storage,
 
     return histogram_impl<Channels, ActiveChannels, Config>(
         temporary_storage, storage_size,
-        samples, columns, rows, row_stride_bytes,
+        samples, weights, columns, rows, row_stride_bytes,
         histogram,
         levels, sample_to_bin_op,
         stream, debug_synchronous
@@ -299,6 +547,7 @@ template<
     unsigned int ActiveChannels,
     class Config,
     class SampleIterator,
+    class Weights,
     class Counter,
     class Level
 >
@@ -306,6 +555,7 @@ inline
 hipError_t histogram_range_impl(void * temporary_storage,
                                 size_t& storage_size,
                                 SampleIterator samples,
+                                Weights weights,
                                 unsigned int columns,
                                 unsigned int rows,
                                 size_t row_stride_bytes,
@@ -335,13 +585,162 @@ hipError_t histogram_range_impl(void * temporary_storage,
 
     return histogram_impl<Channels, ActiveChannels, Config>(
         temporary_storage, storage_size,
-        samples, columns, rows, row_stride_bytes,
+        samples, weights, columns, rows, row_stride_bytes,
         histogram,
         levels, sample_to_bin_op,
         stream, debug_synchronous
     );
 }
 
+template<
+    class Config,
+    class SampleIterator,
+    class Counter,
+    class OffsetIterator,
+    class SampleToBinOp
+>
+inline
+hipError_t segmented_histogram_impl(void * temporary_storage,
+                                    size_t& storage_size,
+                                    SampleIterator samples,
+                                    Counter * histogram,
+                                    unsigned int segments,
+                                    OffsetIterator begin_offsets,
+                                    OffsetIterator end_offsets,
+                                    unsigned int levels,
+                                    SampleToBinOp sample_to_bin_op,
+                                    hipStream_t stream,
+                                    bool debug_synchronous)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+
+    using config = default_or_custom_config<
+        Config,
+        default_histogram_config<ROCPRIM_TARGET_ARCH, sample_type, 1, 1>
+    >;
+
+    constexpr unsigned int block_size = config::histogram::block_size;
+    constexpr unsigned int items_per_thread = config::histogram::items_per_thread;
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr.
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(segments == 0)
+    {
+        return hipSuccess;
+    }
+
+    const unsigned int bins = levels - 1;
+    // Privatized copies of the histogram must fit in shared_impl_max_bins,
+    // bins of larger histograms are accumulated in global memory
+    const unsigned int histogram_stride = get_block_histogram_stride(bins);
+    const unsigned int histograms = bins <= config::shared_impl_max_bins
+        ? std::max(1u, std::min(
+            select_config_shared_impl_histograms<config>::value,
+            config::shared_impl_max_bins / histogram_stride
+          ))
+        : 0u;
+    const size_t block_histogram_bytes = histograms * histogram_stride * sizeof(unsigned int);
+
+    if(debug_synchronous)
+    {
+        std::cout << "segments " << segments << '\n';
+        std::cout << "histograms " << histograms << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(segmented_histogram_kernel<block_size, items_per_thread>),
+        dim3(segments), dim3(block_size), block_histogram_bytes, stream,
+        samples, begin_offsets, end_offsets,
+        histogram,
+        sample_to_bin_op, bins, histograms
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_histogram", segments, start);
+
+    return hipSuccess;
+}
+
+template<
+    class Config,
+    class SampleIterator,
+    class Counter,
+    class OffsetIterator,
+    class Level
+>
+inline
+hipError_t segmented_histogram_even_impl(void * temporary_storage,
+                                         size_t& storage_size,
+                                         SampleIterator samples,
+                                         Counter * histogram,
+                                         unsigned int segments,
+                                         OffsetIterator begin_offsets,
+                                         OffsetIterator end_offsets,
+                                         unsigned int levels,
+                                         Level lower_level,
+                                         Level upper_level,
+                                         hipStream_t stream,
+                                         bool debug_synchronous)
+{
+    if(levels < 2)
+    {
+        // Histogram must have at least 1 bin
+        return hipErrorInvalidValue;
+    }
+
+    return segmented_histogram_impl<Config>(
+        temporary_storage, storage_size,
+        samples, histogram,
+        segments, begin_offsets, end_offsets,
+        levels, sample_to_bin_even<Level>(levels - 1, lower_level, upper_level),
+        stream, debug_synchronous
+    );
+}
+
+template<
+    class Config,
+    class SampleIterator,
+    class Counter,
+    class OffsetIterator,
+    class Level
+>
+inline
+hipError_t segmented_histogram_range_impl(void * temporary_storage,
+                                          size_t& storage_size,
+                                          SampleIterator samples,
+                                          Counter * histogram,
+                                          unsigned int segments,
+                                          OffsetIterator begin_offsets,
+                                          OffsetIterator end_offsets,
+                                          unsigned int levels,
+                                          Level * level_values,
+                                          hipStream_t stream,
+                                          bool debug_synchronous)
+{
+    if(levels < 2)
+    {
+        // Histogram must have at least 1 bin
+        return hipErrorInvalidValue;
+    }
+
+    return segmented_histogram_impl<Config>(
+        temporary_storage, storage_size,
+        samples, histogram,
+        segments, begin_offsets, end_offsets,
+        levels, sample_to_bin_range<Level>(levels - 1, level_values),
+        stream, debug_synchronous
+    );
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // end of detail namespace
@@ -440,7 +839,7 @@ hipError_t histogram_even(void * temporary_storage,
 
     return detail::histogram_even_impl<1, 1, Config>(
         temporary_storage, storage_size,
-        samples, size, 1, 0,
+        samples, detail::unit_weights(), size, 1, 0,
         histogram_single,
         levels_single, lower_level_single, upper_level_single,
         stream, debug_synchronous
@@ -551,7 +950,7 @@ hipError_t histogram_even(void * temporary_storage,
 
     return detail::histogram_even_impl<1, 1, Config>(
         temporary_storage, storage_size,
-        samples, columns, rows, row_stride_bytes,
+        samples, detail::unit_weights(), columns, rows, row_stride_bytes,
         histogram_single,
         levels_single, lower_level_single, upper_level_single,
         stream, debug_synchronous
@@ -658,7 +1057,7 @@ hipError_t multi_histogram_even(void * temporary_storage,
 {
     return detail::histogram_even_impl<Channels, ActiveChannels, Config>(
         temporary_storage, storage_size,
-        samples, size, 1, 0,
+        samples, detail::unit_weights(), size, 1, 0,
         histogram,
         levels, lower_level, upper_level,
         stream, debug_synchronous
@@ -775,7 +1174,7 @@ hipError_t multi_histogram_even(void * temporary_storage,
 {
     return detail::histogram_even_impl<Channels, ActiveChannels, Config>(
         temporary_storage, storage_size,
-        samples, columns, rows, row_stride_bytes,
+        samples, detail::unit_weights(), columns, rows, row_stride_bytes,
         histogram,
         levels, lower_level, upper_level,
         stream, debug_synchronous
@@ -871,7 +1270,7 @@ hipError_t histogram_range(void * temporary_storage,
 
     return detail::histogram_range_impl<1, 1, Config>(
         temporary_storage, storage_size,
-        samples, size, 1, 0,
+        samples, detail::unit_weights(), size, 1, 0,
         histogram_single,
         levels_single, level_values_single,
         stream, debug_synchronous
@@ -977,7 +1376,7 @@ hipError_t histogram_range(void * temporary_storage,
 
     return detail::histogram_range_impl<1, 1, Config>(
         temporary_storage, storage_size,
-        samples, columns, rows, row_stride_bytes,
+        samples, detail::unit_weights(), columns, rows, row_stride_bytes,
         histogram_single,
         levels_single, level_values_single,
         stream, debug_synchronous
@@ -1079,7 +1478,7 @@ hipError_t multi_histogram_range(void * temporary_storage,
 {
     return detail::histogram_range_impl<Channels, ActiveChannels, Config>(
         temporary_storage, storage_size,
-        samples, size, 1, 0,
+        samples, detail::unit_weights(), size, 1, 0,
         histogram,
         levels, level_values,
         stream, debug_synchronous
@@ -1192,13 +1591,601 @@ hipError_t multi_histogram_range(void * temporary_storage,
 {
     return detail::histogram_range_impl<Channels, ActiveChannels, Config>(
         temporary_storage, storage_size,
-        samples, columns, rows, row_stride_bytes,
+        samples, detail::unit_weights(), columns, rows, row_stride_bytes,
         histogram,
         levels, level_values,
         stream, debug_synchronous
     );
 }
 
+/// \brief Computes a weighted histogram from a sequence of samples using equal-width bins.
+///
+/// \par
+/// * Each sample adds its weight (instead of 1) to the bin it falls into.
+/// * The number of histogram bins is (\p levels - 1).
+/// * Bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level - \p lower_level) / (\p levels - 1).
+/// * Weights are accumulated using atomic operations so the result of floating-point counters
+/// may differ between runs due to the order of additions.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - type for histogram bin counters: \p float, \p double, \p int,
+/// \p unsigned \p int or \p unsigned \p long \p long.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] weights - iterator to the first element in the range of weights of samples.
+/// \param [in] size - number of elements in the samples and weights ranges.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level weighted histogram of 5 bins is computed on an array of float samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 8
+/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
+/// float * weights;          // e.g., [1.0, 2.0, 0.5, 1.0, 1.0, 0.25, 3.0, 2.0]
+/// float * histogram;        // empty array of at least 5 elements
+/// unsigned int levels;      // e.g., 6 (for 5 bins)
+/// float lower_level;        // e.g., 0.0
+/// float upper_level;        // e.g., 10.0
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::weighted_histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histogram
+/// rocprim::weighted_histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [3.25, 0.0, 2.0, 0.0, 1.5]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class SampleIterator,
+    class WeightIterator,
+    class Counter,
+    class Level
+>
+inline
+hipError_t weighted_histogram_even(void * temporary_storage,
+                                   size_t& storage_size,
+                                   SampleIterator samples,
+                                   WeightIterator weights,
+                                   unsigned int size,
+                                   Counter * histogram,
+                                   unsigned int levels,
+                                   Level lower_level,
+                                   Level upper_level,
+                                   hipStream_t stream = 0,
+                                   bool debug_synchronous = false)
+{
+    Counter * histogram_single[1] = { histogram };
+    unsigned int levels_single[1] = { levels };
+    Level lower_level_single[1] = { lower_level };
+    Level upper_level_single[1] = { upper_level };
+
+    return detail::histogram_even_impl<1, 1, Config>(
+        temporary_storage, storage_size,
+        samples, weights, size, 1, 0,
+        histogram_single,
+        levels_single, lower_level_single, upper_level_single,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Computes weighted histograms from a sequence of multi-channel samples using equal-width bins.
+///
+/// \par
+/// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
+/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
+/// * Each pixel has one weight which is added to bins of all active channels.
+/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
+/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
+/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
+/// * For channel<sub><em>i</em></sub> bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level[i] - \p lower_level[i]) / (\p levels[i] - 1).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Channels - number of channels interleaved in the input samples.
+/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - type for histogram bin counters: \p float, \p double, \p int,
+/// \p unsigned \p int or \p unsigned \p long \p long.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] weights - iterator to the first element in the range of weights of pixels.
+/// \param [in] size - number of pixels in the samples range and number of elements in the weights range.
+/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin in each active channel.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin in each active channel.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example weighted histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 4
+/// unsigned char * samples;  // e.g., [(3, 1, 5, 255), (3, 1, 5, 255), (4, 2, 6, 127), (0, 0, 0, 100)]
+/// float * weights;          // e.g., [0.5, 1.0, 2.0, 0.25]
+/// float * histogram[3];     // 3 empty arrays of at least 256 elements each
+/// unsigned int levels[3];   // e.g., [257, 257, 257] (for 256 bins)
+/// int lower_level[3];       // e.g., [0, 0, 0]
+/// int upper_level[3];       // e.g., [256, 256, 256]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::weighted_multi_histogram_even<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histograms
+/// rocprim::weighted_multi_histogram_even<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [[0.25, 0.0, 0.0, 1.5, 2.0, 0.0, 0.0, ..., 0.0],
+/// //             [0.25, 1.5, 2.0, 0.0, 0.0, 0.0, 0.0, ..., 0.0],
+/// //             [0.25, 0.0, 0.0, 0.0, 0.0, 1.5, 2.0, ..., 0.0]]
+/// \endcode
+/// \endparblock
+template<
+    unsigned int Channels,
+    unsigned int ActiveChannels,
+    class Config = default_config,
+    class SampleIterator,
+    class WeightIterator,
+    class Counter,
+    class Level
+>
+inline
+hipError_t weighted_multi_histogram_even(void * temporary_storage,
+                                         size_t& storage_size,
+                                         SampleIterator samples,
+                                         WeightIterator weights,
+                                         unsigned int size,
+                                         Counter * histogram[ActiveChannels],
+                                         unsigned int levels[ActiveChannels],
+                                         Level lower_level[ActiveChannels],
+                                         Level upper_level[ActiveChannels],
+                                         hipStream_t stream = 0,
+                                         bool debug_synchronous = false)
+{
+    return detail::histogram_even_impl<Channels, ActiveChannels, Config>(
+        temporary_storage, storage_size,
+        samples, weights, size, 1, 0,
+        histogram,
+        levels, lower_level, upper_level,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Computes a weighted histogram from a sequence of samples using the specified bin boundary levels.
+///
+/// \par
+/// * Each sample adds its weight (instead of 1) to the bin it falls into.
+/// * The number of histogram bins is (\p levels - 1).
+/// * The range for bin<sub><em>j</em></sub> is [<tt>level_values[j]</tt>, <tt>level_values[j+1]</tt>).
+/// * Weights are accumulated using atomic operations so the result of floating-point counters
+/// may differ between runs due to the order of additions.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - type for histogram bin counters: \p float, \p double, \p int,
+/// \p unsigned \p int or \p unsigned \p long \p long.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] weights - iterator to the first element in the range of weights of samples.
+/// \param [in] size - number of elements in the samples and weights ranges.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] level_values - pointer to the array of bin boundaries.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level weighted histogram of 5 bins is computed on an array of float samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 8
+/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
+/// float * weights;          // e.g., [1.0, 2.0, 0.5, 1.0, 1.0, 0.25, 3.0, 2.0]
+/// double * histogram;       // empty array of at least 5 elements
+/// unsigned int levels;      // e.g., 6 (for 5 bins)
+/// float * level_values;     // e.g., [0.0, 1.0, 5.0, 10.0, 20.0, 50.0]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::weighted_histogram_range(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, level_values
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histogram
+/// rocprim::weighted_histogram_range(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, weights, size,
+///     histogram, levels, level_values
+/// );
+/// // histogram: [2.0, 1.25, 3.5, 0.0, 0.0]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class SampleIterator,
+    class WeightIterator,
+    class Counter,
+    class Level
+>
+inline
+hipError_t weighted_histogram_range(void * temporary_storage,
+                                    size_t& storage_size,
+                                    SampleIterator samples,
+                                    WeightIterator weights,
+                                    unsigned int size,
+                                    Counter * histogram,
+                                    unsigned int levels,
+                                    Level * level_values,
+                                    hipStream_t stream = 0,
+                                    bool debug_synchronous = false)
+{
+    Counter * histogram_single[1] = { histogram };
+    unsigned int levels_single[1] = { levels };
+    Level * level_values_single[1] = { level_values };
+
+    return detail::histogram_range_impl<1, 1, Config>(
+        temporary_storage, storage_size,
+        samples, weights, size, 1, 0,
+        histogram_single,
+        levels_single, level_values_single,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Computes weighted histograms from a sequence of multi-channel samples using the specified bin boundary levels.
+///
+/// \par
+/// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
+/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
+/// * Each pixel has one weight which is added to bins of all active channels.
+/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
+/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
+/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
+/// * For channel<sub><em>i</em></sub> the range for bin<sub><em>j</em></sub> is
+/// [<tt>level_values[i][j]</tt>, <tt>level_values[i][j+1]</tt>).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Channels - number of channels interleaved in the input samples.
+/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - type for histogram bin counters: \p float, \p double, \p int,
+/// \p unsigned \p int or \p unsigned \p long \p long.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] weights - iterator to the first element in the range of weights of pixels.
+/// \param [in] size - number of pixels in the samples range and number of elements in the weights range.
+/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] level_values - pointer to the array of bin boundaries for each active channel.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    unsigned int Channels,
+    unsigned int ActiveChannels,
+    class Config = default_config,
+    class SampleIterator,
+    class WeightIterator,
+    class Counter,
+    class Level
+>
+inline
+hipError_t weighted_multi_histogram_range(void * temporary_storage,
+                                          size_t& storage_size,
+                                          SampleIterator samples,
+                                          WeightIterator weights,
+                                          unsigned int size,
+                                          Counter * histogram[ActiveChannels],
+                                          unsigned int levels[ActiveChannels],
+                                          Level * level_values[ActiveChannels],
+                                          hipStream_t stream = 0,
+                                          bool debug_synchronous = false)
+{
+    return detail::histogram_range_impl<Channels, ActiveChannels, Config>(
+        temporary_storage, storage_size,
+        samples, weights, size, 1, 0,
+        histogram,
+        levels, level_values,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Computes histograms of segments of samples using equal-width bins.
+///
+/// \par
+/// * Segment <em>i</em> contains samples in range
+/// [<tt>samples + begin_offsets[i]</tt>, <tt>samples + end_offsets[i]</tt>),
+/// its histogram is stored to [<tt>histogram + i * (levels - 1)</tt>, <tt>histogram + (i + 1) * (levels - 1)</tt>).
+/// * Histograms of all segments are computed by one kernel launch (one block per segment), so it is
+/// much faster than calling \p histogram_even for each segment when segments are small
+/// (e.g. histograms of tiles of an image).
+/// * The number of histogram bins is (\p levels - 1).
+/// * Bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level - \p lower_level) / (\p levels - 1).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [out] histogram - pointer to the first element in the range of histograms
+/// of all segments (<tt>segments * (levels - 1)</tt> elements).
+/// \param [in] segments - number of segments.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example histograms of 4 bins are computed for 3 segments of int samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// int * samples;                // e.g., [0, 1, 1, 7, 2, 3, 5, 5, 6, 9]
+/// unsigned int * histogram;     // empty array of at least 3 * 4 elements
+/// unsigned int segments;        // e.g., 3
+/// unsigned int * begin_offsets; // e.g., [0, 4, 4]
+/// unsigned int * end_offsets;   // e.g., [4, 4, 10]
+/// unsigned int levels;          // e.g., 5 (for 4 bins)
+/// int lower_level;              // e.g., 0
+/// int upper_level;              // e.g., 8
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, histogram,
+///     segments, begin_offsets, end_offsets,
+///     levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histograms
+/// rocprim::segmented_histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, histogram,
+///     segments, begin_offsets, end_offsets,
+///     levels, lower_level, upper_level
+/// );
+/// // histogram: [3, 0, 0, 1,
+/// //             0, 0, 0, 0,
+/// //             0, 2, 2, 1]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class SampleIterator,
+    class Counter,
+    class OffsetIterator,
+    class Level
+>
+inline
+hipError_t segmented_histogram_even(void * temporary_storage,
+                                    size_t& storage_size,
+                                    SampleIterator samples,
+                                    Counter * histogram,
+                                    unsigned int segments,
+                                    OffsetIterator begin_offsets,
+                                    OffsetIterator end_offsets,
+                                    unsigned int levels,
+                                    Level lower_level,
+                                    Level upper_level,
+                                    hipStream_t stream = 0,
+                                    bool debug_synchronous = false)
+{
+    return detail::segmented_histogram_even_impl<Config>(
+        temporary_storage, storage_size,
+        samples, histogram,
+        segments, begin_offsets, end_offsets,
+        levels, lower_level, upper_level,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Computes histograms of segments of samples using the specified bin boundary levels.
+///
+/// \par
+/// * Segment <em>i</em> contains samples in range
+/// [<tt>samples + begin_offsets[i]</tt>, <tt>samples + end_offsets[i]</tt>),
+/// its histogram is stored to [<tt>histogram + i * (levels - 1)</tt>, <tt>histogram + (i + 1) * (levels - 1)</tt>).
+/// * Histograms of all segments are computed by one kernel launch (one block per segment), so it is
+/// much faster than calling \p histogram_range for each segment when segments are small.
+/// * The number of histogram bins is (\p levels - 1).
+/// * The range for bin<sub><em>j</em></sub> is [<tt>level_values[j]</tt>, <tt>level_values[j+1]</tt>).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p histogram_config or
+/// a custom class with the same members.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [out] histogram - pointer to the first element in the range of histograms
+/// of all segments (<tt>segments * (levels - 1)</tt> elements).
+/// \param [in] segments - number of segments.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] level_values - pointer to the array of bin boundaries.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class SampleIterator,
+    class Counter,
+    class OffsetIterator,
+    class Level
+>
+inline
+hipError_t segmented_histogram_range(void * temporary_storage,
+                                     size_t& storage_size,
+                                     SampleIterator samples,
+                                     Counter * histogram,
+                                     unsigned int segments,
+                                     OffsetIterator begin_offsets,
+                                     OffsetIterator end_offsets,
+                                     unsigned int levels,
+                                     Level * level_values,
+                                     hipStream_t stream = 0,
+                                     bool debug_synchronous = false)
+{
+    return detail::segmented_histogram_range_impl<Config>(
+        temporary_storage, storage_size,
+        samples, histogram,
+        segments, begin_offsets, end_offsets,
+        levels, level_values,
+        stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
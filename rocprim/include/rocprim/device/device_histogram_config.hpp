@@ -21,6 +21,7 @@
 #ifndef ROCPRIM_DEVICE_DEVICE_HISTOGRAM_CONFIG_HPP_
 #define ROCPRIM_DEVICE_DEVICE_HISTOGRAM_CONFIG_HPP_
 
+#include <limits>
 #include <type_traits>
 
 #include "../config.hpp"
@@ -40,10 +41,22 @@ BEGIN_ROCPRIM_NAMESPACE
 /// \tparam SharedImplMaxBins - maximum total number of bins for all active channels
 /// for the shared memory histogram implementation (samples -> shared memory bins -> global memory bins),
 /// when exceeded the global memory implementation is used (samples -> global memory bins).
+/// \tparam SharedImplHistograms - maximum number of privatized copies of the histogram in shared
+/// memory of each block for the shared memory implementation. Neighbouring threads update
+/// different copies, which reduces contention of atomic operations when many samples fall into
+/// the same bins (skewed distributions). Copies are merged at the end of the block. The number of
+/// copies used is limited so that all of them together have at most \p SharedImplMaxBins bins.
+/// \tparam SortImplMinBins - minimum total number of bins for all active channels for the sort-based
+/// implementation (samples -> sorted bin indices -> global memory bins), which is used instead of
+/// the global memory implementation when both the total number of bins and the total number
+/// of samples are not smaller than this value. In this case the histogram is too large for caches
+/// and atomic operations in global memory become much slower than sorting.
 template<
     class HistogramConfig,
     unsigned int MaxGridSize = 1024,
-    unsigned int SharedImplMaxBins = 2048
+    unsigned int SharedImplMaxBins = 2048,
+    unsigned int SharedImplHistograms = 4,
+    unsigned int SortImplMinBins = (1 << 20)
 >
 struct histogram_config
 {
@@ -52,6 +65,8 @@ struct histogram_config
 
     static constexpr unsigned int max_grid_size = MaxGridSize;
     static constexpr unsigned int shared_impl_max_bins = SharedImplMaxBins;
+    static constexpr unsigned int shared_impl_histograms = SharedImplHistograms;
+    static constexpr unsigned int sort_impl_min_bins = SortImplMinBins;
 #endif
 };
 
@@ -59,20 +74,68 @@ struct histogram_config
 template<
     class HistogramConfig,
     unsigned int MaxGridSize,
-    unsigned int SharedImplMaxBins
+    unsigned int SharedImplMaxBins,
+    unsigned int SharedImplHistograms,
+    unsigned int SortImplMinBins
 > constexpr unsigned int
-histogram_config<HistogramConfig, MaxGridSize, SharedImplMaxBins>::max_grid_size;
+histogram_config<
+    HistogramConfig, MaxGridSize, SharedImplMaxBins, SharedImplHistograms, SortImplMinBins
+>::max_grid_size;
 template<
     class HistogramConfig,
     unsigned int MaxGridSize,
-    unsigned int SharedImplMaxBins
+    unsigned int SharedImplMaxBins,
+    unsigned int SharedImplHistograms,
+    unsigned int SortImplMinBins
 > constexpr unsigned int
-histogram_config<HistogramConfig, MaxGridSize, SharedImplMaxBins>::shared_impl_max_bins;
+histogram_config<
+    HistogramConfig, MaxGridSize, SharedImplMaxBins, SharedImplHistograms, SortImplMinBins
+>::shared_impl_max_bins;
+template<
+    class HistogramConfig,
+    unsigned int MaxGridSize,
+    unsigned int SharedImplMaxBins,
+    unsigned int SharedImplHistograms,
+    unsigned int SortImplMinBins
+> constexpr unsigned int
+histogram_config<
+    HistogramConfig, MaxGridSize, SharedImplMaxBins, SharedImplHistograms, SortImplMinBins
+>::shared_impl_histograms;
+template<
+    class HistogramConfig,
+    unsigned int MaxGridSize,
+    unsigned int SharedImplMaxBins,
+    unsigned int SharedImplHistograms,
+    unsigned int SortImplMinBins
+> constexpr unsigned int
+histogram_config<
+    HistogramConfig, MaxGridSize, SharedImplMaxBins, SharedImplHistograms, SortImplMinBins
+>::sort_impl_min_bins;
 #endif
 
 namespace detail
 {
 
+// Custom configs without shared_impl_histograms use one copy of the histogram in shared memory
+template<class Config, class = void>
+struct select_config_shared_impl_histograms
+    : std::integral_constant<unsigned int, 1> { };
+
+template<class Config>
+struct select_config_shared_impl_histograms<
+    Config, void_t<decltype(Config::shared_impl_histograms)>
+> : std::integral_constant<unsigned int, Config::shared_impl_histograms> { };
+
+// Custom configs without sort_impl_min_bins never use the sort-based implementation
+template<class Config, class = void>
+struct select_config_sort_impl_min_bins
+    : std::integral_constant<unsigned int, std::numeric_limits<unsigned int>::max()> { };
+
+template<class Config>
+struct select_config_sort_impl_min_bins<
+    Config, void_t<decltype(Config::sort_impl_min_bins)>
+> : std::integral_constant<unsigned int, Config::sort_impl_min_bins> { };
+
 template<class Sample, unsigned int Channels, unsigned int ActiveChannels>
 struct histogram_config_803
 {
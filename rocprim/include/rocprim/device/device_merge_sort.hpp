@@ -28,7 +28,6 @@
 #include "../detail/various.hpp"
 
 #include "detail/device_merge_sort.hpp"
-#include "device_transform.hpp"
 #include "device_merge_sort_config.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -41,6 +40,7 @@ namespace detail
 
 template<
     unsigned int BlockSize,
+    unsigned int ItemsPerThread,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -55,13 +55,15 @@ void block_sort_kernel(KeysInputIterator keys_input,
                        const size_t size,
                        BinaryFunction compare_function)
 {
-    block_sort_kernel_impl<BlockSize>(
+    block_sort_kernel_impl<BlockSize, ItemsPerThread>(
         keys_input, keys_output, values_input, values_output,
         size, compare_function
     );
 }
 
 template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
@@ -74,12 +76,12 @@ void block_merge_kernel(KeysInputIterator keys_input,
                         ValuesInputIterator values_input,
                         ValuesOutputIterator values_output,
                         const size_t size,
-                        unsigned int block_size,
+                        const size_t sorted_size,
                         BinaryFunction compare_function)
 {
-    block_merge_kernel_impl(
+    block_merge_kernel_impl<BlockSize, ItemsPerThread>(
         keys_input, keys_output, values_input, values_output,
-        size, block_size, compare_function
+        size, sorted_size, compare_function
     );
 }
 
@@ -139,8 +141,15 @@ hipError_t merge_sort_impl(void * temporary_storage,
         default_merge_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
     >;
 
-    // Block size
-    constexpr unsigned int block_size = config::block_size;
+    using sort_config = typename merge_sort_block_sort_config<config>::type;
+    using merge_config = typename merge_sort_block_merge_config<config>::type;
+
+    constexpr unsigned int sort_block_size = sort_config::block_size;
+    constexpr unsigned int sort_items_per_thread = sort_config::items_per_thread;
+    constexpr unsigned int sort_items_per_block = sort_block_size * sort_items_per_thread;
+    constexpr unsigned int merge_block_size = merge_config::block_size;
+    constexpr unsigned int merge_items_per_thread = merge_config::items_per_thread;
+    constexpr size_t merge_items_per_block = merge_block_size * merge_items_per_thread;
 
     const size_t keys_bytes = ::rocprim::detail::align_size(size * sizeof(key_type));
     const size_t values_bytes =
@@ -157,11 +166,29 @@ hipError_t merge_sort_impl(void * temporary_storage,
         return hipSuccess;
     }
 
-    auto number_of_blocks = (size + block_size - 1)/block_size;
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    const unsigned int sort_number_of_blocks =
+        ::rocprim::detail::ceiling_div(size, static_cast<size_t>(sort_items_per_block));
+    // Merge passes ping-pong between the output and the buffer, the block sort stage
+    // writes to the buffer if the number of passes is odd so the last pass writes
+    // to the output
+    unsigned int merge_passes = 0;
+    for(size_t sorted_size = sort_items_per_block; sorted_size < size; sorted_size *= 2)
+    {
+        merge_passes++;
+    }
     if(debug_synchronous)
     {
-        std::cout << "block_size " << block_size << '\n';
-        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "sort_block_size " << sort_block_size << '\n';
+        std::cout << "sort_items_per_thread " << sort_items_per_thread << '\n';
+        std::cout << "sort_number_of_blocks " << sort_number_of_blocks << '\n';
+        std::cout << "merge_block_size " << merge_block_size << '\n';
+        std::cout << "merge_items_per_thread " << merge_items_per_thread << '\n';
+        std::cout << "merge_passes " << merge_passes << '\n';
     }
 
     char* ptr = reinterpret_cast<char*>(temporary_storage);
@@ -174,59 +201,55 @@ hipError_t merge_sort_impl(void * temporary_storage,
     std::chrono::high_resolution_clock::time_point start;
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
 
-    const unsigned int grid_size = number_of_blocks;
-    hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(block_sort_kernel<block_size>),
-        dim3(grid_size), dim3(block_size), 0, stream,
-        keys_input, keys_output, values_input, values_output,
-        size, compare_function
-    );
+    bool temporary_store = merge_passes % 2 == 1;
+    if(temporary_store)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(block_sort_kernel<sort_block_size, sort_items_per_thread>),
+            dim3(sort_number_of_blocks), dim3(sort_block_size), 0, stream,
+            keys_input, keys_buffer, values_input, values_buffer,
+            size, compare_function
+        );
+    }
+    else
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(block_sort_kernel<sort_block_size, sort_items_per_thread>),
+            dim3(sort_number_of_blocks), dim3(sort_block_size), 0, stream,
+            keys_input, keys_output, values_input, values_output,
+            size, compare_function
+        );
+    }
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("block_sort_kernel", size, start);
 
-    bool temporary_store = false;
-    for(unsigned int block = block_size; block < size; block *= 2)
+    for(size_t sorted_size = sort_items_per_block; sorted_size < size; sorted_size *= 2)
     {
-        temporary_store = !temporary_store;
+        const size_t merged_size = 2 * sorted_size;
+        const unsigned int merge_number_of_blocks =
+            ::rocprim::detail::ceiling_div(size, merged_size)
+            * ::rocprim::detail::ceiling_div(merged_size, merge_items_per_block);
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
         if(temporary_store)
         {
-            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
             hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(block_merge_kernel),
-                dim3(grid_size), dim3(block_size), 0, stream,
-                keys_output, keys_buffer, values_output, values_buffer,
-                size, block, compare_function
+                HIP_KERNEL_NAME(block_merge_kernel<merge_block_size, merge_items_per_thread>),
+                dim3(merge_number_of_blocks), dim3(merge_block_size), 0, stream,
+                keys_buffer, keys_output, values_buffer, values_output,
+                size, sorted_size, compare_function
             );
-            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("block_merge_kernel", size, start);
         }
         else
         {
-            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
             hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(block_merge_kernel),
-                dim3(grid_size), dim3(block_size), 0, stream,
-                keys_buffer, keys_output, values_buffer, values_output,
-                size, block, compare_function
-            );
-            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("block_merge_kernel", size, start);
-        }
-    }
-
-    if(temporary_store)
-    {
-        hipError_t error = ::rocprim::transform(
-            keys_buffer, keys_output, size,
-            ::rocprim::identity<key_type>(), stream, debug_synchronous
-        );
-        if(error != hipSuccess) return error;
-
-        if(with_values)
-        {
-            hipError_t error = ::rocprim::transform(
-                values_buffer, values_output, size,
-                ::rocprim::identity<value_type>(), stream, debug_synchronous
+                HIP_KERNEL_NAME(block_merge_kernel<merge_block_size, merge_items_per_thread>),
+                dim3(merge_number_of_blocks), dim3(merge_block_size), 0, stream,
+                keys_output, keys_buffer, values_output, values_buffer,
+                size, sorted_size, compare_function
             );
-            if(error != hipSuccess) return error;
         }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("block_merge_kernel", size, start);
+        temporary_store = !temporary_store;
     }
 
     return hipSuccess;
@@ -248,6 +271,8 @@ hipError_t merge_sort_impl(void * temporary_storage,
 /// if \p temporary_storage in a null pointer.
 /// * Accepts custom compare_functions for sorting across the device.
 ///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_sort_config or
+/// a custom class with the same members.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -339,6 +364,8 @@ hipError_t merge_sort(void * temporary_storage,
 /// if \p temporary_storage in a null pointer.
 /// * Accepts custom compare_functions for sorting across the device.
 ///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p merge_sort_config or
+/// a custom class with the same members.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
@@ -33,37 +33,110 @@
 
 BEGIN_ROCPRIM_NAMESPACE
 
-/// \brief Configuration of device-level merge primitives.
+/// \brief Configuration of device-level merge sort.
 ///
-/// \tparam BlockSize - block size used in merge sort.
-template<unsigned int BlockSize>
-using merge_sort_config = kernel_config<BlockSize, 1>;
+/// Merge sort is executed in two stages. First, tiles of <tt>SortBlockSize * SortItemsPerThread</tt>
+/// items are sorted by blocks. Then sorted runs are merged pairwise until the whole range
+/// is sorted. Every merge pass is a single kernel launch where each block produces
+/// <tt>MergeBlockSize * MergeItemsPerThread</tt> items of a merged run (bounds of blocks are
+/// found by merge path search).
+///
+/// \tparam SortBlockSize - number of threads in a block of the block sort stage.
+/// \tparam SortItemsPerThread - number of items processed by a thread in the block sort stage.
+/// \tparam MergeBlockSize - number of threads in a block of the merge stage.
+/// \tparam MergeItemsPerThread - number of items processed by a thread in the merge stage.
+///
+/// For backward compatibility, \p kernel_config (or a custom class with \p block_size and
+/// \p items_per_thread) is also accepted as a merge sort config and is used for both stages.
+template<
+    unsigned int SortBlockSize,
+    unsigned int SortItemsPerThread = 1,
+    unsigned int MergeBlockSize = SortBlockSize,
+    unsigned int MergeItemsPerThread = SortItemsPerThread
+>
+struct merge_sort_config
+{
+    /// \brief Configuration of the block sort stage.
+    using block_sort_config = kernel_config<SortBlockSize, SortItemsPerThread>;
+    /// \brief Configuration of the merge stage.
+    using block_merge_config = kernel_config<MergeBlockSize, MergeItemsPerThread>;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    // Members of the previous kernel_config-based form
+    static constexpr unsigned int block_size = SortBlockSize;
+    static constexpr unsigned int items_per_thread = SortItemsPerThread;
+#endif
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<
+    unsigned int SortBlockSize,
+    unsigned int SortItemsPerThread,
+    unsigned int MergeBlockSize,
+    unsigned int MergeItemsPerThread
+> constexpr unsigned int
+merge_sort_config<SortBlockSize, SortItemsPerThread, MergeBlockSize, MergeItemsPerThread>::block_size;
+template<
+    unsigned int SortBlockSize,
+    unsigned int SortItemsPerThread,
+    unsigned int MergeBlockSize,
+    unsigned int MergeItemsPerThread
+> constexpr unsigned int
+merge_sort_config<SortBlockSize, SortItemsPerThread, MergeBlockSize, MergeItemsPerThread>::items_per_thread;
+#endif
 
 namespace detail
 {
 
-template<class Key, class Value>
-struct merge_sort_config_803
+// Configs without separate stage configs (kernel_config) are used for both stages
+template<class Config, class = void>
+struct merge_sort_block_sort_config
 {
-    using type = merge_sort_config<limit_block_size<256U, sizeof(Key) + sizeof(Value)>::value>;
+    using type = kernel_config<Config::block_size, Config::items_per_thread>;
 };
 
-template<class Key>
-struct merge_sort_config_803<Key, empty_type>
+template<class Config>
+struct merge_sort_block_sort_config<Config, void_t<typename Config::block_sort_config>>
 {
-    using type = merge_sort_config<limit_block_size<256U, sizeof(Key)>::value>;
+    using type = typename Config::block_sort_config;
+};
+
+template<class Config, class = void>
+struct merge_sort_block_merge_config
+{
+    using type = kernel_config<Config::block_size, Config::items_per_thread>;
+};
+
+template<class Config>
+struct merge_sort_block_merge_config<Config, void_t<typename Config::block_merge_config>>
+{
+    using type = typename Config::block_merge_config;
 };
 
 template<class Key, class Value>
-struct merge_sort_config_900
+struct merge_sort_config_803
 {
-    using type = merge_sort_config<limit_block_size<256U, sizeof(Key) + sizeof(Value)>::value>;
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(::rocprim::max(sizeof(Key), sizeof(Value)), sizeof(int));
+    static constexpr unsigned int items_per_thread = ::rocprim::max(1u, 8u / item_scale);
+    // Keys and ranks (or indices) of a tile are stored in shared memory
+    static constexpr unsigned int block_size =
+        limit_block_size<256U, items_per_thread * (sizeof(Key) + sizeof(unsigned int))>::value;
+
+    using type = merge_sort_config<block_size, items_per_thread>;
 };
 
-template<class Key>
-struct merge_sort_config_900<Key, empty_type>
+template<class Key, class Value>
+struct merge_sort_config_900
 {
-    using type = merge_sort_config<limit_block_size<256U, sizeof(Key)>::value>;
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(::rocprim::max(sizeof(Key), sizeof(Value)), sizeof(int));
+    static constexpr unsigned int items_per_thread = ::rocprim::max(1u, 8u / item_scale);
+    // Keys and ranks (or indices) of a tile are stored in shared memory
+    static constexpr unsigned int block_size =
+        limit_block_size<256U, items_per_thread * (sizeof(Key) + sizeof(unsigned int))>::value;
+
+    using type = merge_sort_config<block_size, items_per_thread>;
 };
 
 template<unsigned int TargetArch, class Key, class Value>
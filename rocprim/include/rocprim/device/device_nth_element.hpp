@@ -0,0 +1,534 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_NTH_ELEMENT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_NTH_ELEMENT_HPP_
+
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../detail/radix_sort.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+#include "../iterator/constant_iterator.hpp"
+
+#include "device_nth_element_config.hpp"
+#include "detail/device_radix_select.hpp"
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<unsigned int RadixSize, class RanksIterator, class BitKey>
+__global__
+void radix_select_init_kernel(radix_select_state<BitKey> * states,
+                              unsigned long long * digit_counts,
+                              RanksIterator ranks,
+                              size_t size)
+{
+    radix_select_init<RadixSize>(states, digit_counts, ranks, size);
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    unsigned int MaxSelections,
+    bool Descending,
+    bool ByIndex,
+    class KeysInputIterator,
+    class BitKey
+>
+__global__
+void radix_select_digit_counts_kernel(KeysInputIterator keys_input,
+                                      size_t size,
+                                      const radix_select_state<BitKey> * states,
+                                      unsigned int selections,
+                                      unsigned long long * digit_counts,
+                                      unsigned int bit,
+                                      unsigned int current_radix_bits)
+{
+    radix_select_digit_counts<BlockSize, ItemsPerThread, RadixBits, MaxSelections, Descending, ByIndex>(
+        keys_input, size, states, selections, digit_counts, bit, current_radix_bits
+    );
+}
+
+template<unsigned int RadixBits, bool ByIndex, class BitKey>
+__global__
+void radix_select_digit_kernel(radix_select_state<BitKey> * states,
+                               unsigned long long * digit_counts,
+                               size_t size,
+                               unsigned int bit,
+                               bool last_key_pass)
+{
+    radix_select_digit<RadixBits, ByIndex>(states, digit_counts, size, bit, last_key_pass);
+}
+
+template<class Key, bool Descending, class OutputIterator, class BitKey>
+__global__
+void radix_select_output_kernel(const radix_select_state<BitKey> * states,
+                                OutputIterator output,
+                                unsigned int selections)
+{
+    radix_select_output<Key, Descending>(states, output, selections);
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto error = hipPeekAtLastError(); \
+        if(error != hipSuccess) return error; \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto error = hipStreamSynchronize(stream); \
+            if(error != hipSuccess) return error; \
+            auto end = std::chrono::high_resolution_clock::now(); \
+            auto d = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+            std::cout << " " << d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+// Number of blocks of the digit counting kernel. Every block processes several tiles,
+// so the number of global atomics is limited for large inputs.
+template<class Config>
+inline
+unsigned int radix_select_blocks(size_t size)
+{
+    constexpr unsigned int max_blocks = 2048;
+    constexpr unsigned int items_per_block =
+        Config::histogram::block_size * Config::histogram::items_per_thread;
+    return static_cast<unsigned int>(
+        std::min<size_t>(max_blocks, std::max<size_t>(1, ::rocprim::detail::ceiling_div(size, size_t(items_per_block))))
+    );
+}
+
+// Radix select pass: counts digits of keys (or indices) matching the current prefixes and
+// appends digits of selected items to prefixes
+template<
+    class Config,
+    unsigned int MaxSelections,
+    bool Descending,
+    bool ByIndex,
+    class KeysInputIterator,
+    class BitKey
+>
+inline
+hipError_t radix_select_pass(KeysInputIterator keys_input,
+                             size_t size,
+                             radix_select_state<BitKey> * states,
+                             unsigned int selections,
+                             unsigned long long * digit_counts,
+                             unsigned int bit,
+                             unsigned int current_radix_bits,
+                             bool last_key_pass,
+                             hipStream_t stream,
+                             bool debug_synchronous)
+{
+    constexpr unsigned int radix_size = 1 << Config::radix_bits;
+
+    static_assert(
+        radix_size <= Config::histogram::block_size,
+        "2^RadixBits must not be greater than the block size of the histogram kernel"
+    );
+
+    const unsigned int blocks = radix_select_blocks<Config>(size);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << (ByIndex ? "index " : "key ") << "bit " << bit << '\n';
+        std::cout << "blocks " << blocks << '\n';
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(radix_select_digit_counts_kernel<
+            Config::histogram::block_size, Config::histogram::items_per_thread,
+            Config::radix_bits, MaxSelections, Descending, ByIndex
+        >),
+        dim3(blocks), dim3(Config::histogram::block_size), 0, stream,
+        keys_input, size, const_cast<const radix_select_state<BitKey> *>(states), selections, digit_counts,
+        bit, current_radix_bits
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_digit_counts", size, start)
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(radix_select_digit_kernel<Config::radix_bits, ByIndex>),
+        dim3(selections), dim3(radix_size), 0, stream,
+        states, digit_counts, size, bit, last_key_pass
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_digit", selections * radix_size, start)
+
+    return hipSuccess;
+}
+
+// Initializes states of items with ranks [ranks; ranks + selections) and finds their keys,
+// starting from the most significant digit
+template<
+    class Config,
+    unsigned int MaxSelections,
+    bool Descending,
+    class KeysInputIterator,
+    class RanksIterator,
+    class BitKey
+>
+inline
+hipError_t radix_select_keys(KeysInputIterator keys_input,
+                             size_t size,
+                             RanksIterator ranks,
+                             radix_select_state<BitKey> * states,
+                             unsigned int selections,
+                             unsigned long long * digit_counts,
+                             hipStream_t stream,
+                             bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    constexpr unsigned int radix_size = 1 << Config::radix_bits;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(radix_select_init_kernel<radix_size>),
+        dim3(selections), dim3(radix_size), 0, stream,
+        states, digit_counts, ranks, size
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_init", selections * radix_size, start)
+
+    for(unsigned int end_bit = radix_key_codec<key_type>::bits; end_bit > 0;)
+    {
+        const unsigned int current_radix_bits = std::min(Config::radix_bits, end_bit);
+        const unsigned int bit = end_bit - current_radix_bits;
+        hipError_t error = radix_select_pass<Config, MaxSelections, Descending, false>(
+            keys_input, size, states, selections, digit_counts,
+            bit, current_radix_bits, bit == 0,
+            stream, debug_synchronous
+        );
+        if(error != hipSuccess) return error;
+        end_bit = bit;
+    }
+
+    return hipSuccess;
+}
+
+template<
+    class Config,
+    class KeysInputIterator,
+    class RanksIterator,
+    class OutputIterator
+>
+inline
+hipError_t nth_element_impl(void * temporary_storage,
+                            size_t& storage_size,
+                            KeysInputIterator keys_input,
+                            RanksIterator ranks,
+                            OutputIterator output,
+                            size_t size,
+                            unsigned int ranks_count,
+                            hipStream_t stream,
+                            bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    using config = default_or_custom_config<
+        Config,
+        default_nth_element_config<ROCPRIM_TARGET_ARCH, key_type>
+    >;
+    using bit_key_type = typename radix_key_codec<key_type>::bit_key_type;
+    using state_type = radix_select_state<bit_key_type>;
+
+    constexpr unsigned int radix_size = 1 << config::radix_bits;
+    constexpr unsigned int max_selections = config::max_selections;
+
+    static_assert(
+        max_selections > 0 && max_selections <= config::histogram::block_size,
+        "MaxSelections must be greater than 0 and not greater than the block size of the histogram kernel"
+    );
+
+    const size_t states_bytes = ::rocprim::detail::align_size(max_selections * sizeof(state_type));
+    const size_t digit_counts_bytes =
+        ::rocprim::detail::align_size(max_selections * radix_size * sizeof(unsigned long long));
+    if(temporary_storage == nullptr)
+    {
+        storage_size = states_bytes + digit_counts_bytes;
+        return hipSuccess;
+    }
+
+    if(size == 0 || ranks_count == 0)
+    {
+        return hipSuccess;
+    }
+
+    char * ptr = reinterpret_cast<char *>(temporary_storage);
+    state_type * states = reinterpret_cast<state_type *>(ptr);
+    ptr += states_bytes;
+    unsigned long long * digit_counts = reinterpret_cast<unsigned long long *>(ptr);
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "ranks_count " << ranks_count << '\n';
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    // Order statistics are selected in batches of max_selections
+    for(unsigned int offset = 0; offset < ranks_count; offset += max_selections)
+    {
+        const unsigned int selections = std::min(max_selections, ranks_count - offset);
+
+        hipError_t error = radix_select_keys<config, max_selections, false>(
+            keys_input, size, ranks + offset,
+            states, selections, digit_counts,
+            stream, debug_synchronous
+        );
+        if(error != hipSuccess) return error;
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(radix_select_output_kernel<key_type, false>),
+            dim3(1), dim3(max_selections), 0, stream,
+            const_cast<const state_type *>(states), output + offset, selections
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_output", selections, start)
+    }
+
+    return hipSuccess;
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end namespace detail
+
+/// \brief Parallel selection of the n-th smallest key (k-th order statistic) for device level.
+///
+/// \p nth_element function finds the key that would be at position \p n if the input range
+/// were sorted in ascending order (the same order as \p radix_sort_keys) and writes it
+/// to \p nth_output. Unlike \p std::nth_element, the input range is not modified.
+///
+/// \par Overview
+/// * The key is found by radix select: every pass counts digits of keys with the same higher
+/// digits as the n-th key, so the number of passes over the input depends on the number of bits
+/// of \p Key and not on \p size.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size is proportional to the number of
+/// possible digits, it does not depend on \p size.
+/// * \p Key type (a \p value_type of \p KeysInputIterator) must be an arithmetic type
+/// (that is, an integral type or a floating-point type), \p rocprim::tuple of arithmetic types
+/// or a type with \p radix_key_decomposer specialization.
+/// * Range specified by \p keys_input must have at least \p size elements, \p n must be
+/// less than \p size.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p nth_element_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output value. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range of keys.
+/// \param [out] nth_output - iterator to the output value.
+/// \param [in] size - number of element in the input range.
+/// \param [in] n - position of the key in the sorted range.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the median of \p float values is found.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;      // e.g., 7
+/// float * input;          // e.g., [0.6, 0.3, 0.65, 0.4, 0.2, 0.08, 1]
+/// float * output;         // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::nth_element(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, input_size / 2
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::nth_element(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, input_size / 2
+/// );
+/// // output: [0.4]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class OutputIterator
+>
+inline
+hipError_t nth_element(void * temporary_storage,
+                       size_t& storage_size,
+                       KeysInputIterator keys_input,
+                       OutputIterator nth_output,
+                       size_t size,
+                       size_t n,
+                       hipStream_t stream = 0,
+                       bool debug_synchronous = false)
+{
+    return detail::nth_element_impl<Config>(
+        temporary_storage, storage_size,
+        keys_input, ::rocprim::make_constant_iterator<size_t>(n), nth_output,
+        size, 1,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel selection of several order statistics (e.g. quantiles) for device level.
+///
+/// \p select_quantiles function finds keys that would be at positions <tt>ranks[i]</tt>
+/// if the input range were sorted in ascending order (the same order as \p radix_sort_keys)
+/// and writes them to <tt>output[i]</tt>. The input range is not modified.
+///
+/// \par Overview
+/// * Keys are found by radix select. Up to \p max_selections (a member of \p Config) order
+/// statistics are found by the same passes over the input, so percentiles like p50, p99 and
+/// p999 cost about the same as one \p nth_element call.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size is proportional to the number of
+/// possible digits, it depends neither on \p size nor on \p ranks_count.
+/// * \p Key type (a \p value_type of \p KeysInputIterator) must be an arithmetic type
+/// (that is, an integral type or a floating-point type), \p rocprim::tuple of arithmetic types
+/// or a type with \p radix_key_decomposer specialization.
+/// * Range specified by \p keys_input must have at least \p size elements, ranges specified by
+/// \p ranks and \p output must have at least \p ranks_count elements. All ranks must be
+/// less than \p size.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p nth_element_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam RanksIterator - random-access iterator type of the range of ranks. Its \p value_type
+/// must be convertible to \p size_t. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range of keys.
+/// \param [in] ranks - iterator to the first element in the device-accessible range of
+/// positions of keys in the sorted range.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] ranks_count - number of order statistics to select.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example p50, p90 and p99 of latencies are found.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;      // e.g., 100
+/// float * latencies;      // e.g., [1, 2, 3, ..., 100] (in any order)
+/// size_t * ranks;         // e.g., [50, 90, 99]
+/// float * output;         // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::select_quantiles(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     latencies, ranks, output, input_size, 3
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::select_quantiles(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     latencies, ranks, output, input_size, 3
+/// );
+/// // output: [51, 91, 100]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class RanksIterator,
+    class OutputIterator
+>
+inline
+hipError_t select_quantiles(void * temporary_storage,
+                            size_t& storage_size,
+                            KeysInputIterator keys_input,
+                            RanksIterator ranks,
+                            OutputIterator output,
+                            size_t size,
+                            unsigned int ranks_count,
+                            hipStream_t stream = 0,
+                            bool debug_synchronous = false)
+{
+    return detail::nth_element_impl<Config>(
+        temporary_storage, storage_size,
+        keys_input, ranks, output,
+        size, ranks_count,
+        stream, debug_synchronous
+    );
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_NTH_ELEMENT_HPP_
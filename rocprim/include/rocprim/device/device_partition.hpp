@@ -23,6 +23,7 @@
 
 #include <type_traits>
 #include <iterator>
+#include <limits>
 
 #include "../config.hpp"
 #include "../functional.hpp"
@@ -30,6 +31,7 @@
 #include "../detail/various.hpp"
 
 #include "device_select_config.hpp"
+#include "detail/device_info.hpp"
 #include "detail/device_partition.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -81,6 +83,56 @@ void init_offset_scan_state_kernel(OffsetLookBackScanState offset_scan_state,
     );
 }
 
+template<
+    class Config,
+    class InputIterator,
+    class BucketOutput,
+    class CountsOutputIterator,
+    class BucketOp,
+    class CountsLookbackScanState
+>
+__global__
+void partition_multi_kernel(InputIterator input,
+                            BucketOutput output,
+                            CountsOutputIterator counts_output,
+                            const unsigned int counts_output_size,
+                            const size_t size,
+                            BucketOp bucket_op,
+                            CountsLookbackScanState counts_scan_state,
+                            const unsigned int number_of_blocks,
+                            ordered_block_id<unsigned int> ordered_bid)
+{
+    partition_multi_kernel_impl<Config>(
+        input, output, counts_output, counts_output_size, size, bucket_op,
+        counts_scan_state, number_of_blocks, ordered_bid
+    );
+}
+
+template<
+    class Config,
+    unsigned int Buckets,
+    class InputIterator,
+    class Offset,
+    class BucketOp
+>
+__global__
+void partition_multi_count_kernel(InputIterator input,
+                                  const size_t size,
+                                  Offset * bucket_counts,
+                                  BucketOp bucket_op)
+{
+    partition_multi_count_kernel_impl<Config, Buckets>(
+        input, size, bucket_counts, bucket_op
+    );
+}
+
+template<unsigned int Buckets, class Offset>
+__global__
+void partition_multi_bucket_offsets_kernel(Offset * bucket_counts)
+{
+    partition_multi_bucket_offsets_kernel_impl<Buckets>(bucket_counts);
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
     if(debug_synchronous) \
     { \
@@ -107,6 +159,134 @@ void init_offset_scan_state_kernel(OffsetLookBackScanState offset_scan_state,
         } \
     }
 
+template<
+    unsigned int TargetArch,
+    // Method of selection: flag, predicate, unique
+    select_method SelectMethod,
+     // if true, it doesn't copy rejected values to output
+    bool OnlySelected,
+    class Config,
+    class InputIterator,
+    class FlagIterator,
+    class OutputIterator,
+    class UnaryPredicate,
+    class InequalityOp,
+    class SelectedCountOutputIterator
+>
+inline
+hipError_t partition_target_arch_impl(void * temporary_storage,
+                                      size_t& storage_size,
+                                      InputIterator input,
+                                      FlagIterator flags,
+                                      OutputIterator output,
+                                      SelectedCountOutputIterator selected_count_output,
+                                      const size_t size,
+                                      UnaryPredicate predicate,
+                                      InequalityOp inequality_op,
+                                      const hipStream_t stream,
+                                      bool debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = default_or_custom_config<
+        Config,
+        default_select_config<TargetArch, input_type>
+    >;
+
+    using offset_type = typename select_config_offset_type<config>::type;
+    static_assert(
+        std::is_integral<offset_type>::value && std::is_unsigned<offset_type>::value
+            && (sizeof(offset_type) == 4 || sizeof(offset_type) == 8),
+        "offset_type must be a 32-bit or 64-bit unsigned integer type"
+    );
+
+    // Offsets are always packed with flags, 64-bit offsets share their highest bits with flags.
+    // Storage size does not depend on the back-off policy.
+    using offset_scan_state_size_type = detail::lookback_scan_state<
+        offset_type, lookback_backoff_policy<lookback_backoff::none>, true
+    >;
+    using ordered_block_id_type = detail::ordered_block_id<unsigned int>;
+
+    constexpr unsigned int block_size = config::block_size;
+    constexpr unsigned int items_per_thread = config::items_per_thread;
+    constexpr auto items_per_block = block_size * items_per_thread;
+    const unsigned int number_of_blocks =
+        std::max(1u, static_cast<unsigned int>((size + items_per_block - 1)/items_per_block));
+
+    // The input must be small enough for offsets of the configured type
+    if(size > static_cast<size_t>(std::numeric_limits<offset_type>::max()))
+    {
+        return hipErrorInvalidValue;
+    }
+
+    // Calculate required temporary storage
+    size_t offset_scan_state_bytes = ::rocprim::detail::align_size(
+        offset_scan_state_size_type::get_storage_size(number_of_blocks)
+    );
+    size_t ordered_block_id_bytes = ordered_block_id_type::get_storage_size();
+    if(temporary_storage == nullptr)
+    {
+        // storage_size is never zero
+        storage_size = offset_scan_state_bytes + ordered_block_id_bytes;
+        return hipSuccess;
+    }
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    return with_lookback_backoff<config_lookback_backoff<config>::value>(
+        [&](auto backoff_policy) -> hipError_t
+        {
+            using offset_scan_state_type = detail::lookback_scan_state<
+                offset_type, decltype(backoff_policy), true
+            >;
+
+            // Create and initialize lookback_scan_state obj
+            auto offset_scan_state = offset_scan_state_type::create(
+                temporary_storage, number_of_blocks
+            );
+            // Create ad initialize ordered_block_id obj
+            auto ptr = reinterpret_cast<char*>(temporary_storage);
+            auto ordered_bid = ordered_block_id_type::create(
+                reinterpret_cast<ordered_block_id_type::id_type*>(ptr + offset_scan_state_bytes)
+            );
+
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            auto grid_size = (number_of_blocks + block_size - 1)/block_size;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(init_offset_scan_state_kernel<offset_scan_state_type>),
+                dim3(grid_size), dim3(block_size), 0, stream,
+                offset_scan_state, number_of_blocks, ordered_bid
+            );
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_offset_scan_state_kernel", size, start)
+
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            grid_size = number_of_blocks;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(partition_kernel<
+                    SelectMethod, OnlySelected, config,
+                    InputIterator, FlagIterator, OutputIterator, SelectedCountOutputIterator,
+                    UnaryPredicate, decltype(inequality_op), offset_scan_state_type
+                >),
+                dim3(grid_size), dim3(block_size), 0, stream,
+                input, flags, output, selected_count_output, size, predicate,
+                inequality_op, offset_scan_state, number_of_blocks, ordered_bid
+            );
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_kernel", size, start)
+
+            return hipSuccess;
+        }
+    );
+}
+
 template<
     // Method of selection: flag, predicate, unique
     select_method SelectMethod,
@@ -133,19 +313,62 @@ hipError_t partition_impl(void * temporary_storage,
                           const hipStream_t stream,
                           bool debug_synchronous)
 {
-    using offset_type = unsigned int;
+    // Default configs are selected for the current device
+    return with_target_arch<Config>(
+        [&](auto target_arch) -> hipError_t
+        {
+            return partition_target_arch_impl<
+                decltype(target_arch)::value, SelectMethod, OnlySelected, Config
+            >(
+                temporary_storage, storage_size, input, flags, output, selected_count_output,
+                size, predicate, inequality_op, stream, debug_synchronous
+            );
+        }
+    );
+}
+
+template<
+    unsigned int TargetArch,
+    unsigned int Buckets,
+    class Config,
+    class InputIterator,
+    class BucketOutput,
+    class CountsOutputIterator,
+    class BucketOp
+>
+inline
+hipError_t partition_multi_target_arch_impl(void * temporary_storage,
+                                            size_t& storage_size,
+                                            InputIterator input,
+                                            BucketOutput output,
+                                            CountsOutputIterator counts_output,
+                                            const unsigned int counts_output_size,
+                                            const size_t size,
+                                            BucketOp bucket_op,
+                                            const hipStream_t stream,
+                                            bool debug_synchronous)
+{
+    static_assert(Buckets > 0, "Buckets must be greater than 0");
+
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
 
     // Get default config if Config is default_config
     using config = default_or_custom_config<
         Config,
-        default_select_config<ROCPRIM_TARGET_ARCH, input_type>
+        default_select_config<TargetArch, input_type>
     >;
 
-    using offset_scan_state_type = detail::lookback_scan_state<offset_type>;
-    using offset_scan_state_with_sleep_type = detail::lookback_scan_state<offset_type, true>;
+    using offset_type = typename select_config_offset_type<config>::type;
+    static_assert(
+        std::is_integral<offset_type>::value && std::is_unsigned<offset_type>::value
+            && (sizeof(offset_type) == 4 || sizeof(offset_type) == 8),
+        "offset_type must be a 32-bit or 64-bit unsigned integer type"
+    );
+    using counts_type = partition_bucket_counts<offset_type, Buckets>;
+
+    // Storage size does not depend on the back-off policy
+    using counts_scan_state_size_type = detail::lookback_scan_state<counts_type>;
     using ordered_block_id_type = detail::ordered_block_id<unsigned int>;
-    
 
     constexpr unsigned int block_size = config::block_size;
     constexpr unsigned int items_per_thread = config::items_per_thread;
@@ -153,16 +376,21 @@ hipError_t partition_impl(void * temporary_storage,
     const unsigned int number_of_blocks =
         std::max(1u, static_cast<unsigned int>((size + items_per_block - 1)/items_per_block));
 
+    // The input must be small enough for offsets of the configured type
+    if(size > static_cast<size_t>(std::numeric_limits<offset_type>::max()))
+    {
+        return hipErrorInvalidValue;
+    }
+
     // Calculate required temporary storage
-    size_t offset_scan_state_bytes = ::rocprim::detail::align_size(
-        // This is valid even with offset_scan_state_with_sleep_type
-        offset_scan_state_type::get_storage_size(number_of_blocks)
+    size_t counts_scan_state_bytes = ::rocprim::detail::align_size(
+        counts_scan_state_size_type::get_storage_size(number_of_blocks)
     );
     size_t ordered_block_id_bytes = ordered_block_id_type::get_storage_size();
     if(temporary_storage == nullptr)
     {
         // storage_size is never zero
-        storage_size = offset_scan_state_bytes + ordered_block_id_bytes;
+        storage_size = counts_scan_state_bytes + ordered_block_id_bytes;
         return hipSuccess;
     }
 
@@ -171,81 +399,209 @@ hipError_t partition_impl(void * temporary_storage,
     if(debug_synchronous)
     {
         std::cout << "size " << size << '\n';
+        std::cout << "buckets " << Buckets << '\n';
         std::cout << "block_size " << block_size << '\n';
         std::cout << "number of blocks " << number_of_blocks << '\n';
         std::cout << "items_per_block " << items_per_block << '\n';
     }
 
-    // Create and initialize lookback_scan_state obj
-    auto offset_scan_state = offset_scan_state_type::create(
-        temporary_storage, number_of_blocks
-    );
-    auto offset_scan_state_with_sleep = offset_scan_state_with_sleep_type::create(
-        temporary_storage, number_of_blocks
+    return with_lookback_backoff<config_lookback_backoff<config>::value>(
+        [&](auto backoff_policy) -> hipError_t
+        {
+            using counts_scan_state_type = detail::lookback_scan_state<
+                counts_type, decltype(backoff_policy)
+            >;
+
+            // Create and initialize lookback_scan_state obj
+            auto counts_scan_state = counts_scan_state_type::create(
+                temporary_storage, number_of_blocks
+            );
+            // Create ad initialize ordered_block_id obj
+            auto ptr = reinterpret_cast<char*>(temporary_storage);
+            auto ordered_bid = ordered_block_id_type::create(
+                reinterpret_cast<ordered_block_id_type::id_type*>(ptr + counts_scan_state_bytes)
+            );
+
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            auto grid_size = (number_of_blocks + block_size - 1)/block_size;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(init_offset_scan_state_kernel<counts_scan_state_type>),
+                dim3(grid_size), dim3(block_size), 0, stream,
+                counts_scan_state, number_of_blocks, ordered_bid
+            );
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_offset_scan_state_kernel", size, start)
+
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            grid_size = number_of_blocks;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(partition_multi_kernel<
+                    config, InputIterator, BucketOutput, CountsOutputIterator,
+                    BucketOp, counts_scan_state_type
+                >),
+                dim3(grid_size), dim3(block_size), 0, stream,
+                input, output, counts_output, counts_output_size, size, bucket_op,
+                counts_scan_state, number_of_blocks, ordered_bid
+            );
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_multi_kernel", size, start)
+
+            return hipSuccess;
+        }
     );
-    // Create ad initialize ordered_block_id obj
-    auto ptr = reinterpret_cast<char*>(temporary_storage);
-    auto ordered_bid = ordered_block_id_type::create(
-        reinterpret_cast<ordered_block_id_type::id_type*>(ptr + offset_scan_state_bytes)
+}
+
+// Calculates offsets of buckets in the output range of partition_multi
+template<
+    unsigned int TargetArch,
+    unsigned int Buckets,
+    class Config,
+    class InputIterator,
+    class Offset,
+    class BucketOp
+>
+inline
+hipError_t partition_multi_bucket_offsets(InputIterator input,
+                                          Offset * bucket_offsets,
+                                          const size_t size,
+                                          BucketOp bucket_op,
+                                          const hipStream_t stream,
+                                          bool debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = default_or_custom_config<
+        Config,
+        default_select_config<TargetArch, input_type>
+    >;
+
+    constexpr unsigned int block_size = config::block_size;
+    constexpr unsigned int items_per_thread = config::items_per_thread;
+    constexpr auto items_per_block = block_size * items_per_thread;
+    const unsigned int number_of_blocks =
+        std::max(1u, static_cast<unsigned int>((size + items_per_block - 1)/items_per_block));
+
+    // Start point for time measurements
+    std::chrono::high_resolution_clock::time_point start;
+
+    hipError_t error = hipMemsetAsync(bucket_offsets, 0, Buckets * sizeof(Offset), stream);
+    if(error != hipSuccess) return error;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(partition_multi_count_kernel<config, Buckets>),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        input, size, bucket_offsets, bucket_op
     );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_multi_count_kernel", size, start)
 
     if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-    auto grid_size = (number_of_blocks + block_size - 1)/block_size;
-    
-    hipDeviceProp_t prop;
-    int deviceId;
-    hipGetDevice(&deviceId);
-    hipGetDeviceProperties(&prop, deviceId);
-
-    if (prop.gcnArch == 908) 
-    {
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(init_offset_scan_state_kernel<offset_scan_state_with_sleep_type>),
-            dim3(grid_size), dim3(block_size), 0, stream,
-            offset_scan_state_with_sleep, number_of_blocks, ordered_bid
-        );    
-    } else
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(partition_multi_bucket_offsets_kernel<Buckets>),
+        dim3(1), dim3(1), 0, stream,
+        bucket_offsets
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_multi_bucket_offsets_kernel", Buckets, start)
+
+    return hipSuccess;
+}
+
+template<
+    unsigned int Buckets,
+    class Config,
+    class InputIterator,
+    class BucketOutput,
+    class CountsOutputIterator,
+    class BucketOp
+>
+inline
+hipError_t partition_multi_impl(void * temporary_storage,
+                                size_t& storage_size,
+                                InputIterator input,
+                                BucketOutput output,
+                                CountsOutputIterator counts_output,
+                                const unsigned int counts_output_size,
+                                const size_t size,
+                                BucketOp bucket_op,
+                                const hipStream_t stream,
+                                bool debug_synchronous)
+{
+    return with_target_arch<Config>(
+        [&](auto target_arch) -> hipError_t
+        {
+            return partition_multi_target_arch_impl<
+                decltype(target_arch)::value, Buckets, Config
+            >(temporary_storage, storage_size, input, output, counts_output, counts_output_size,
+              size, bucket_op, stream, debug_synchronous);
+        }
+    );
+}
+
+// Offsets of buckets are calculated in the first pass and stored at the beginning
+// of temporary_storage, the look-back scan uses the rest of it
+template<
+    unsigned int TargetArch,
+    unsigned int Buckets,
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class BucketCountsOutputIterator,
+    class BucketOp
+>
+inline
+hipError_t partition_multi_buckets_target_arch_impl(void * temporary_storage,
+                                                    size_t& storage_size,
+                                                    InputIterator input,
+                                                    OutputIterator output,
+                                                    BucketCountsOutputIterator bucket_counts_output,
+                                                    const size_t size,
+                                                    BucketOp bucket_op,
+                                                    const hipStream_t stream,
+                                                    bool debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = default_or_custom_config<
+        Config,
+        default_select_config<TargetArch, input_type>
+    >;
+    using offset_type = typename select_config_offset_type<config>::type;
+    using output_type = multi_partition_output<OutputIterator, offset_type>;
+
+    if(size > static_cast<size_t>(std::numeric_limits<offset_type>::max()))
     {
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(init_offset_scan_state_kernel<offset_scan_state_type>),
-            dim3(grid_size), dim3(block_size), 0, stream,
-            offset_scan_state, number_of_blocks, ordered_bid
-        );    
+        return hipErrorInvalidValue;
     }
-    
 
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_offset_scan_state_kernel", size, start)
+    const size_t bucket_offsets_bytes =
+        ::rocprim::detail::align_size(Buckets * sizeof(offset_type));
 
-    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-    grid_size = number_of_blocks;
-    if (prop.gcnArch == 908) 
-    {
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(partition_kernel<
-                SelectMethod, OnlySelected, config,
-                InputIterator, FlagIterator, OutputIterator, SelectedCountOutputIterator,
-                UnaryPredicate, decltype(inequality_op), offset_scan_state_with_sleep_type
-            >),
-            dim3(grid_size), dim3(block_size), 0, stream,
-            input, flags, output, selected_count_output, size, predicate,
-            inequality_op, offset_scan_state_with_sleep, number_of_blocks, ordered_bid
-        );
-    } else 
+    offset_type * bucket_offsets = nullptr;
+    void * partition_storage = nullptr;
+    size_t partition_storage_size = 0;
+    if(temporary_storage != nullptr)
     {
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(partition_kernel<
-                SelectMethod, OnlySelected, config,
-                InputIterator, FlagIterator, OutputIterator, SelectedCountOutputIterator,
-                UnaryPredicate, decltype(inequality_op), offset_scan_state_type
-            >),
-            dim3(grid_size), dim3(block_size), 0, stream,
-            input, flags, output, selected_count_output, size, predicate,
-            inequality_op, offset_scan_state, number_of_blocks, ordered_bid
+        bucket_offsets = reinterpret_cast<offset_type*>(temporary_storage);
+        partition_storage = reinterpret_cast<char*>(temporary_storage) + bucket_offsets_bytes;
+        partition_storage_size = storage_size - bucket_offsets_bytes;
+
+        hipError_t error = partition_multi_bucket_offsets<TargetArch, Buckets, Config>(
+            input, bucket_offsets, size, bucket_op, stream, debug_synchronous
         );
+        if(error != hipSuccess) return error;
     }
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_kernel", size, start)
 
-    return hipSuccess;
+    hipError_t error = partition_multi_target_arch_impl<TargetArch, Buckets, Config>(
+        partition_storage, partition_storage_size, input,
+        output_type { output, bucket_offsets },
+        bucket_counts_output, Buckets, size, bucket_op,
+        stream, debug_synchronous
+    );
+    if(temporary_storage == nullptr)
+    {
+        storage_size = bucket_offsets_bytes + partition_storage_size;
+    }
+    return error;
 }
 
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
@@ -265,6 +621,9 @@ hipError_t partition_impl(void * temporary_storage,
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input, \p flags and \p output must have at least \p size elements.
 /// * Range specified by \p selected_count_output must have at least 1 element.
+/// * The type of offsets and counts is \p offset_type of \p Config. The default (\p unsigned \p int)
+/// supports up to 2^32 - 1 elements, \p select_config with 64-bit \p OffsetType is required for
+/// larger inputs. If \p size is too large for \p offset_type, \p hipErrorInvalidValue is returned.
 /// * Values of \p flag range should be implicitly convertible to `bool` type.
 /// * Relative order is preserved for the elements for which the corresponding values from \p flags
 /// are \p true. Other elements are copied in reverse order.
@@ -372,6 +731,9 @@ hipError_t partition(void * temporary_storage,
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input, \p flags and \p output must have at least \p size elements.
 /// * Range specified by \p selected_count_output must have at least 1 element.
+/// * The type of offsets and counts is \p offset_type of \p Config. The default (\p unsigned \p int)
+/// supports up to 2^32 - 1 elements, \p select_config with 64-bit \p OffsetType is required for
+/// larger inputs. If \p size is too large for \p offset_type, \p hipErrorInvalidValue is returned.
 /// * Relative order is preserved for the elements for which the \p predicate returns \p true. Other
 /// elements are copied in reverse order.
 ///
@@ -478,6 +840,294 @@ hipError_t partition(void * temporary_storage,
     );
 }
 
+/// \brief Parallel three-way partition primitive for device level using two selection predicates.
+///
+/// Performs a device-wide three-way partition in a single pass. Values from \p input for which
+/// \p select_first_part_op returns \p true are copied to \p first_output, values for which
+/// only \p select_second_part_op returns \p true are copied to \p second_output, and all other
+/// values are copied to \p unselected_output.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements, ranges specified by
+/// \p first_output, \p second_output and \p unselected_output must be large enough to hold
+/// values of their parts (\p size elements is always enough).
+/// * Range specified by \p selected_count_output must have at least 2 elements: the number
+/// of values in the first part and the number of values in the second part. The number
+/// of unselected values is <tt>size - selected_count_output[0] - selected_count_output[1]</tt>.
+/// * Relative order is preserved in all three parts.
+/// * Offsets of all three parts are calculated in one decoupled look-back scan of vectors
+/// of counts, so the input is read only once.
+/// * The type of offsets and counts is \p offset_type of \p Config. The default (\p unsigned \p int)
+/// supports up to 2^32 - 1 elements, \p select_config with 64-bit \p OffsetType is required for
+/// larger inputs. If \p size is too large for \p offset_type, \p hipErrorInvalidValue is returned.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam FirstOutputIterator - random-access iterator type of the first output range.
+/// It can be a simple pointer type.
+/// \tparam SecondOutputIterator - random-access iterator type of the second output range.
+/// It can be a simple pointer type.
+/// \tparam UnselectedOutputIterator - random-access iterator type of the unselected output range.
+/// It can be a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// values. It can be a simple pointer type.
+/// \tparam FirstUnaryPredicate - type of a unary selection predicate for the first part.
+/// \tparam SecondUnaryPredicate - type of a unary selection predicate for the second part.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the partition operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to partition.
+/// \param [out] first_output - iterator to the first element in the first output range.
+/// \param [out] second_output - iterator to the first element in the second output range.
+/// \param [out] unselected_output - iterator to the first element in the unselected output range.
+/// \param [out] selected_count_output - iterator to the numbers of values in the first and
+/// the second parts.
+/// \param [in] size - number of element in the input range.
+/// \param [in] select_first_part_op - unary function object which returns \p true if the element
+/// should be copied to the first part.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] select_second_part_op - unary function object which returns \p true if the element
+/// should be copied to the second part (if it is not copied to the first part).
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level three-way partition operation is performed on an array of
+/// integer values, values less than 4 form the first part, values less than 7 - the second one.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto first_op =
+///     [] __device__ (int a) -> bool
+///     {
+///         return a < 4;
+///     };
+/// auto second_op =
+///     [] __device__ (int a) -> bool
+///     {
+///         return a < 7;
+///     };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;           // e.g., 8
+/// int * input;                 // e.g., [1, 8, 4, 2, 7, 6, 3, 5]
+/// int * first_output;          // empty array of 8 elements
+/// int * second_output;         // empty array of 8 elements
+/// int * unselected_output;     // empty array of 8 elements
+/// unsigned int * output_count; // empty array of 2 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::partition_three_way(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input,
+///     first_output, second_output, unselected_output,
+///     output_count,
+///     input_size,
+///     first_op, second_op
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform partition
+/// rocprim::partition_three_way(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input,
+///     first_output, second_output, unselected_output,
+///     output_count,
+///     input_size,
+///     first_op, second_op
+/// );
+/// // first_output: [1, 2, 3]
+/// // second_output: [4, 6, 5]
+/// // unselected_output: [8, 7]
+/// // output_count: [3, 3]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class FirstOutputIterator,
+    class SecondOutputIterator,
+    class UnselectedOutputIterator,
+    class SelectedCountOutputIterator,
+    class FirstUnaryPredicate,
+    class SecondUnaryPredicate
+>
+inline
+hipError_t partition_three_way(void * temporary_storage,
+                               size_t& storage_size,
+                               InputIterator input,
+                               FirstOutputIterator first_output,
+                               SecondOutputIterator second_output,
+                               UnselectedOutputIterator unselected_output,
+                               SelectedCountOutputIterator selected_count_output,
+                               const size_t size,
+                               FirstUnaryPredicate select_first_part_op,
+                               SecondUnaryPredicate select_second_part_op,
+                               const hipStream_t stream = 0,
+                               const bool debug_synchronous = false)
+{
+    using bucket_op_type = detail::three_way_partition_bucket_op<
+        FirstUnaryPredicate, SecondUnaryPredicate
+    >;
+    using output_type = detail::three_way_partition_output<
+        FirstOutputIterator, SecondOutputIterator, UnselectedOutputIterator
+    >;
+
+    return detail::partition_multi_impl<3, Config>(
+        temporary_storage, storage_size, input,
+        output_type { first_output, second_output, unselected_output },
+        selected_count_output, 2, size,
+        bucket_op_type { select_first_part_op, select_second_part_op },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel multi-way partition primitive for device level.
+///
+/// Performs a device-wide partition of values from \p input into \p Buckets parts.
+/// \p bucket_op returns the index of the part of every value. Values are copied to \p output
+/// so that all values of the <tt>i</tt>-th part precede all values of the <tt>(i+1)</tt>-th
+/// part, and the number of values in every part is written to \p bucket_counts_output.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * Range specified by \p bucket_counts_output must have at least \p Buckets elements.
+/// * Relative order is preserved in all parts.
+/// * \p bucket_op should return values in range <tt>[0, Buckets)</tt>, greater values are
+/// clamped to <tt>Buckets - 1</tt> (such values are copied to the last part).
+/// * Offsets of values in all parts are calculated in one decoupled look-back scan of vectors
+/// of \p Buckets counts, so the primitive is intended for small numbers of parts.
+/// * It is not a single-pass algorithm: positions of parts in \p output are not known before
+/// the scan is finished, so the input is read twice. The first pass counts values of every part
+/// (with atomic operations in global memory), the second one is the look-back scan that copies
+/// values. When every part has its own output range, \p partition_three_way (which reads
+/// the input once) or a custom single-pass partition should be preferred.
+/// * The type of offsets and counts is \p offset_type of \p Config. The default (\p unsigned \p int)
+/// supports up to 2^32 - 1 elements, \p select_config with 64-bit \p OffsetType is required for
+/// larger inputs. If \p size is too large for \p offset_type, \p hipErrorInvalidValue is returned.
+///
+/// \tparam Buckets - number of parts.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam BucketCountsOutputIterator - random-access iterator type of the bucket_counts_output
+/// values. It can be a simple pointer type.
+/// \tparam BucketOp - type of a unary function object returning the part of a value.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the partition operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to partition.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] bucket_counts_output - iterator to the numbers of values in parts.
+/// \param [in] size - number of element in the input range.
+/// \param [in] bucket_op - unary function object which returns the index of the part
+/// the element should be copied to.
+/// The signature of the function should be equivalent to the following:
+/// <tt>unsigned int f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level multi-way partition operation is performed on an array of
+/// integer values, values are partitioned by their remainders of division by 3.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto bucket_op =
+///     [] __device__ (int a) -> unsigned int
+///     {
+///         return a % 3;
+///     };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;           // e.g., 8
+/// int * input;                 // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int * output;                // empty array of 8 elements
+/// unsigned int * output_count; // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::partition_multi<3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, output_count,
+///     input_size,
+///     bucket_op
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform partition
+/// rocprim::partition_multi<3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, output_count,
+///     input_size,
+///     bucket_op
+/// );
+/// // output: [3, 6, 1, 4, 7, 2, 5, 8]
+/// // output_count: [2, 3, 3]
+/// \endcode
+/// \endparblock
+template<
+    unsigned int Buckets,
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class BucketCountsOutputIterator,
+    class BucketOp
+>
+inline
+hipError_t partition_multi(void * temporary_storage,
+                           size_t& storage_size,
+                           InputIterator input,
+                           OutputIterator output,
+                           BucketCountsOutputIterator bucket_counts_output,
+                           const size_t size,
+                           BucketOp bucket_op,
+                           const hipStream_t stream = 0,
+                           const bool debug_synchronous = false)
+{
+    return detail::with_target_arch<Config>(
+        [&](auto target_arch) -> hipError_t
+        {
+            return detail::partition_multi_buckets_target_arch_impl<
+                decltype(target_arch)::value, Buckets, Config
+            >(temporary_storage, storage_size, input, output, bucket_counts_output,
+              size, bucket_op, stream, debug_synchronous);
+        }
+    );
+}
+
 /// @}
 // end of group devicemodule
 
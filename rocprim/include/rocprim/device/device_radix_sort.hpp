@@ -89,6 +89,15 @@ void scan_digits_kernel(unsigned int * digit_counts)
     scan_digits<RadixBits>(digit_counts);
 }
 
+template<unsigned int RadixBits>
+__global__
+void scan_chunks_kernel(const unsigned int * chunk_digit_counts,
+                        size_t * chunk_digit_starts,
+                        unsigned int chunks)
+{
+    scan_chunks<RadixBits>(chunk_digit_counts, chunk_digit_starts, chunks);
+}
+
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
@@ -97,7 +106,8 @@ template<
     class KeysInputIterator,
     class KeysOutputIterator,
     class ValuesInputIterator,
-    class ValuesOutputIterator
+    class ValuesOutputIterator,
+    class Offset
 >
 __global__
 void sort_and_scatter_kernel(KeysInputIterator keys_input,
@@ -106,7 +116,7 @@ void sort_and_scatter_kernel(KeysInputIterator keys_input,
                              ValuesOutputIterator values_output,
                              unsigned int size,
                              const unsigned int * batch_digit_starts,
-                             const unsigned int * digit_starts,
+                             const Offset * digit_starts,
                              unsigned int bit,
                              unsigned int current_radix_bits,
                              unsigned int blocks_per_full_batch,
@@ -120,6 +130,81 @@ void sort_and_scatter_kernel(KeysInputIterator keys_input,
     );
 }
 
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    class KeysInputIterator
+>
+__global__
+void onesweep_histograms_kernel(KeysInputIterator keys_input,
+                                unsigned int size,
+                                unsigned int * digit_counts,
+                                unsigned int begin_bit,
+                                unsigned int end_bit,
+                                unsigned int blocks_per_full_batch,
+                                unsigned int full_batches)
+{
+    onesweep_histograms<BlockSize, ItemsPerThread, RadixBits, Descending>(
+        keys_input, size,
+        digit_counts,
+        begin_bit, end_bit,
+        blocks_per_full_batch, full_batches
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    unsigned int RadixBits,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class LookbackScanState
+>
+__global__
+void onesweep_iteration_kernel(KeysInputIterator keys_input,
+                               KeysOutputIterator keys_output,
+                               ValuesInputIterator values_input,
+                               ValuesOutputIterator values_output,
+                               unsigned int size,
+                               const unsigned int * digit_counts,
+                               LookbackScanState lookback_scan_state,
+                               ordered_block_id<unsigned int> ordered_bid,
+                               LookbackScanState next_lookback_scan_state,
+                               ordered_block_id<unsigned int> next_ordered_bid,
+                               unsigned int number_of_blocks,
+                               unsigned int bit,
+                               unsigned int current_radix_bits)
+{
+    onesweep_iteration<BlockSize, ItemsPerThread, RadixBits, Descending>(
+        keys_input, keys_output, values_input, values_output, size,
+        digit_counts,
+        lookback_scan_state, ordered_bid,
+        next_lookback_scan_state, next_ordered_bid,
+        number_of_blocks,
+        bit, current_radix_bits
+    );
+}
+
+template<class LookbackScanState>
+__global__
+void onesweep_init_kernel(unsigned int * digit_counts,
+                          unsigned int digit_counts_size,
+                          LookbackScanState lookback_scan_state,
+                          unsigned int lookback_scan_state_size,
+                          ordered_block_id<unsigned int> ordered_bid)
+{
+    onesweep_init(
+        digit_counts, digit_counts_size,
+        lookback_scan_state, lookback_scan_state_size,
+        ordered_bid
+    );
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
     { \
         auto error = hipPeekAtLastError(); \
@@ -303,7 +388,506 @@ hipError_t radix_sort_iteration(KeysInputIterator keys_input,
             );
         }
     }
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sort_and_scatter", size, start)
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sort_and_scatter", size, start)
+
+    return hipSuccess;
+}
+
+// Inputs larger than this are sorted in chunks, so all offsets inside a chunk fit into
+// 32-bit integers. It is a multiple of items processed by one block.
+template<class Config>
+constexpr size_t radix_sort_chunk_size()
+{
+    return (size_t(1) << 31)
+        / (Config::sort::block_size * Config::sort::items_per_thread)
+        * (Config::sort::block_size * Config::sort::items_per_thread);
+}
+
+inline
+void radix_sort_batches(unsigned int size,
+                        unsigned int sort_size,
+                        unsigned int scan_size,
+                        unsigned int& blocks_per_full_batch,
+                        unsigned int& full_batches,
+                        unsigned int& batches)
+{
+    const unsigned int blocks = std::max(1u, ::rocprim::detail::ceiling_div(size, sort_size));
+    blocks_per_full_batch = ::rocprim::detail::ceiling_div(blocks, scan_size);
+    full_batches = blocks % scan_size != 0
+        ? blocks % scan_size
+        : scan_size;
+    batches = (blocks_per_full_batch == 1 ? full_batches : scan_size);
+}
+
+// Digits are counted separately in every chunk, then the counts of all chunks are scanned
+// together so every chunk is scattered directly into the single sorted output
+// (positions are 64-bit).
+template<
+    class Config,
+    unsigned int RadixBits,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator
+>
+inline
+hipError_t radix_sort_chunked_iteration(KeysInputIterator keys_input,
+                                        typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                        KeysOutputIterator keys_output,
+                                        ValuesInputIterator values_input,
+                                        typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                        ValuesOutputIterator values_output,
+                                        size_t size,
+                                        unsigned int * batch_digit_counts,
+                                        unsigned int * chunk_digit_counts,
+                                        size_t * chunk_digit_starts,
+                                        bool from_input,
+                                        bool to_output,
+                                        unsigned int bit,
+                                        unsigned int end_bit,
+                                        hipStream_t stream,
+                                        bool debug_synchronous)
+{
+    constexpr unsigned int radix_size = 1 << RadixBits;
+    constexpr unsigned int max_radix_size = 1 << Config::long_radix_bits;
+
+    constexpr unsigned int scan_size = Config::scan::block_size * Config::scan::items_per_thread;
+    constexpr unsigned int sort_size = Config::sort::block_size * Config::sort::items_per_thread;
+    constexpr size_t chunk_size = radix_sort_chunk_size<Config>();
+
+    const unsigned int chunks = static_cast<unsigned int>(::rocprim::detail::ceiling_div(size, chunk_size));
+
+    // Handle cases when (end_bit - bit) is not divisible by RadixBits, i.e. the last
+    // iteration has a shorter mask.
+    const unsigned int current_radix_bits = ::rocprim::min(RadixBits, end_bit - bit);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "RadixBits " << RadixBits << '\n';
+        std::cout << "bit " << bit << '\n';
+        std::cout << "current_radix_bits " << current_radix_bits << '\n';
+    }
+
+    for(unsigned int chunk = 0; chunk < chunks; chunk++)
+    {
+        const size_t offset = chunk * chunk_size;
+        const unsigned int current_size = static_cast<unsigned int>(std::min(chunk_size, size - offset));
+        unsigned int blocks_per_full_batch, full_batches, batches;
+        radix_sort_batches(current_size, sort_size, scan_size, blocks_per_full_batch, full_batches, batches);
+        unsigned int * current_batch_digit_counts = batch_digit_counts + chunk * scan_size * max_radix_size;
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        if(from_input)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(fill_digit_counts_kernel<
+                    Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                >),
+                dim3(batches), dim3(Config::sort::block_size), 0, stream,
+                keys_input + offset, current_size,
+                current_batch_digit_counts,
+                bit, current_radix_bits,
+                blocks_per_full_batch, full_batches
+            );
+        }
+        else
+        {
+            if(to_output)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(fill_digit_counts_kernel<
+                        Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                    >),
+                    dim3(batches), dim3(Config::sort::block_size), 0, stream,
+                    keys_tmp + offset, current_size,
+                    current_batch_digit_counts,
+                    bit, current_radix_bits,
+                    blocks_per_full_batch, full_batches
+                );
+            }
+            else
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(fill_digit_counts_kernel<
+                        Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                    >),
+                    dim3(batches), dim3(Config::sort::block_size), 0, stream,
+                    keys_output + offset, current_size,
+                    current_batch_digit_counts,
+                    bit, current_radix_bits,
+                    blocks_per_full_batch, full_batches
+                );
+            }
+        }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("fill_digit_counts", current_size, start)
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(scan_batches_kernel<Config::scan::block_size, Config::scan::items_per_thread, RadixBits>),
+            dim3(radix_size), dim3(Config::scan::block_size), 0, stream,
+            current_batch_digit_counts, chunk_digit_counts + chunk * radix_size, batches
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("scan_batches", radix_size * Config::scan::block_size, start)
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(scan_chunks_kernel<RadixBits>),
+        dim3(1), dim3(radix_size), 0, stream,
+        const_cast<const unsigned int *>(chunk_digit_counts), chunk_digit_starts, chunks
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("scan_chunks", radix_size, start)
+
+    for(unsigned int chunk = 0; chunk < chunks; chunk++)
+    {
+        const size_t offset = chunk * chunk_size;
+        const unsigned int current_size = static_cast<unsigned int>(std::min(chunk_size, size - offset));
+        unsigned int blocks_per_full_batch, full_batches, batches;
+        radix_sort_batches(current_size, sort_size, scan_size, blocks_per_full_batch, full_batches, batches);
+        const unsigned int * current_batch_digit_counts = batch_digit_counts + chunk * scan_size * max_radix_size;
+        const size_t * current_digit_starts = chunk_digit_starts + chunk * radix_size;
+
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        if(from_input)
+        {
+            if(to_output)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(sort_and_scatter_kernel<
+                        Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                    >),
+                    dim3(batches), dim3(Config::sort::block_size), 0, stream,
+                    keys_input + offset, keys_output, values_input + offset, values_output, current_size,
+                    current_batch_digit_counts, current_digit_starts,
+                    bit, current_radix_bits,
+                    blocks_per_full_batch, full_batches
+                );
+            }
+            else
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(sort_and_scatter_kernel<
+                        Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                    >),
+                    dim3(batches), dim3(Config::sort::block_size), 0, stream,
+                    keys_input + offset, keys_tmp, values_input + offset, values_tmp, current_size,
+                    current_batch_digit_counts, current_digit_starts,
+                    bit, current_radix_bits,
+                    blocks_per_full_batch, full_batches
+                );
+            }
+        }
+        else
+        {
+            if(to_output)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(sort_and_scatter_kernel<
+                        Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                    >),
+                    dim3(batches), dim3(Config::sort::block_size), 0, stream,
+                    keys_tmp + offset, keys_output, values_tmp + offset, values_output, current_size,
+                    current_batch_digit_counts, current_digit_starts,
+                    bit, current_radix_bits,
+                    blocks_per_full_batch, full_batches
+                );
+            }
+            else
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(sort_and_scatter_kernel<
+                        Config::sort::block_size, Config::sort::items_per_thread, RadixBits, Descending
+                    >),
+                    dim3(batches), dim3(Config::sort::block_size), 0, stream,
+                    keys_output + offset, keys_tmp, values_output + offset, values_tmp, current_size,
+                    current_batch_digit_counts, current_digit_starts,
+                    bit, current_radix_bits,
+                    blocks_per_full_batch, full_batches
+                );
+            }
+        }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sort_and_scatter", current_size, start)
+    }
+
+    return hipSuccess;
+}
+
+template<
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class LookbackScanState
+>
+inline
+hipError_t onesweep_iteration(KeysInputIterator keys_input,
+                              typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                              KeysOutputIterator keys_output,
+                              ValuesInputIterator values_input,
+                              typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                              ValuesOutputIterator values_output,
+                              unsigned int size,
+                              const unsigned int * digit_counts,
+                              LookbackScanState lookback_scan_state,
+                              ordered_block_id<unsigned int> ordered_bid,
+                              LookbackScanState next_lookback_scan_state,
+                              ordered_block_id<unsigned int> next_ordered_bid,
+                              unsigned int number_of_blocks,
+                              bool from_input,
+                              bool to_output,
+                              unsigned int bit,
+                              unsigned int end_bit,
+                              hipStream_t stream,
+                              bool debug_synchronous)
+{
+    constexpr unsigned int radix_bits = Config::long_radix_bits;
+    constexpr unsigned int block_size = Config::sort::block_size;
+    constexpr unsigned int items_per_thread = Config::sort::items_per_thread;
+
+    // The last iteration may have a shorter mask
+    const unsigned int current_radix_bits = ::rocprim::min(radix_bits, end_bit - bit);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "bit " << bit << '\n';
+        std::cout << "current_radix_bits " << current_radix_bits << '\n';
+    }
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    if(from_input)
+    {
+        if(to_output)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(onesweep_iteration_kernel<
+                    block_size, items_per_thread, radix_bits, Descending
+                >),
+                dim3(number_of_blocks), dim3(block_size), 0, stream,
+                keys_input, keys_output, values_input, values_output, size,
+                digit_counts,
+                lookback_scan_state, ordered_bid,
+                next_lookback_scan_state, next_ordered_bid,
+                number_of_blocks,
+                bit, current_radix_bits
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(onesweep_iteration_kernel<
+                    block_size, items_per_thread, radix_bits, Descending
+                >),
+                dim3(number_of_blocks), dim3(block_size), 0, stream,
+                keys_input, keys_tmp, values_input, values_tmp, size,
+                digit_counts,
+                lookback_scan_state, ordered_bid,
+                next_lookback_scan_state, next_ordered_bid,
+                number_of_blocks,
+                bit, current_radix_bits
+            );
+        }
+    }
+    else
+    {
+        if(to_output)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(onesweep_iteration_kernel<
+                    block_size, items_per_thread, radix_bits, Descending
+                >),
+                dim3(number_of_blocks), dim3(block_size), 0, stream,
+                keys_tmp, keys_output, values_tmp, values_output, size,
+                digit_counts,
+                lookback_scan_state, ordered_bid,
+                next_lookback_scan_state, next_ordered_bid,
+                number_of_blocks,
+                bit, current_radix_bits
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(onesweep_iteration_kernel<
+                    block_size, items_per_thread, radix_bits, Descending
+                >),
+                dim3(number_of_blocks), dim3(block_size), 0, stream,
+                keys_output, keys_tmp, values_output, values_tmp, size,
+                digit_counts,
+                lookback_scan_state, ordered_bid,
+                next_lookback_scan_state, next_ordered_bid,
+                number_of_blocks,
+                bit, current_radix_bits
+            );
+        }
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("onesweep_iteration", size, start)
+
+    return hipSuccess;
+}
+
+template<
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator
+>
+inline
+auto radix_sort_iterations(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                           ValuesOutputIterator values_output,
+                           unsigned int size,
+                           bool& is_result_in_output,
+                           unsigned int begin_bit,
+                           unsigned int end_bit,
+                           hipStream_t stream,
+                           bool debug_synchronous)
+    -> typename std::enable_if<!select_config_use_onesweep<Config>::value, hipError_t>::type
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using config = Config;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    constexpr unsigned int max_radix_size = 1 << config::long_radix_bits;
+
+    constexpr unsigned int scan_size = config::scan::block_size * config::scan::items_per_thread;
+    constexpr unsigned int sort_size = config::sort::block_size * config::sort::items_per_thread;
+
+    const unsigned int blocks = std::max(1u, ::rocprim::detail::ceiling_div(size, sort_size));
+    const unsigned int blocks_per_full_batch = ::rocprim::detail::ceiling_div(blocks, scan_size);
+    const unsigned int full_batches = blocks % scan_size != 0
+        ? blocks % scan_size
+        : scan_size;
+    const unsigned int batches = (blocks_per_full_batch == 1 ? full_batches : scan_size);
+    const bool with_double_buffer = keys_tmp != nullptr;
+
+    const unsigned int bits = end_bit - begin_bit;
+    const unsigned int iterations = ::rocprim::detail::ceiling_div(bits, config::long_radix_bits);
+    const unsigned int radix_bits_diff = config::long_radix_bits - config::short_radix_bits;
+    const unsigned int short_iterations = radix_bits_diff != 0
+        ? ::rocprim::min(iterations, (config::long_radix_bits * iterations - bits) / radix_bits_diff)
+        : 0;
+    const unsigned int long_iterations = iterations - short_iterations;
+
+    const size_t batch_digit_counts_bytes =
+        ::rocprim::detail::align_size(batches * max_radix_size * sizeof(unsigned int));
+    const size_t digit_counts_bytes = ::rocprim::detail::align_size(max_radix_size * sizeof(unsigned int));
+    const size_t keys_bytes = ::rocprim::detail::align_size(size * sizeof(key_type));
+    const size_t values_bytes = with_values ? ::rocprim::detail::align_size(size * sizeof(value_type)) : 0;
+    if(temporary_storage == nullptr)
+    {
+        storage_size = batch_digit_counts_bytes + digit_counts_bytes;
+        if(!with_double_buffer)
+        {
+            storage_size += keys_bytes + values_bytes;
+        }
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "blocks " << blocks << '\n';
+        std::cout << "blocks_per_full_batch " << blocks_per_full_batch << '\n';
+        std::cout << "full_batches " << full_batches << '\n';
+        std::cout << "batches " << batches << '\n';
+        std::cout << "iterations " << iterations << '\n';
+        std::cout << "long_iterations " << long_iterations << '\n';
+        std::cout << "short_iterations " << short_iterations << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    char * ptr = reinterpret_cast<char *>(temporary_storage);
+    unsigned int * batch_digit_counts = reinterpret_cast<unsigned int *>(ptr);
+    ptr += batch_digit_counts_bytes;
+    unsigned int * digit_counts = reinterpret_cast<unsigned int *>(ptr);
+    ptr += digit_counts_bytes;
+   if(!with_double_buffer)
+    {
+        keys_tmp = reinterpret_cast<key_type *>(ptr);
+        ptr += keys_bytes;
+        values_tmp = with_values ? reinterpret_cast<value_type *>(ptr) : nullptr;
+    }
+
+    bool to_output = with_double_buffer || (iterations - 1) % 2 == 0;
+    bool from_input = true;
+    if(!with_double_buffer && to_output)
+    {
+        // Copy input keys and values if necessary (in-place sorting: input and output iterators are equal)
+        const bool keys_equal = ::rocprim::detail::are_iterators_equal(keys_input, keys_output);
+        const bool values_equal = with_values && ::rocprim::detail::are_iterators_equal(values_input, values_output);
+        if(keys_equal || values_equal)
+        {
+            hipError_t error = ::rocprim::transform(
+                keys_input, keys_tmp, size,
+                ::rocprim::identity<key_type>(), stream, debug_synchronous
+            );
+            if(error != hipSuccess) return error;
+
+            if(with_values)
+            {
+                hipError_t error = ::rocprim::transform(
+                    values_input, values_tmp, size,
+                    ::rocprim::identity<value_type>(), stream, debug_synchronous
+                );
+                if(error != hipSuccess) return error;
+            }
+
+            from_input = false;
+        }
+    }
+
+    unsigned int bit = begin_bit;
+    for(unsigned int i = 0; i < long_iterations; i++)
+    {
+        hipError_t error = radix_sort_iteration<config, config::long_radix_bits, Descending>(
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output, size,
+            batch_digit_counts, digit_counts,
+            from_input, to_output,
+            bit, end_bit,
+            blocks_per_full_batch, full_batches, batches,
+            stream, debug_synchronous
+        );
+        if(error != hipSuccess) return error;
+
+        is_result_in_output = to_output;
+        from_input = false;
+        to_output = !to_output;
+        bit += config::long_radix_bits;
+    }
+    for(unsigned int i = 0; i < short_iterations; i++)
+    {
+        hipError_t error = radix_sort_iteration<config, config::short_radix_bits, Descending>(
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output, size,
+            batch_digit_counts, digit_counts,
+            from_input, to_output,
+            bit, end_bit,
+            blocks_per_full_batch, full_batches, batches,
+            stream, debug_synchronous
+        );
+        if(error != hipSuccess) return error;
+
+        is_result_in_output = to_output;
+        from_input = false;
+        to_output = !to_output;
+        bit += config::short_radix_bits;
+    }
 
     return hipSuccess;
 }
@@ -317,7 +901,7 @@ template<
     class ValuesOutputIterator
 >
 inline
-hipError_t radix_sort_impl(void * temporary_storage,
+auto radix_sort_iterations(void * temporary_storage,
                            size_t& storage_size,
                            KeysInputIterator keys_input,
                            typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
@@ -331,31 +915,25 @@ hipError_t radix_sort_impl(void * temporary_storage,
                            unsigned int end_bit,
                            hipStream_t stream,
                            bool debug_synchronous)
+    -> typename std::enable_if<select_config_use_onesweep<Config>::value, hipError_t>::type
 {
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
 
-    static_assert(
-        std::is_same<key_type, typename std::iterator_traits<KeysOutputIterator>::value_type>::value,
-        "KeysInputIterator and KeysOutputIterator must have the same value_type"
-    );
-    static_assert(
-        std::is_same<value_type, typename std::iterator_traits<ValuesOutputIterator>::value_type>::value,
-        "ValuesInputIterator and ValuesOutputIterator must have the same value_type"
-    );
+    using config = Config;
 
-    using config = default_or_custom_config<
-        Config,
-        default_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
-    >;
+    using scan_state_type = lookback_scan_state<unsigned int>;
+    using ordered_block_id_type = ordered_block_id<unsigned int>;
 
     constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
 
-    constexpr unsigned int max_radix_size = 1 << config::long_radix_bits;
+    constexpr unsigned int radix_size = 1 << config::long_radix_bits;
 
     constexpr unsigned int scan_size = config::scan::block_size * config::scan::items_per_thread;
     constexpr unsigned int sort_size = config::sort::block_size * config::sort::items_per_thread;
 
+    // Blocks of the histogram kernel process batches of sort_size-sized tiles
+    // the same way as the digit counting kernel of the iterative algorithm.
     const unsigned int blocks = std::max(1u, ::rocprim::detail::ceiling_div(size, sort_size));
     const unsigned int blocks_per_full_batch = ::rocprim::detail::ceiling_div(blocks, scan_size);
     const unsigned int full_batches = blocks % scan_size != 0
@@ -364,6 +942,189 @@ hipError_t radix_sort_impl(void * temporary_storage,
     const unsigned int batches = (blocks_per_full_batch == 1 ? full_batches : scan_size);
     const bool with_double_buffer = keys_tmp != nullptr;
 
+    const unsigned int bits = end_bit - begin_bit;
+    const unsigned int iterations = ::rocprim::detail::ceiling_div(bits, config::long_radix_bits);
+
+    // Every (block, digit) pair has its own look-back prefix
+    const unsigned int scan_state_size = blocks * radix_size;
+
+    const size_t digit_counts_bytes =
+        ::rocprim::detail::align_size(iterations * radix_size * sizeof(unsigned int));
+    const size_t scan_state_bytes =
+        ::rocprim::detail::align_size(scan_state_type::get_storage_size(scan_state_size));
+    const size_t ordered_block_id_bytes =
+        ::rocprim::detail::align_size(ordered_block_id_type::get_storage_size());
+    const size_t keys_bytes = ::rocprim::detail::align_size(size * sizeof(key_type));
+    const size_t values_bytes = with_values ? ::rocprim::detail::align_size(size * sizeof(value_type)) : 0;
+    if(temporary_storage == nullptr)
+    {
+        // Two look-back states: one is used by the current iteration while the other is
+        // initialized for the next one
+        storage_size = digit_counts_bytes + 2 * (scan_state_bytes + ordered_block_id_bytes);
+        if(!with_double_buffer)
+        {
+            storage_size += keys_bytes + values_bytes;
+        }
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "blocks " << blocks << '\n';
+        std::cout << "blocks_per_full_batch " << blocks_per_full_batch << '\n';
+        std::cout << "full_batches " << full_batches << '\n';
+        std::cout << "batches " << batches << '\n';
+        std::cout << "iterations " << iterations << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    char * ptr = reinterpret_cast<char *>(temporary_storage);
+    unsigned int * digit_counts = reinterpret_cast<unsigned int *>(ptr);
+    ptr += digit_counts_bytes;
+    scan_state_type scan_states[2];
+    ordered_block_id_type ordered_bids[2];
+    for(unsigned int i = 0; i < 2; i++)
+    {
+        scan_states[i] = scan_state_type::create(ptr, scan_state_size);
+        ptr += scan_state_bytes;
+        ordered_bids[i] = ordered_block_id_type::create(
+            reinterpret_cast<ordered_block_id_type::id_type *>(ptr)
+        );
+        ptr += ordered_block_id_bytes;
+    }
+    if(!with_double_buffer)
+    {
+        keys_tmp = reinterpret_cast<key_type *>(ptr);
+        ptr += keys_bytes;
+        values_tmp = with_values ? reinterpret_cast<value_type *>(ptr) : nullptr;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    // Reset histograms and prepare the look-back state of the first iteration
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    const unsigned int init_size = std::max(
+        iterations * radix_size,
+        scan_state_size + ::rocprim::warp_size()
+    );
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(onesweep_init_kernel<scan_state_type>),
+        dim3(::rocprim::detail::ceiling_div(init_size, config::sort::block_size)),
+        dim3(config::sort::block_size), 0, stream,
+        digit_counts, iterations * radix_size,
+        scan_states[0], scan_state_size,
+        ordered_bids[0]
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("onesweep_init", init_size, start)
+
+    // Digit histograms of all iterations are computed in one pass over the keys
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(onesweep_histograms_kernel<
+            config::sort::block_size, config::sort::items_per_thread, config::long_radix_bits, Descending
+        >),
+        dim3(batches), dim3(config::sort::block_size), 0, stream,
+        keys_input, size,
+        digit_counts,
+        begin_bit, end_bit,
+        blocks_per_full_batch, full_batches
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("onesweep_histograms", size, start)
+
+    bool to_output = with_double_buffer || (iterations - 1) % 2 == 0;
+    bool from_input = true;
+    if(!with_double_buffer && to_output)
+    {
+        // Copy input keys and values if necessary (in-place sorting: input and output iterators are equal)
+        const bool keys_equal = ::rocprim::detail::are_iterators_equal(keys_input, keys_output);
+        const bool values_equal = with_values && ::rocprim::detail::are_iterators_equal(values_input, values_output);
+        if(keys_equal || values_equal)
+        {
+            hipError_t error = ::rocprim::transform(
+                keys_input, keys_tmp, size,
+                ::rocprim::identity<key_type>(), stream, debug_synchronous
+            );
+            if(error != hipSuccess) return error;
+
+            if(with_values)
+            {
+                hipError_t error = ::rocprim::transform(
+                    values_input, values_tmp, size,
+                    ::rocprim::identity<value_type>(), stream, debug_synchronous
+                );
+                if(error != hipSuccess) return error;
+            }
+
+            from_input = false;
+        }
+    }
+
+    unsigned int bit = begin_bit;
+    for(unsigned int i = 0; i < iterations; i++)
+    {
+        const unsigned int current = i % 2;
+        const unsigned int next = 1 - current;
+        hipError_t error = onesweep_iteration<config, Descending>(
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output, size,
+            digit_counts + i * radix_size,
+            scan_states[current], ordered_bids[current],
+            scan_states[next], ordered_bids[next],
+            blocks,
+            from_input, to_output,
+            bit, end_bit,
+            stream, debug_synchronous
+        );
+        if(error != hipSuccess) return error;
+
+        is_result_in_output = to_output;
+        from_input = false;
+        to_output = !to_output;
+        bit += config::long_radix_bits;
+    }
+
+    return hipSuccess;
+}
+
+template<
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator
+>
+inline
+hipError_t radix_sort_chunked_iterations(void * temporary_storage,
+                                         size_t& storage_size,
+                                         KeysInputIterator keys_input,
+                                         typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                         KeysOutputIterator keys_output,
+                                         ValuesInputIterator values_input,
+                                         typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                         ValuesOutputIterator values_output,
+                                         size_t size,
+                                         bool& is_result_in_output,
+                                         unsigned int begin_bit,
+                                         unsigned int end_bit,
+                                         hipStream_t stream,
+                                         bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using config = Config;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    constexpr unsigned int max_radix_size = 1 << config::long_radix_bits;
+
+    constexpr unsigned int scan_size = config::scan::block_size * config::scan::items_per_thread;
+    constexpr size_t chunk_size = radix_sort_chunk_size<config>();
+
+    const size_t chunks = ::rocprim::detail::ceiling_div(size, chunk_size);
+    const bool with_double_buffer = keys_tmp != nullptr;
+
     const unsigned int bits = end_bit - begin_bit;
     const unsigned int iterations = ::rocprim::detail::ceiling_div(bits, config::long_radix_bits);
     const unsigned int radix_bits_diff = config::long_radix_bits - config::short_radix_bits;
@@ -373,13 +1134,16 @@ hipError_t radix_sort_impl(void * temporary_storage,
     const unsigned int long_iterations = iterations - short_iterations;
 
     const size_t batch_digit_counts_bytes =
-        ::rocprim::detail::align_size(batches * max_radix_size * sizeof(unsigned int));
-    const size_t digit_counts_bytes = ::rocprim::detail::align_size(max_radix_size * sizeof(unsigned int));
+        ::rocprim::detail::align_size(chunks * scan_size * max_radix_size * sizeof(unsigned int));
+    const size_t chunk_digit_counts_bytes =
+        ::rocprim::detail::align_size(chunks * max_radix_size * sizeof(unsigned int));
+    const size_t chunk_digit_starts_bytes =
+        ::rocprim::detail::align_size(chunks * max_radix_size * sizeof(size_t));
     const size_t keys_bytes = ::rocprim::detail::align_size(size * sizeof(key_type));
     const size_t values_bytes = with_values ? ::rocprim::detail::align_size(size * sizeof(value_type)) : 0;
     if(temporary_storage == nullptr)
     {
-        storage_size = batch_digit_counts_bytes + digit_counts_bytes;
+        storage_size = batch_digit_counts_bytes + chunk_digit_counts_bytes + chunk_digit_starts_bytes;
         if(!with_double_buffer)
         {
             storage_size += keys_bytes + values_bytes;
@@ -389,10 +1153,8 @@ hipError_t radix_sort_impl(void * temporary_storage,
 
     if(debug_synchronous)
     {
-        std::cout << "blocks " << blocks << '\n';
-        std::cout << "blocks_per_full_batch " << blocks_per_full_batch << '\n';
-        std::cout << "full_batches " << full_batches << '\n';
-        std::cout << "batches " << batches << '\n';
+        std::cout << "chunks " << chunks << '\n';
+        std::cout << "chunk_size " << chunk_size << '\n';
         std::cout << "iterations " << iterations << '\n';
         std::cout << "long_iterations " << long_iterations << '\n';
         std::cout << "short_iterations " << short_iterations << '\n';
@@ -403,9 +1165,11 @@ hipError_t radix_sort_impl(void * temporary_storage,
     char * ptr = reinterpret_cast<char *>(temporary_storage);
     unsigned int * batch_digit_counts = reinterpret_cast<unsigned int *>(ptr);
     ptr += batch_digit_counts_bytes;
-    unsigned int * digit_counts = reinterpret_cast<unsigned int *>(ptr);
-    ptr += digit_counts_bytes;
-   if(!with_double_buffer)
+    unsigned int * chunk_digit_counts = reinterpret_cast<unsigned int *>(ptr);
+    ptr += chunk_digit_counts_bytes;
+    size_t * chunk_digit_starts = reinterpret_cast<size_t *>(ptr);
+    ptr += chunk_digit_starts_bytes;
+    if(!with_double_buffer)
     {
         keys_tmp = reinterpret_cast<key_type *>(ptr);
         ptr += keys_bytes;
@@ -443,12 +1207,11 @@ hipError_t radix_sort_impl(void * temporary_storage,
     unsigned int bit = begin_bit;
     for(unsigned int i = 0; i < long_iterations; i++)
     {
-        hipError_t error = radix_sort_iteration<config, config::long_radix_bits, Descending>(
+        hipError_t error = radix_sort_chunked_iteration<config, config::long_radix_bits, Descending>(
             keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output, size,
-            batch_digit_counts, digit_counts,
+            batch_digit_counts, chunk_digit_counts, chunk_digit_starts,
             from_input, to_output,
             bit, end_bit,
-            blocks_per_full_batch, full_batches, batches,
             stream, debug_synchronous
         );
         if(error != hipSuccess) return error;
@@ -460,12 +1223,11 @@ hipError_t radix_sort_impl(void * temporary_storage,
     }
     for(unsigned int i = 0; i < short_iterations; i++)
     {
-        hipError_t error = radix_sort_iteration<config, config::short_radix_bits, Descending>(
+        hipError_t error = radix_sort_chunked_iteration<config, config::short_radix_bits, Descending>(
             keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output, size,
-            batch_digit_counts, digit_counts,
+            batch_digit_counts, chunk_digit_counts, chunk_digit_starts,
             from_input, to_output,
             bit, end_bit,
-            blocks_per_full_batch, full_batches, batches,
             stream, debug_synchronous
         );
         if(error != hipSuccess) return error;
@@ -479,6 +1241,73 @@ hipError_t radix_sort_impl(void * temporary_storage,
     return hipSuccess;
 }
 
+template<
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator
+>
+inline
+hipError_t radix_sort_impl(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                           ValuesOutputIterator values_output,
+                           size_t size,
+                           bool& is_result_in_output,
+                           unsigned int begin_bit,
+                           unsigned int end_bit,
+                           hipStream_t stream,
+                           bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    static_assert(
+        std::is_same<key_type, typename std::iterator_traits<KeysOutputIterator>::value_type>::value,
+        "KeysInputIterator and KeysOutputIterator must have the same value_type"
+    );
+    static_assert(
+        std::is_same<value_type, typename std::iterator_traits<ValuesOutputIterator>::value_type>::value,
+        "ValuesInputIterator and ValuesOutputIterator must have the same value_type"
+    );
+
+    using config = default_or_custom_config<
+        Config,
+        default_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
+    >;
+
+    // Radix keys of tuples and user-defined types may have fewer bits than 8 * sizeof(key_type)
+    const unsigned int key_bits = radix_key_codec<key_type>::bits;
+    end_bit = ::rocprim::min(end_bit, key_bits);
+
+    if(size > radix_sort_chunk_size<config>())
+    {
+        return radix_sort_chunked_iterations<config, Descending>(
+            temporary_storage, storage_size,
+            keys_input, keys_tmp, keys_output,
+            values_input, values_tmp, values_output,
+            size, is_result_in_output,
+            begin_bit, end_bit,
+            stream, debug_synchronous
+        );
+    }
+
+    return radix_sort_iterations<config, Descending>(
+        temporary_storage, storage_size,
+        keys_input, keys_tmp, keys_output,
+        values_input, values_tmp, values_output,
+        static_cast<unsigned int>(size), is_result_in_output,
+        begin_bit, end_bit,
+        stream, debug_synchronous
+    );
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // end namespace detail
@@ -493,7 +1322,8 @@ hipError_t radix_sort_impl(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
-/// an arithmetic type (that is, an integral type or a floating-point type).
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
 /// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
 /// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
@@ -568,7 +1398,7 @@ hipError_t radix_sort_keys(void * temporary_storage,
                            size_t& storage_size,
                            KeysInputIterator keys_input,
                            KeysOutputIterator keys_output,
-                           unsigned int size,
+                           size_t size,
                            unsigned int begin_bit = 0,
                            unsigned int end_bit = 8 * sizeof(Key),
                            hipStream_t stream = 0,
@@ -596,7 +1426,8 @@ hipError_t radix_sort_keys(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
-/// an arithmetic type (that is, an integral type or a floating-point type).
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
 /// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
 /// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
@@ -671,7 +1502,7 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
                                 size_t& storage_size,
                                 KeysInputIterator keys_input,
                                 KeysOutputIterator keys_output,
-                                unsigned int size,
+                                size_t size,
                                 unsigned int begin_bit = 0,
                                 unsigned int end_bit = 8 * sizeof(Key),
                                 hipStream_t stream = 0,
@@ -699,7 +1530,8 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
-/// an arithmetic type (that is, an integral type or a floating-point type).
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
 /// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
 /// have at least \p size elements.
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
@@ -794,7 +1626,7 @@ hipError_t radix_sort_pairs(void * temporary_storage,
                             KeysOutputIterator keys_output,
                             ValuesInputIterator values_input,
                             ValuesOutputIterator values_output,
-                            unsigned int size,
+                            size_t size,
                             unsigned int begin_bit = 0,
                             unsigned int end_bit = 8 * sizeof(Key),
                             hipStream_t stream = 0,
@@ -821,7 +1653,8 @@ hipError_t radix_sort_pairs(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
-/// an arithmetic type (that is, an integral type or a floating-point type).
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
 /// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
 /// have at least \p size elements.
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
@@ -912,7 +1745,7 @@ hipError_t radix_sort_pairs_desc(void * temporary_storage,
                                  KeysOutputIterator keys_output,
                                  ValuesInputIterator values_input,
                                  ValuesOutputIterator values_output,
-                                 unsigned int size,
+                                 size_t size,
                                  unsigned int begin_bit = 0,
                                  unsigned int end_bit = 8 * sizeof(Key),
                                  hipStream_t stream = 0,
@@ -944,7 +1777,8 @@ hipError_t radix_sort_pairs_desc(void * temporary_storage,
 /// * The function requires small \p temporary_storage as it does not need
 /// a temporary buffer of \p size elements.
 /// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
+/// type), \p rocprim::tuple of arithmetic types or a type with \p radix_key_decomposer
+/// specialization.
 /// * Buffers of \p keys must have at least \p size elements.
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
 /// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
@@ -1015,7 +1849,7 @@ inline
 hipError_t radix_sort_keys(void * temporary_storage,
                            size_t& storage_size,
                            double_buffer<Key>& keys,
-                           unsigned int size,
+                           size_t size,
                            unsigned int begin_bit = 0,
                            unsigned int end_bit = 8 * sizeof(Key),
                            hipStream_t stream = 0,
@@ -1053,7 +1887,8 @@ hipError_t radix_sort_keys(void * temporary_storage,
 /// * The function requires small \p temporary_storage as it does not need
 /// a temporary buffer of \p size elements.
 /// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
+/// type), \p rocprim::tuple of arithmetic types or a type with \p radix_key_decomposer
+/// specialization.
 /// * Buffers of \p keys must have at least \p size elements.
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
 /// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
@@ -1124,7 +1959,7 @@ inline
 hipError_t radix_sort_keys_desc(void * temporary_storage,
                                 size_t& storage_size,
                                 double_buffer<Key>& keys,
-                                unsigned int size,
+                                size_t size,
                                 unsigned int begin_bit = 0,
                                 unsigned int end_bit = 8 * sizeof(Key),
                                 hipStream_t stream = 0,
@@ -1162,7 +1997,8 @@ hipError_t radix_sort_keys_desc(void * temporary_storage,
 /// * The function requires small \p temporary_storage as it does not need
 /// a temporary buffer of \p size elements.
 /// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
+/// type), \p rocprim::tuple of arithmetic types or a type with \p radix_key_decomposer
+/// specialization.
 /// * Buffers of \p keys must have at least \p size elements.
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
 /// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
@@ -1248,7 +2084,7 @@ hipError_t radix_sort_pairs(void * temporary_storage,
                             size_t& storage_size,
                             double_buffer<Key>& keys,
                             double_buffer<Value>& values,
-                            unsigned int size,
+                            size_t size,
                             unsigned int begin_bit = 0,
                             unsigned int end_bit = 8 * sizeof(Key),
                             hipStream_t stream = 0,
@@ -1286,7 +2122,8 @@ hipError_t radix_sort_pairs(void * temporary_storage,
 /// * The function requires small \p temporary_storage as it does not need
 /// a temporary buffer of \p size elements.
 /// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
+/// type), \p rocprim::tuple of arithmetic types or a type with \p radix_key_decomposer
+/// specialization.
 /// * Buffers of \p keys must have at least \p size elements.
 /// * If \p Key is an integer type and the range of keys is known in advance, the performance
 /// can be improved by setting \p begin_bit and \p end_bit, for example if all keys are in range
@@ -1366,7 +2203,7 @@ hipError_t radix_sort_pairs_desc(void * temporary_storage,
                                  size_t& storage_size,
                                  double_buffer<Key>& keys,
                                  double_buffer<Value>& values,
-                                 unsigned int size,
+                                 size_t size,
                                  unsigned int begin_bit = 0,
                                  unsigned int end_bit = 8 * sizeof(Key),
                                  hipStream_t stream = 0,
@@ -42,15 +42,28 @@ BEGIN_ROCPRIM_NAMESPACE
 /// For example, if \p LongRadixBits is 7, \p ShortRadixBits is 6, \p begin_bit is 0 and \p end_bit is 32
 /// there will be 5 iterations: 7 + 7 + 6 + 6 + 6 = 32 bits.
 ///
+/// When \p UseOnesweep is \p true, the single-pass (onesweep) algorithm is used instead:
+/// digit histograms of all iterations are computed by one kernel upfront, then every
+/// iteration is performed by one sort-and-scatter kernel, which obtains global offsets of
+/// its digits using decoupled look-back. All iterations sort \p LongRadixBits bits (the last one
+/// can be shorter), \p ShortRadixBits is ignored, and \p ScanConfig only limits the number
+/// of blocks of the histogram kernel.
+///
+/// Inputs with more than 2^31 elements are split into chunks that are sorted
+/// together by the iterative algorithm (regardless of \p UseOnesweep): digits are counted
+/// in every chunk and scattered using global 64-bit offsets, so the result is one sorted sequence.
+///
 /// \tparam LongRadixBits - number of bits in long iterations.
 /// \tparam ShortRadixBits - number of bits in short iterations, must be equal to or less than \p LongRadixBits.
 /// \tparam ScanConfig - configuration of digits scan kernel. Must be \p kernel_config.
 /// \tparam SortConfig - configuration of radix sort kernel. Must be \p kernel_config.
+/// \tparam UseOnesweep - whether to use the single-pass (onesweep) algorithm.
 template<
     unsigned int LongRadixBits,
     unsigned int ShortRadixBits,
     class ScanConfig,
-    class SortConfig
+    class SortConfig,
+    bool UseOnesweep = false
 >
 struct radix_sort_config
 {
@@ -62,11 +75,23 @@ struct radix_sort_config
     using scan = ScanConfig;
     /// \brief Configuration of radix sort kernel.
     using sort = SortConfig;
+    /// \brief Whether to use the single-pass (onesweep) algorithm.
+    static constexpr bool use_onesweep = UseOnesweep;
 };
 
 namespace detail
 {
 
+// Custom configs without use_onesweep use the iterative algorithm
+template<class Config, class = void>
+struct select_config_use_onesweep
+    : std::integral_constant<bool, false> { };
+
+template<class Config>
+struct select_config_use_onesweep<
+    Config, void_t<decltype(Config::use_onesweep)>
+> : std::integral_constant<bool, Config::use_onesweep> { };
+
 template<class Key, class Value>
 struct radix_sort_config_803
 {
@@ -108,7 +133,11 @@ struct radix_sort_config_803<Key, empty_type>
         select_type_case<sizeof(Key) == 1, radix_sort_config<8, 7, kernel_config<256, 2>, kernel_config<256, 10> > >,
         select_type_case<sizeof(Key) == 2, radix_sort_config<8, 7, kernel_config<256, 2>, kernel_config<256, 10> > >,
         select_type_case<sizeof(Key) == 4, radix_sort_config<7, 6, kernel_config<256, 2>, kernel_config<256, 9> > >,
-        select_type_case<sizeof(Key) == 8, radix_sort_config<7, 6, kernel_config<256, 2>, kernel_config<256, 7> > >
+        select_type_case<sizeof(Key) == 8, radix_sort_config<7, 6, kernel_config<256, 2>, kernel_config<256, 7> > >,
+        radix_sort_config<
+            6, 4, kernel_config<256, 2>,
+            kernel_config<256, ::rocprim::max(1u, 15u / ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int)))>
+        >
     > { };
 
 template<class Key, class Value>
@@ -152,7 +181,11 @@ struct radix_sort_config_900<Key, empty_type>
         select_type_case<sizeof(Key) == 1, radix_sort_config<4, 3, kernel_config<256, 2>, kernel_config<256, 10> > >,
         select_type_case<sizeof(Key) == 2, radix_sort_config<6, 5, kernel_config<256, 2>, kernel_config<256, 10> > >,
         select_type_case<sizeof(Key) == 4, radix_sort_config<7, 6, kernel_config<256, 2>, kernel_config<256, 17> > >,
-        select_type_case<sizeof(Key) == 8, radix_sort_config<7, 6, kernel_config<256, 2>, kernel_config<256, 15> > >
+        select_type_case<sizeof(Key) == 8, radix_sort_config<7, 6, kernel_config<256, 2>, kernel_config<256, 15> > >,
+        radix_sort_config<
+            6, 4, kernel_config<256, 2>,
+            kernel_config<256, ::rocprim::max(1u, 15u / ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int)))>
+        >
     > { };
 
 template<unsigned int TargetArch, class Key, class Value>
@@ -23,13 +23,19 @@
 
 #include <type_traits>
 #include <iterator>
+#include <algorithm>
 
 #include "../config.hpp"
 #include "../detail/various.hpp"
 #include "../detail/match_result_type.hpp"
 
+#include "../iterator/transform_iterator.hpp"
+#include "../types/tuple.hpp"
+
 #include "device_reduce_config.hpp"
+#include "detail/device_info.hpp"
 #include "detail/device_reduce.hpp"
+#include "detail/device_deterministic_sum.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -60,6 +66,29 @@ void block_reduce_kernel(InputIterator input,
     );
 }
 
+template<
+    bool WithInitialValue,
+    class Config,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class BinaryFunction
+>
+__global__
+void grid_stride_reduce_kernel(InputIterator input,
+                               const size_t size,
+                               OutputIterator output,
+                               ResultType * block_results,
+                               ordered_block_id<unsigned int> finished_blocks,
+                               InitValueType initial_value,
+                               BinaryFunction reduce_op)
+{
+    grid_stride_reduce_kernel_impl<WithInitialValue, Config>(
+        input, size, output, block_results, finished_blocks, initial_value, reduce_op
+    );
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
     if(debug_synchronous) \
     { \
@@ -87,6 +116,81 @@ void block_reduce_kernel(InputIterator input,
     }
 
 
+template<
+    bool WithInitialValue,
+    class Config,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType,
+    class BinaryFunction
+>
+inline
+hipError_t grid_stride_reduce_impl(void * temporary_storage,
+                                   size_t& storage_size,
+                                   InputIterator input,
+                                   OutputIterator output,
+                                   const InitValueType initial_value,
+                                   const size_t size,
+                                   BinaryFunction reduce_op,
+                                   const hipStream_t stream,
+                                   bool debug_synchronous)
+{
+    using result_type = ResultType;
+    using finished_blocks_type = ordered_block_id<unsigned int>;
+
+    constexpr unsigned int block_size = Config::block_size;
+    constexpr unsigned int items_per_block = block_size * Config::items_per_thread;
+
+    device_info info;
+    hipError_t error = get_device_info(info);
+    if(error != hipSuccess) return error;
+    const unsigned int compute_units = info.compute_units;
+
+    // Every block must have at least one tile
+    const size_t number_of_tiles = ::rocprim::detail::ceiling_div<size_t>(size, items_per_block);
+    const unsigned int number_of_blocks = static_cast<unsigned int>(
+        std::min<size_t>(number_of_tiles, compute_units * select_config_persistent_blocks_per_cu<Config>::value)
+    );
+
+    const size_t block_results_bytes =
+        ::rocprim::detail::align_size(number_of_blocks * sizeof(result_type));
+    if(temporary_storage == nullptr)
+    {
+        storage_size = block_results_bytes + finished_blocks_type::get_storage_size();
+        return hipSuccess;
+    }
+
+    char * ptr = reinterpret_cast<char *>(temporary_storage);
+    result_type * block_results = reinterpret_cast<result_type *>(ptr);
+    ptr += block_results_bytes;
+    auto finished_blocks_id = reinterpret_cast<finished_blocks_type::id_type *>(ptr);
+    auto finished_blocks = finished_blocks_type::create(finished_blocks_id);
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "number of tiles " << number_of_tiles << '\n';
+    }
+
+    // The last block resets the counter, but the temporary storage may be
+    // uninitialized or have been used by something else
+    error = hipMemsetAsync(finished_blocks_id, 0, finished_blocks_type::get_storage_size(), stream);
+    if(error != hipSuccess) return error;
+
+    std::chrono::high_resolution_clock::time_point start;
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(detail::grid_stride_reduce_kernel<WithInitialValue, Config, result_type>),
+        dim3(number_of_blocks), dim3(block_size), 0, stream,
+        input, size, output, block_results, finished_blocks, initial_value, reduce_op
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("grid_stride_reduce_kernel", size, start);
+
+    return hipSuccess;
+}
+
 template<
     bool WithInitialValue, // true when inital_value should be used in reduction
     class Config,
@@ -121,6 +225,15 @@ hipError_t reduce_impl(void * temporary_storage,
     constexpr unsigned int items_per_thread = config::items_per_thread;
     constexpr auto items_per_block = block_size * items_per_thread;
 
+    if(select_config_persistent_blocks_per_cu<config>::value > 0 && size > items_per_block)
+    {
+        return grid_stride_reduce_impl<WithInitialValue, config, result_type>(
+            temporary_storage, storage_size,
+            input, output, initial_value, size,
+            reduce_op, stream, debug_synchronous
+        );
+    }
+
     if(temporary_storage == nullptr)
     {
         storage_size = reduce_get_temporary_storage_bytes<result_type>(size, items_per_block);
@@ -188,6 +301,73 @@ hipError_t reduce_impl(void * temporary_storage,
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 #undef ROCPRIM_DETAIL_HIP_SYNC
 
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType
+>
+inline
+hipError_t deterministic_reduce_impl(void * temporary_storage,
+                                     size_t& storage_size,
+                                     InputIterator input,
+                                     OutputIterator output,
+                                     const InitValueType initial_value,
+                                     const size_t size,
+                                     const hipStream_t stream,
+                                     bool debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    const size_t scale_bytes = ::rocprim::detail::align_size(sizeof(deterministic_sum_scale));
+
+    deterministic_sum_scale * scale = nullptr;
+    void * nested_temp_storage = nullptr;
+    size_t nested_temp_storage_size = 0;
+    if(temporary_storage != nullptr)
+    {
+        scale = reinterpret_cast<deterministic_sum_scale *>(temporary_storage);
+        nested_temp_storage = reinterpret_cast<char *>(temporary_storage) + scale_bytes;
+        nested_temp_storage_size = storage_size - scale_bytes;
+    }
+
+    auto stats_input = ::rocprim::make_transform_iterator(
+        input, deterministic_sum_stats_transform_op<input_type>()
+    );
+    auto sum_input = ::rocprim::make_transform_iterator(
+        input, deterministic_sum_split_op<input_type> { scale }
+    );
+    auto scale_output = deterministic_sum_scale_output_iterator(scale);
+    auto sum_output = deterministic_sum_output_iterator<OutputIterator, input_type>(
+        output, scale, static_cast<double>(initial_value)
+    );
+
+    size_t stats_storage_size = nested_temp_storage_size;
+    size_t sum_storage_size = nested_temp_storage_size;
+
+    // The first pass: the maximum and the number of items define the scale
+    hipError_t error = reduce_impl<false, default_config>(
+        nested_temp_storage, stats_storage_size,
+        stats_input, scale_output, deterministic_sum_stats(), size,
+        deterministic_sum_stats_op(), stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    // The second pass: sums of levels
+    error = reduce_impl<false, Config>(
+        nested_temp_storage, sum_storage_size,
+        sum_input, sum_output, deterministic_sum_type(), size,
+        deterministic_sum_op(), stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    if(temporary_storage == nullptr)
+    {
+        storage_size = scale_bytes + std::max(stats_storage_size, sum_storage_size);
+    }
+    return hipSuccess;
+}
+
 } // end of detail namespace
 
 /// \brief Parallel reduction primitive for device level.
@@ -400,6 +580,228 @@ hipError_t reduce(void * temporary_storage,
     );
 }
 
+/// \brief Parallel multi-output reduction primitive for device level.
+///
+/// multi_reduce function performs several device-wide reductions of the same input
+/// range in one pass, each reduction with its own binary operator and initial value.
+/// It is equivalent to several \p reduce calls, but the input is read only once.
+///
+/// \par Overview
+/// * Values of the input range are converted to types of the initial values, the <tt>i</tt>-th
+/// result is the reduction of converted values and <tt>get<i>(initial_values)</tt> using
+/// <tt>get<i>(reduce_ops)</tt>.
+/// * Results are reduced as \p rocprim::tuple values by the same algorithm as \p reduce,
+/// so \p Config is chosen (and tuned) for the tuple of results.
+/// * Does not support non-commutative reduction operators. Reduction operators should also be
+/// associative. When used with non-associative functions the results may be non-deterministic
+/// and/or vary in precision.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
+/// a custom class with the same members.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type. Its
+/// \p value_type must be assignable from <tt>rocprim::tuple<InitValueTypes...></tt>.
+/// \tparam InitValueTypes - types of the initial values (and results) of the reductions.
+/// \tparam BinaryFunctions - types of binary functions used for the reductions.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] initial_values - initial values of the reductions.
+/// \param [in] size - number of element in the input range.
+/// \param [in] reduce_ops - binary operation function objects, one for every reduction.
+/// The signature of the <tt>i</tt>-th function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>, where \p T is the <tt>i</tt>-th type of
+/// \p InitValueTypes. The signature does not need to have <tt>const &</tt>, but function
+/// object must not modify the objects passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the sum, the minimum and the maximum of an array of integer values
+/// are found in one pass.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// using result_type = rocprim::tuple<long long, int, int>;
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;        // e.g., 8
+/// int * input;              // e.g., [4, 7, 6, 2, 5, 1, 3, 8]
+/// result_type * output;     // empty array of 1 element
+///
+/// auto initial_values = rocprim::make_tuple(
+///     0LL, std::numeric_limits<int>::max(), std::numeric_limits<int>::lowest()
+/// );
+/// auto reduce_ops = rocprim::make_tuple(
+///     rocprim::plus<long long>(), rocprim::minimum<int>(), rocprim::maximum<int>()
+/// );
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::multi_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, initial_values, input_size, reduce_ops
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform reductions
+/// rocprim::multi_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, initial_values, input_size, reduce_ops
+/// );
+/// // output: [{36, 1, 8}]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class... InitValueTypes,
+    class... BinaryFunctions
+>
+inline
+hipError_t multi_reduce(void * temporary_storage,
+                        size_t& storage_size,
+                        InputIterator input,
+                        OutputIterator output,
+                        const ::rocprim::tuple<InitValueTypes...> initial_values,
+                        const size_t size,
+                        const ::rocprim::tuple<BinaryFunctions...> reduce_ops,
+                        const hipStream_t stream = 0,
+                        bool debug_synchronous = false)
+{
+    static_assert(
+        sizeof...(InitValueTypes) == sizeof...(BinaryFunctions),
+        "The number of initial values must be equal to the number of reduction operators"
+    );
+    using result_type = ::rocprim::tuple<InitValueTypes...>;
+
+    return detail::reduce_impl<true, Config>(
+        temporary_storage, storage_size,
+        ::rocprim::make_transform_iterator(input, detail::multi_reduce_broadcast_op<result_type>()),
+        output, initial_values, size,
+        detail::multi_reduce_op<BinaryFunctions...> { reduce_ops },
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Deterministic parallel sum primitive for device level.
+///
+/// deterministic_reduce function calculates the sum of floating-point values. Unlike \p reduce
+/// with \p rocprim::plus, the result does not depend on the configuration (\p Config), block
+/// sizes and the target architecture, so it is bitwise reproducible between runs, devices and
+/// builds.
+///
+/// \par Overview
+/// * Items are summed using a fixed-point representation with 3 levels of 63 - log2(\p size)
+/// bits each, scaled by the maximum absolute value of items. Integer sums are exact and do not
+/// depend on the order of additions. Bits less significant than 2^(e - 3 * (63 - log2(size))),
+/// where 2^e is greater than the maximum absolute value, are discarded, so the result is
+/// usually as accurate as the sum calculated with \p double.
+/// * Input values are read twice: the first pass finds the maximum absolute value (and NaNs and
+/// infinities), the second pass calculates sums of levels.
+/// * The result is NaN if the input contains NaNs or infinities of both signs, it is infinity
+/// if the input contains infinities of one sign. Negative zero sum is returned as positive zero.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+///
+/// \tparam Config - [optional] configuration of the second pass. It can be \p reduce_config or
+/// a custom class with the same members. It affects performance only.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type. Its
+/// \p value_type must be \p float or \p double, it is also the type of the result.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value, it must be convertible to \p double.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] initial_value - initial value, it is added to the sum of items.
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 4
+/// float * input;        // e.g., [1e8, 1.0, -1e8, 1.0]
+/// float * output;       // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::deterministic_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0.0f, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform reduce
+/// rocprim::deterministic_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0.0f, input_size
+/// );
+/// // output: [2.0]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class InitValueType
+>
+inline
+hipError_t deterministic_reduce(void * temporary_storage,
+                                size_t& storage_size,
+                                InputIterator input,
+                                OutputIterator output,
+                                const InitValueType initial_value,
+                                const size_t size,
+                                const hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+{
+    return detail::deterministic_reduce_impl<Config>(
+        temporary_storage, storage_size,
+        input, output, initial_value, size,
+        stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
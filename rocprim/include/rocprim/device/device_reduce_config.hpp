@@ -40,10 +40,19 @@ BEGIN_ROCPRIM_NAMESPACE
 /// \tparam BlockSize - number of threads in a block.
 /// \tparam ItemsPerThread - number of items processed by each thread.
 /// \tparam BlockReduceMethod - algorithm for block reduce.
+/// \tparam PersistentBlocksPerCU - [optional] if it is \p 0 (default), every block reduces one
+/// tile of <tt>BlockSize * ItemsPerThread</tt> items and partial results are reduced by
+/// additional kernel launches. Otherwise a single kernel is launched with a grid of at most
+/// <tt>PersistentBlocksPerCU</tt> blocks per compute unit, each block reduces several tiles
+/// (grid-stride loop) and the last block to finish reduces partial results of all blocks.
+/// The latter requires temporary storage proportional to the number of compute units only,
+/// and it avoids launch overhead which dominates reductions of small and mid-sized inputs.
+/// It is not used by \p segmented_reduce, see \p balanced_segmented_reduce_config.
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
-    ::rocprim::block_reduce_algorithm BlockReduceMethod
+    ::rocprim::block_reduce_algorithm BlockReduceMethod,
+    unsigned int PersistentBlocksPerCU = 0
 >
 struct reduce_config
 {
@@ -53,11 +62,59 @@ struct reduce_config
     static constexpr unsigned int items_per_thread = ItemsPerThread;
     /// \brief Algorithm for block reduce.
     static constexpr block_reduce_algorithm block_reduce_method = BlockReduceMethod;
+    /// \brief Maximum number of persistent blocks per compute unit (\p 0 if disabled).
+    static constexpr unsigned int persistent_blocks_per_cu = PersistentBlocksPerCU;
+};
+
+/// \brief Configuration of load-balanced \p segmented_reduce.
+///
+/// Short segments (up to the warp size multiplied by \p ItemsPerThread items) are reduced by
+/// warps, several segments per block. Longer segments are split into tiles of
+/// <tt>BlockSize * ItemsPerThread</tt> items which are evenly distributed among
+/// <tt>BalancedBlocksPerCU</tt> blocks per compute unit. This requires additional launches,
+/// so it is faster than one block per segment (\p reduce_config) only when lengths of segments
+/// are skewed.
+///
+/// \tparam BlockSize - number of threads in a block.
+/// \tparam ItemsPerThread - number of items processed by each thread.
+/// \tparam BlockReduceMethod - algorithm for block reduce.
+/// \tparam BalancedBlocksPerCU - number of blocks per compute unit which reduce long segments.
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    ::rocprim::block_reduce_algorithm BlockReduceMethod,
+    unsigned int BalancedBlocksPerCU = 4
+>
+struct balanced_segmented_reduce_config
+    : reduce_config<BlockSize, ItemsPerThread, BlockReduceMethod>
+{
+    /// \brief Number of blocks per compute unit which reduce long segments.
+    static constexpr unsigned int balanced_blocks_per_cu = BalancedBlocksPerCU;
 };
 
 namespace detail
 {
 
+// Configs without balanced_blocks_per_cu reduce every segment by one block
+template<class Config, class = void>
+struct select_config_balanced_blocks_per_cu
+    : std::integral_constant<unsigned int, 0> { };
+
+template<class Config>
+struct select_config_balanced_blocks_per_cu<
+    Config, void_t<decltype(Config::balanced_blocks_per_cu)>
+> : std::integral_constant<unsigned int, Config::balanced_blocks_per_cu> { };
+
+// Custom configs without persistent_blocks_per_cu use the block-per-tile reduction
+template<class Config, class = void>
+struct select_config_persistent_blocks_per_cu
+    : std::integral_constant<unsigned int, 0> { };
+
+template<class Config>
+struct select_config_persistent_blocks_per_cu<
+    Config, void_t<decltype(Config::persistent_blocks_per_cu)>
+> : std::integral_constant<unsigned int, Config::persistent_blocks_per_cu> { };
+
 template<class Value>
 struct reduce_config_803
 {
@@ -28,13 +28,11 @@
 #include "../detail/various.hpp"
 
 #include "../iterator/constant_iterator.hpp"
-#include "../iterator/counting_iterator.hpp"
-#include "../iterator/discard_iterator.hpp"
-#include "../iterator/zip_iterator.hpp"
 
 #include "device_run_length_encode_config.hpp"
 #include "device_reduce_by_key.hpp"
 #include "device_select.hpp"
+#include "detail/device_run_length_encode.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -44,6 +42,43 @@ BEGIN_ROCPRIM_NAMESPACE
 namespace detail
 {
 
+template<
+    class Config,
+    class InputIterator,
+    class OffsetsOutputIterator,
+    class CountsOutputIterator,
+    class RunsCountOutputIterator,
+    class EqualityOp,
+    class LookbackScanState
+>
+__global__
+void non_trivial_runs_kernel(InputIterator input,
+                             const unsigned int size,
+                             OffsetsOutputIterator offsets_output,
+                             CountsOutputIterator counts_output,
+                             RunsCountOutputIterator runs_count_output,
+                             EqualityOp equality_op,
+                             LookbackScanState scan_state,
+                             const unsigned int number_of_blocks,
+                             ordered_block_id<unsigned int> ordered_bid)
+{
+    non_trivial_runs_kernel_impl<Config>(
+        input, size, offsets_output, counts_output, runs_count_output,
+        equality_op, scan_state, number_of_blocks, ordered_bid
+    );
+}
+
+template<class LookBackScanState>
+__global__
+void init_non_trivial_runs_scan_state_kernel(LookBackScanState scan_state,
+                                             const unsigned int number_of_blocks,
+                                             ordered_block_id<unsigned int> ordered_bid)
+{
+    init_lookback_scan_state_kernel_impl(
+        scan_state, number_of_blocks, ordered_bid
+    );
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
     { \
         if(error != hipSuccess) return error; \
@@ -186,6 +221,8 @@ hipError_t run_length_encode(void * temporary_storage,
 /// \par Overview
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
+/// * The input is read once by a single-pass kernel which writes only non-trivial runs,
+/// it is configured by \p select member of \p Config.
 /// * Range specified by \p input must have at least \p size elements.
 /// * Range specified by \p runs_count_output must have at least 1 element.
 /// * Ranges specified by \p offsets_output and \p counts_output must have at least
@@ -275,128 +312,76 @@ hipError_t run_length_encode_non_trivial_runs(void * temporary_storage,
                                               bool debug_synchronous = false)
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
-    using offset_type = unsigned int;
-    using count_type = unsigned int;
-    using offset_count_pair = typename ::rocprim::tuple<offset_type, count_type>;
 
     using config = detail::default_or_custom_config<
         Config,
         detail::default_run_length_encode_config
     >;
+    using select_config = detail::default_or_custom_config<
+        typename config::select,
+        detail::default_select_config<ROCPRIM_TARGET_ARCH, input_type>
+    >;
 
-    hipError_t error;
-
-    auto reduce_op = [] __device__ (const offset_count_pair& a, const offset_count_pair& b)
-    {
-        return offset_count_pair(
-            ::rocprim::get<0>(a), // Always use offset of the first item of the run
-            ::rocprim::get<1>(a) + ::rocprim::get<1>(b) // Number of items in the run
-        );
-    };
-    auto non_trivial_runs_select_op = [] __device__ (const offset_count_pair& a)
-    {
-        return ::rocprim::get<1>(a) > 1;
-    };
+    // Pairs of (number of non-trivial runs, offset of the last non-trivial run)
+    using pair_type = detail::scan_by_key_pair<unsigned int>;
+    // Storage size does not depend on the back-off policy
+    using scan_state_size_type = detail::lookback_scan_state<pair_type>;
+    using ordered_block_id_type = detail::ordered_block_id<unsigned int>;
 
-    offset_type * offsets_tmp = nullptr;
-    count_type * counts_tmp = nullptr;
-    count_type * all_runs_count_tmp = nullptr;
+    constexpr unsigned int block_size = select_config::block_size;
+    constexpr unsigned int items_per_thread = select_config::items_per_thread;
+    constexpr auto items_per_block = block_size * items_per_thread;
+    const unsigned int number_of_blocks =
+        std::max(1u, ::rocprim::detail::ceiling_div(size, items_per_block));
 
-    // Calculate size of temporary storage for reduce_by_key operation
-    size_t reduce_by_key_bytes;
-    error = ::rocprim::reduce_by_key<typename config::reduce_by_key>(
-        nullptr, reduce_by_key_bytes,
-        input,
-        ::rocprim::make_zip_iterator(
-            ::rocprim::make_tuple(
-                ::rocprim::make_counting_iterator<offset_type>(0),
-                ::rocprim::make_constant_iterator<count_type>(1)
-            )
-        ),
-        size,
-        ::rocprim::make_discard_iterator(),
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        all_runs_count_tmp,
-        reduce_op, ::rocprim::equal_to<input_type>(),
-        stream, debug_synchronous
+    // Calculate required temporary storage
+    const size_t scan_state_bytes = ::rocprim::detail::align_size(
+        scan_state_size_type::get_storage_size(number_of_blocks)
     );
-    if(error != hipSuccess) return error;
-    reduce_by_key_bytes = ::rocprim::detail::align_size(reduce_by_key_bytes);
-
-    // Calculate size of temporary storage for select operation
-    size_t select_bytes;
-    error = ::rocprim::select<typename config::select>(
-        nullptr, select_bytes,
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_output, counts_output)),
-        runs_count_output,
-        size,
-        non_trivial_runs_select_op,
-        stream, debug_synchronous
-    );
-    if(error != hipSuccess) return error;
-    select_bytes = ::rocprim::detail::align_size(select_bytes);
-
-    const size_t offsets_tmp_bytes = ::rocprim::detail::align_size(size * sizeof(offset_type));
-    const size_t counts_tmp_bytes = ::rocprim::detail::align_size(size * sizeof(count_type));
-    const size_t all_runs_count_tmp_bytes = sizeof(count_type);
+    const size_t ordered_block_id_bytes = ordered_block_id_type::get_storage_size();
     if(temporary_storage == nullptr)
     {
-        storage_size = ::rocprim::max(reduce_by_key_bytes, select_bytes) +
-            offsets_tmp_bytes + counts_tmp_bytes + all_runs_count_tmp_bytes;
+        // storage_size is never zero
+        storage_size = scan_state_bytes + ordered_block_id_bytes;
         return hipSuccess;
     }
 
-    char * ptr = reinterpret_cast<char *>(temporary_storage);
-    ptr += ::rocprim::max(reduce_by_key_bytes, select_bytes);
-    offsets_tmp = reinterpret_cast<offset_type *>(ptr);
-    ptr += offsets_tmp_bytes;
-    counts_tmp = reinterpret_cast<count_type *>(ptr);
-    ptr += counts_tmp_bytes;
-    all_runs_count_tmp = reinterpret_cast<count_type *>(ptr);
+    return detail::with_lookback_backoff<detail::config_lookback_backoff<select_config>::value>(
+        [&](auto backoff_policy) -> hipError_t
+        {
+            using scan_state_type = detail::lookback_scan_state<pair_type, decltype(backoff_policy)>;
 
-    std::chrono::high_resolution_clock::time_point start;
+            auto scan_state = scan_state_type::create(temporary_storage, number_of_blocks);
+            auto ptr = reinterpret_cast<char*>(temporary_storage);
+            auto ordered_bid = ordered_block_id_type::create(
+                reinterpret_cast<ordered_block_id_type::id_type*>(ptr + scan_state_bytes)
+            );
 
-    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-    error = ::rocprim::reduce_by_key<typename config::reduce_by_key>(
-        temporary_storage, reduce_by_key_bytes,
-        input,
-        ::rocprim::make_zip_iterator(
-            ::rocprim::make_tuple(
-                ::rocprim::make_counting_iterator<offset_type>(0),
-                ::rocprim::make_constant_iterator<count_type>(1)
-            )
-        ),
-        size,
-        ::rocprim::make_discard_iterator(), // Ignore unique output
-        ::rocprim::make_zip_iterator(rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        all_runs_count_tmp,
-        reduce_op, ::rocprim::equal_to<input_type>(),
-        stream, debug_synchronous
-    );
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::reduce_by_key", size, start)
+            std::chrono::high_resolution_clock::time_point start;
 
-    // Read count of all runs (including trivial runs)
-    count_type all_runs_count;
-    error = hipMemcpyAsync(&all_runs_count, all_runs_count_tmp, sizeof(count_type), hipMemcpyDeviceToHost, stream);
-    if(error != hipSuccess) return error;
-    error = hipStreamSynchronize(stream);
-    if(error != hipSuccess) return error;
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            const unsigned int init_grid_size = ::rocprim::detail::ceiling_div(number_of_blocks, block_size);
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(detail::init_non_trivial_runs_scan_state_kernel<scan_state_type>),
+                dim3(init_grid_size), dim3(block_size), 0, stream,
+                scan_state, number_of_blocks, ordered_bid
+            );
+            hipError_t error = hipPeekAtLastError();
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_non_trivial_runs_scan_state_kernel", size, start)
 
-    // Select non-trivial runs
-    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-    error = ::rocprim::select<typename config::select>(
-        temporary_storage, select_bytes,
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_output, counts_output)),
-        runs_count_output,
-        all_runs_count,
-        non_trivial_runs_select_op,
-        stream, debug_synchronous
-    );
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::select", all_runs_count, start)
+            if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(detail::non_trivial_runs_kernel<select_config>),
+                dim3(number_of_blocks), dim3(block_size), 0, stream,
+                input, size, offsets_output, counts_output, runs_count_output,
+                ::rocprim::equal_to<input_type>(), scan_state, number_of_blocks, ordered_bid
+            );
+            error = hipPeekAtLastError();
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("non_trivial_runs_kernel", size, start)
 
-    return hipSuccess;
+            return hipSuccess;
+        }
+    );
 }
 
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
@@ -37,7 +37,8 @@ BEGIN_ROCPRIM_NAMESPACE
 ///
 /// \tparam ReduceByKeyConfig - configuration of device-level reduce-by-key operation.
 /// Must be \p reduce_by_key_config or \p default_config.
-/// \tparam SelectConfig - configuration of device-level select operation.
+/// \tparam SelectConfig - configuration of device-level select operation, it is also used
+/// by the single-pass kernel of \p run_length_encode_non_trivial_runs.
 /// Must be \p select_config or \p default_config.
 template<
     class ReduceByKeyConfig,
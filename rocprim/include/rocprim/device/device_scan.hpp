@@ -23,6 +23,7 @@
 
 #include <type_traits>
 #include <iterator>
+#include <algorithm>
 
 #include "../config.hpp"
 #include "../functional.hpp"
@@ -30,9 +31,11 @@
 #include "../detail/various.hpp"
 #include "../detail/match_result_type.hpp"
 
+#include "device_reduce.hpp"
 #include "device_scan_config.hpp"
 #include "detail/device_scan_reduce_then_scan.hpp"
 #include "detail/device_scan_lookback.hpp"
+#include "detail/device_deterministic_sum.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -324,8 +327,8 @@ auto scan_impl(void * temporary_storage,
 
     using config = Config;
 
-    using scan_state_type = detail::lookback_scan_state<result_type>;
-    using scan_state_with_sleep_type = detail::lookback_scan_state<result_type, true>;
+    // Storage size does not depend on the back-off policy
+    using scan_state_size_type = detail::lookback_scan_state<result_type>;
     using ordered_block_id_type = detail::ordered_block_id<unsigned int>;
 
     constexpr unsigned int block_size = config::block_size;
@@ -335,8 +338,7 @@ auto scan_impl(void * temporary_storage,
 
     // Calculate required temporary storage
     size_t scan_state_bytes = ::rocprim::detail::align_size(
-        // This is valid even with scan_state_with_sleep_type
-        scan_state_type::get_storage_size(number_of_blocks)
+        scan_state_size_type::get_storage_size(number_of_blocks)
     );
     size_t ordered_block_id_bytes = ordered_block_id_type::get_storage_size();
     if(temporary_storage == nullptr)
@@ -358,69 +360,47 @@ auto scan_impl(void * temporary_storage,
 
     if(number_of_blocks > 1)
     {
-        // Create and initialize lookback_scan_state obj
-        auto scan_state = scan_state_type::create(temporary_storage, number_of_blocks);
-        auto scan_state_with_sleep = scan_state_with_sleep_type::create(temporary_storage, number_of_blocks);
-        // Create ad initialize ordered_block_id obj
-        auto ptr = reinterpret_cast<char*>(temporary_storage);
-        auto ordered_bid = ordered_block_id_type::create(
-            reinterpret_cast<ordered_block_id_type::id_type*>(ptr + scan_state_bytes)
+        return with_lookback_backoff<config_lookback_backoff<config>::value>(
+            [&](auto backoff_policy) -> hipError_t
+            {
+                using scan_state_type = detail::lookback_scan_state<
+                    result_type, decltype(backoff_policy)
+                >;
+
+                // Create and initialize lookback_scan_state obj
+                auto scan_state = scan_state_type::create(temporary_storage, number_of_blocks);
+                // Create ad initialize ordered_block_id obj
+                auto ptr = reinterpret_cast<char*>(temporary_storage);
+                auto ordered_bid = ordered_block_id_type::create(
+                    reinterpret_cast<ordered_block_id_type::id_type*>(ptr + scan_state_bytes)
+                );
+
+                if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+                auto grid_size = (number_of_blocks + block_size - 1)/block_size;
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_type>),
+                    dim3(grid_size), dim3(block_size), 0, stream,
+                    scan_state, number_of_blocks, ordered_bid
+                );
+                ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel", size, start)
+
+                if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+                grid_size = number_of_blocks;
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(lookback_scan_kernel<
+                        Exclusive, // flag for exclusive scan operation
+                        config, // kernel configuration (block size, ipt)
+                        InputIterator, OutputIterator,
+                        BinaryFunction, result_type, scan_state_type
+                    >),
+                    dim3(grid_size), dim3(block_size), 0, stream,
+                    input, output, size, static_cast<result_type>(initial_value),
+                    scan_op, scan_state, number_of_blocks, ordered_bid
+                );
+                ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("lookback_scan_kernel", size, start)
+                return hipSuccess;
+            }
         );
-
-        hipDeviceProp_t prop;
-        int deviceId;
-        hipGetDevice(&deviceId);
-        hipGetDeviceProperties(&prop, deviceId);
-
-        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-        auto grid_size = (number_of_blocks + block_size - 1)/block_size;
-        if (prop.gcnArch == 908) 
-        {
-            hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_with_sleep_type>),
-                dim3(grid_size), dim3(block_size), 0, stream,
-                scan_state_with_sleep, number_of_blocks, ordered_bid
-            );
-        } else
-        {
-            hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(init_lookback_scan_state_kernel<scan_state_type>),
-                dim3(grid_size), dim3(block_size), 0, stream,
-                scan_state, number_of_blocks, ordered_bid
-            );
-        }
-        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel", size, start)
-
-        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
-        grid_size = number_of_blocks;
-        if (prop.gcnArch == 908) 
-        {
-            hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(lookback_scan_kernel<
-                    Exclusive, // flag for exclusive scan operation
-                    config, // kernel configuration (block size, ipt)
-                    InputIterator, OutputIterator,
-                    BinaryFunction, result_type, scan_state_with_sleep_type
-                >),
-                dim3(grid_size), dim3(block_size), 0, stream,
-                input, output, size, static_cast<result_type>(initial_value),
-                scan_op, scan_state_with_sleep, number_of_blocks, ordered_bid
-            );
-        } else 
-        {
-            hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(lookback_scan_kernel<
-                    Exclusive, // flag for exclusive scan operation
-                    config, // kernel configuration (block size, ipt)
-                    InputIterator, OutputIterator,
-                    BinaryFunction, result_type, scan_state_type
-                >),
-                dim3(grid_size), dim3(block_size), 0, stream,
-                input, output, size, static_cast<result_type>(initial_value),
-                scan_op, scan_state, number_of_blocks, ordered_bid
-            );
-        }
-        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("lookback_scan_kernel", size, start)
     }
     else
     {
@@ -442,6 +422,78 @@ auto scan_impl(void * temporary_storage,
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 #undef ROCPRIM_DETAIL_HIP_SYNC
 
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator
+>
+inline
+hipError_t deterministic_inclusive_scan_impl(void * temporary_storage,
+                                             size_t& storage_size,
+                                             InputIterator input,
+                                             OutputIterator output,
+                                             const size_t size,
+                                             const hipStream_t stream,
+                                             bool debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = default_or_custom_config<
+        Config,
+        default_scan_config<ROCPRIM_TARGET_ARCH, deterministic_sum_type>
+    >;
+
+    const size_t scale_bytes = ::rocprim::detail::align_size(sizeof(deterministic_sum_scale));
+
+    deterministic_sum_scale * scale = nullptr;
+    void * nested_temp_storage = nullptr;
+    size_t nested_temp_storage_size = 0;
+    if(temporary_storage != nullptr)
+    {
+        scale = reinterpret_cast<deterministic_sum_scale *>(temporary_storage);
+        nested_temp_storage = reinterpret_cast<char *>(temporary_storage) + scale_bytes;
+        nested_temp_storage_size = storage_size - scale_bytes;
+    }
+
+    auto stats_input = ::rocprim::make_transform_iterator(
+        input, deterministic_sum_stats_transform_op<input_type>()
+    );
+    auto sum_input = ::rocprim::make_transform_iterator(
+        input, deterministic_sum_split_op<input_type> { scale }
+    );
+    auto scale_output = deterministic_sum_scale_output_iterator(scale);
+    auto sum_output = deterministic_sum_output_iterator<OutputIterator, input_type>(
+        output, scale, 0.0
+    );
+
+    size_t stats_storage_size = nested_temp_storage_size;
+    size_t scan_storage_size = nested_temp_storage_size;
+
+    // The first pass: the maximum and the number of items define the scale
+    hipError_t error = reduce_impl<false, default_config>(
+        nested_temp_storage, stats_storage_size,
+        stats_input, scale_output, deterministic_sum_stats(), size,
+        deterministic_sum_stats_op(), stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    // The second pass: prefix sums of levels
+    error = scan_impl<false, config>(
+        nested_temp_storage, scan_storage_size,
+        // deterministic_sum_type() is a dummy initial value (not used)
+        sum_input, sum_output, deterministic_sum_type(), size,
+        deterministic_sum_op(), stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    if(temporary_storage == nullptr)
+    {
+        storage_size = scale_bytes + std::max(stats_storage_size, scan_storage_size);
+    }
+    return hipSuccess;
+}
+
 } // end of detail namespace
 
 /// \brief Parallel inclusive scan primitive for device level.
@@ -673,6 +725,98 @@ hipError_t exclusive_scan(void * temporary_storage,
     );
 }
 
+/// \brief Deterministic parallel inclusive prefix sum primitive for device level.
+///
+/// deterministic_inclusive_scan function calculates inclusive prefix sums of floating-point
+/// values. Unlike \p inclusive_scan with \p rocprim::plus, results do not depend on
+/// the configuration (\p Config), block sizes and the target architecture, so they are
+/// bitwise reproducible between runs, devices and builds.
+///
+/// \par Overview
+/// * Prefix sums are calculated in the same way as \p deterministic_reduce does: using
+/// a fixed-point representation with 3 levels scaled by the maximum absolute value of
+/// all items of the input range. Every output value is converted from exact integer prefix
+/// sums, so it does not depend on the order of additions.
+/// * Input values are read twice: the first pass finds the maximum absolute value (and NaNs and
+/// infinities), the second pass calculates prefix sums.
+/// * If the input contains NaNs or infinities, all output values are NaN or infinity (see
+/// \p deterministic_reduce).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+///
+/// \tparam Config - [optional] configuration of the second pass. It can be \p scan_config or
+/// a custom class with the same members. It affects performance only.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type. Its
+/// \p value_type must be \p float or \p double, it is also the type of output values.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 4
+/// double * input;       // e.g., [0.5, 1e20, 0.25, -1e20]
+/// double * output;      // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::deterministic_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::deterministic_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// // output: [0.5, 1e20, 1e20, 0.75]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator
+>
+inline
+hipError_t deterministic_inclusive_scan(void * temporary_storage,
+                                        size_t& storage_size,
+                                        InputIterator input,
+                                        OutputIterator output,
+                                        const size_t size,
+                                        const hipStream_t stream = 0,
+                                        bool debug_synchronous = false)
+{
+    return detail::deterministic_inclusive_scan_impl<Config>(
+        temporary_storage, storage_size,
+        input, output, size,
+        stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
@@ -45,13 +45,15 @@ BEGIN_ROCPRIM_NAMESPACE
 /// \tparam BlockLoadMethod - method for loading input values.
 /// \tparam StoreLoadMethod - method for storing values.
 /// \tparam BlockScanMethod - algorithm for block scan.
+/// \tparam Backoff - [optional] strategy of waiting for prefixes of previous blocks in lookback scan.
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     bool UseLookback,
     ::rocprim::block_load_method BlockLoadMethod,
     ::rocprim::block_store_method BlockStoreMethod,
-    ::rocprim::block_scan_algorithm BlockScanMethod
+    ::rocprim::block_scan_algorithm BlockScanMethod,
+    ::rocprim::lookback_backoff Backoff = ::rocprim::lookback_backoff::automatic
 >
 struct scan_config
 {
@@ -67,6 +69,8 @@ struct scan_config
     static constexpr block_store_method block_store_method = BlockStoreMethod;
     /// \brief Algorithm for block scan.
     static constexpr block_scan_algorithm block_scan_method = BlockScanMethod;
+    /// \brief Strategy of waiting for prefixes of previous blocks in lookback scan.
+    static constexpr ::rocprim::lookback_backoff backoff = Backoff;
 };
 
 namespace detail
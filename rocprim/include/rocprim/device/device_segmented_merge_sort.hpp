@@ -0,0 +1,515 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "device_merge_sort.hpp"
+#include "device_segmented_merge_sort_config.hpp"
+#include "detail/device_segment_bins.hpp"
+#include "detail/device_segmented_merge_sort.hpp"
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<
+    unsigned int LogicalWarpSize,
+    unsigned int BlockSize,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+__global__
+void segmented_merge_sort_warp_kernel(KeysInputIterator keys_input,
+                                      KeysOutputIterator keys_output,
+                                      ValuesInputIterator values_input,
+                                      ValuesOutputIterator values_output,
+                                      unsigned int segments,
+                                      OffsetIterator begin_offsets,
+                                      OffsetIterator end_offsets,
+                                      BinaryFunction compare_function)
+{
+    segmented_merge_sort_warp<LogicalWarpSize, BlockSize>(
+        keys_input, keys_output, values_input, values_output,
+        segments, begin_offsets, end_offsets,
+        compare_function
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+__global__
+void segmented_merge_sort_block_kernel(KeysInputIterator keys_input,
+                                       typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                       KeysOutputIterator keys_output,
+                                       ValuesInputIterator values_input,
+                                       typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                       ValuesOutputIterator values_output,
+                                       OffsetIterator begin_offsets,
+                                       OffsetIterator end_offsets,
+                                       BinaryFunction compare_function)
+{
+    segmented_merge_sort_block<BlockSize, ItemsPerThread>(
+        keys_input, keys_tmp, keys_output,
+        values_input, values_tmp, values_output,
+        begin_offsets, end_offsets,
+        compare_function
+    );
+}
+
+#define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
+    { \
+        auto error = hipPeekAtLastError(); \
+        if(error != hipSuccess) return error; \
+        if(debug_synchronous) \
+        { \
+            std::cout << name << "(" << size << ")"; \
+            auto error = hipStreamSynchronize(stream); \
+            if(error != hipSuccess) return error; \
+            auto end = std::chrono::high_resolution_clock::now(); \
+            auto d = std::chrono::duration_cast<std::chrono::duration<double>>(end - start); \
+            std::cout << " " << d.count() * 1000 << " ms" << '\n'; \
+        } \
+    }
+
+template<
+    class Config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction
+>
+inline
+hipError_t segmented_merge_sort_impl(void * temporary_storage,
+                                     size_t& storage_size,
+                                     KeysInputIterator keys_input,
+                                     KeysOutputIterator keys_output,
+                                     ValuesInputIterator values_input,
+                                     ValuesOutputIterator values_output,
+                                     unsigned int size,
+                                     unsigned int segments,
+                                     OffsetIterator begin_offsets,
+                                     OffsetIterator end_offsets,
+                                     BinaryFunction compare_function,
+                                     hipStream_t stream,
+                                     bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    using config = default_or_custom_config<
+        Config,
+        default_segmented_merge_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
+    >;
+    using sort_config = typename config::sort;
+    // Long segments are sorted by device-wide merge sort with the same tiles
+    using merge_sort_config_type = merge_sort_config<sort_config::block_size, sort_config::items_per_thread>;
+
+    static_assert(
+        config::logical_warp_size <= ::rocprim::warp_size()
+            && ::rocprim::detail::is_power_of_two(config::logical_warp_size),
+        "LogicalWarpSize must be a power of two and must not be greater than warp size"
+    );
+    static_assert(
+        config::warp_sort_block_size % config::logical_warp_size == 0,
+        "WarpSortBlockSize must be a multiple of LogicalWarpSize"
+    );
+
+    constexpr unsigned int warps_per_block = config::warp_sort_block_size / config::logical_warp_size;
+
+    segment_bins<offset_type> bins;
+    size_t bins_bytes;
+    hipError_t error = partition_segment_bins(
+        nullptr, bins_bytes,
+        segments, begin_offsets, end_offsets,
+        config::logical_warp_size, config::device_sort_threshold,
+        bins, stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    bins_bytes = ::rocprim::detail::align_size(bins_bytes);
+    // The buffer is used by blocks sorting segments and then as temporary storage
+    // of device-wide merge sort
+    const size_t keys_bytes = ::rocprim::detail::align_size(size * sizeof(key_type));
+    const size_t values_bytes = with_values ? ::rocprim::detail::align_size(size * sizeof(value_type)) : 0;
+    if(temporary_storage == nullptr)
+    {
+        storage_size = bins_bytes + keys_bytes + values_bytes;
+        // Make sure user won't try to allocate 0 bytes memory
+        storage_size = storage_size == 0 ? 4 : storage_size;
+        return hipSuccess;
+    }
+
+    if(segments == 0u)
+    {
+        return hipSuccess;
+    }
+
+    char * ptr = reinterpret_cast<char *>(temporary_storage);
+    void * bins_storage = ptr;
+    ptr += bins_bytes;
+    void * buffer_storage = ptr;
+    key_type * keys_tmp = reinterpret_cast<key_type *>(ptr);
+    ptr += keys_bytes;
+    value_type * values_tmp = with_values ? reinterpret_cast<value_type *>(ptr) : nullptr;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    error = partition_segment_bins(
+        bins_storage, bins_bytes,
+        segments, begin_offsets, end_offsets,
+        config::logical_warp_size, config::device_sort_threshold,
+        bins, stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    if(bins.short_segments > 0)
+    {
+        const unsigned int warp_sort_blocks = ::rocprim::detail::ceiling_div(bins.short_segments, warps_per_block);
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_merge_sort_warp_kernel<config::logical_warp_size, config::warp_sort_block_size>),
+            dim3(warp_sort_blocks), dim3(config::warp_sort_block_size), 0, stream,
+            keys_input, keys_output, values_input, values_output,
+            bins.short_segments, bins.short_begin_offsets, bins.short_end_offsets,
+            compare_function
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort_warp", bins.short_segments, start)
+    }
+
+    if(bins.medium_segments > 0)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_merge_sort_block_kernel<sort_config::block_size, sort_config::items_per_thread>),
+            dim3(bins.medium_segments), dim3(sort_config::block_size), 0, stream,
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+            bins.medium_begin_offsets, bins.medium_end_offsets,
+            compare_function
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort_block", bins.medium_segments, start)
+    }
+
+    return for_each_long_segment(
+        bins,
+        [&](const size_t begin_offset, const size_t segment_size) -> hipError_t
+        {
+            // The buffer is large enough for any segment
+            size_t buffer_bytes = keys_bytes + values_bytes;
+            return merge_sort_impl<merge_sort_config_type>(
+                buffer_storage, buffer_bytes,
+                keys_input + begin_offset, keys_output + begin_offset,
+                values_input + begin_offset, values_output + begin_offset,
+                segment_size,
+                compare_function, stream, debug_synchronous
+            );
+        },
+        stream
+    );
+}
+
+#undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+
+} // end namespace detail
+
+/// \brief Parallel segmented merge sort primitive for device level.
+///
+/// \p segmented_merge_sort function performs a device-wide merge sort across multiple,
+/// non-overlapping sequences of keys. Function sorts input keys based on comparison function.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Accepts custom compare_functions for sorting across the device.
+/// * The sort is stable: relative order of equal keys is preserved.
+/// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * Short segments are sorted by logical warps, medium segments by blocks and long segments
+/// by device-wide merge sort, see \p segmented_merge_sort_config.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_merge_sort_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] compare_function - binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level descending segmented merge sort is performed on an array of
+/// \p float values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;      // e.g., 8
+/// float * input;          // e.g., [0.6, 0.3, 0.65, 0.4, 0.2, 0.08, 1, 0.7]
+/// float * output;         // empty array of 8 elements
+/// unsigned int segments;  // e.g., 3
+/// int * offsets;          // e.g. [0, 2, 3, 8]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1,
+///     rocprim::greater<float>()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::segmented_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1,
+///     rocprim::greater<float>()
+/// );
+/// // keys_output: [0.6, 0.3, 0.65, 1, 0.7, 0.4, 0.2, 0.08]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t segmented_merge_sort(void * temporary_storage,
+                                size_t& storage_size,
+                                KeysInputIterator keys_input,
+                                KeysOutputIterator keys_output,
+                                unsigned int size,
+                                unsigned int segments,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                BinaryFunction compare_function = BinaryFunction(),
+                                hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+{
+    empty_type * values = nullptr;
+    return detail::segmented_merge_sort_impl<Config>(
+        temporary_storage, storage_size,
+        keys_input, keys_output, values, values,
+        size, segments, begin_offsets, end_offsets,
+        compare_function, stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel segmented merge sort-by-key primitive for device level.
+///
+/// \p segmented_merge_sort function performs a device-wide merge sort across multiple,
+/// non-overlapping sequences of (key, value) pairs. Function sorts input pairs based on
+/// comparison function.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Accepts custom compare_functions for sorting across the device.
+/// * The sort is stable: relative order of pairs with equal keys is preserved.
+/// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
+/// have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * Short segments are sorted by logical warps, medium segments by blocks and long segments
+/// by device-wide merge sort, see \p segmented_merge_sort_config.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be
+/// \p segmented_merge_sort_config or a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] compare_function - binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level ascending segmented merge sort is performed where input keys
+/// are represented by an array of unsigned integers and input values by an array of <tt>double</tt>s.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// unsigned int * keys_input;  // e.g., [ 6, 3,  5, 4,  1,  8,  1, 7]
+/// double * values_input;      // e.g., [-5, 2, -4, 3, -1, -8, -2, 7]
+/// unsigned int * keys_output; // empty array of 8 elements
+/// double * values_output;     // empty array of 8 elements
+/// unsigned int segments;      // e.g., 3
+/// int * offsets;              // e.g. [0, 2, 3, 8]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output, input_size,
+///     segments, offsets, offsets + 1
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::segmented_merge_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output, input_size,
+///     segments, offsets, offsets + 1
+/// );
+/// // keys_output:   [3,  6,  5,  1,  1, 4, 7,  8]
+/// // values_output: [2, -5, -4, -1, -2, 3, 7, -8]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class BinaryFunction = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>
+>
+inline
+hipError_t segmented_merge_sort(void * temporary_storage,
+                                size_t& storage_size,
+                                KeysInputIterator keys_input,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                ValuesOutputIterator values_output,
+                                unsigned int size,
+                                unsigned int segments,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                BinaryFunction compare_function = BinaryFunction(),
+                                hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+{
+    return detail::segmented_merge_sort_impl<Config>(
+        temporary_storage, storage_size,
+        keys_input, keys_output, values_input, values_output,
+        size, segments, begin_offsets, end_offsets,
+        compare_function, stream, debug_synchronous
+    );
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_HPP_
@@ -0,0 +1,102 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_CONFIG_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "device_merge_sort_config.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Configuration of device-level segmented merge sort.
+///
+/// Segments are partitioned by their lengths before sorting:
+/// * segments with at most \p LogicalWarpSize items are sorted by logical warps
+/// (several segments per block),
+/// * segments with more than \p DeviceSortThreshold items are sorted one by one using
+/// device-wide merge sort with tiles of the same size as in \p SortConfig,
+/// * all other segments are sorted by blocks, one block per segment: tiles of
+/// <tt>SortConfig::block_size * SortConfig::items_per_thread</tt> items are sorted and
+/// then merged by the block using merge path.
+///
+/// \tparam LogicalWarpSize - maximum length of segments sorted by logical warps. Must be
+/// a power of two and must not be greater than the size of hardware warp.
+/// \tparam WarpSortBlockSize - number of threads in a block of the kernel sorting short segments.
+/// \tparam SortConfig - configuration of the kernel sorting segments by blocks. Must be
+/// \p kernel_config.
+/// \tparam DeviceSortThreshold - minimum length of segments sorted by device-wide merge sort
+/// is <tt>DeviceSortThreshold + 1</tt>.
+template<
+    unsigned int LogicalWarpSize,
+    unsigned int WarpSortBlockSize,
+    class SortConfig,
+    unsigned int DeviceSortThreshold
+>
+struct segmented_merge_sort_config
+{
+    /// \brief Maximum length of segments sorted by logical warps.
+    static constexpr unsigned int logical_warp_size = LogicalWarpSize;
+    /// \brief Number of threads in a block of the kernel sorting short segments.
+    static constexpr unsigned int warp_sort_block_size = WarpSortBlockSize;
+    /// \brief Configuration of the kernel sorting segments by blocks.
+    using sort = SortConfig;
+    /// \brief Segments longer than this are sorted by device-wide merge sort.
+    static constexpr unsigned int device_sort_threshold = DeviceSortThreshold;
+};
+
+namespace detail
+{
+
+template<class SortConfig>
+struct segmented_merge_sort_config_base
+{
+    // A block merges up to 16 tiles, longer segments are sorted by device-wide merge sort
+    using type = segmented_merge_sort_config<
+        32, 256,
+        SortConfig,
+        16 * SortConfig::block_size * SortConfig::items_per_thread
+    >;
+};
+
+template<unsigned int TargetArch, class Key, class Value>
+struct default_segmented_merge_sort_config
+    : select_type<
+        segmented_merge_sort_config_base<
+            typename default_merge_sort_config<TargetArch, Key, Value>::block_sort_config
+        >
+    > { };
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_CONFIG_HPP_
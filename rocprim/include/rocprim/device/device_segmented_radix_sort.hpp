@@ -34,7 +34,9 @@
 #include "../functional.hpp"
 #include "../types.hpp"
 
+#include "device_radix_sort.hpp"
 #include "device_segmented_radix_sort_config.hpp"
+#include "detail/device_segment_bins.hpp"
 #include "detail/device_segmented_radix_sort.hpp"
 
 /// \addtogroup devicemodule
@@ -78,6 +80,37 @@ void segmented_sort_kernel(KeysInputIterator keys_input,
     );
 }
 
+template<
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator
+>
+__global__
+void segmented_warp_sort_kernel(KeysInputIterator keys_input,
+                                typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                ValuesOutputIterator values_output,
+                                bool to_output,
+                                unsigned int segments,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                unsigned int begin_bit,
+                                unsigned int end_bit)
+{
+    segmented_warp_sort<Config, Descending>(
+        keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+        to_output,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit
+    );
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
     { \
         auto error = hipPeekAtLastError(); \
@@ -103,40 +136,29 @@ template<
     class OffsetIterator
 >
 inline
-hipError_t segmented_radix_sort_impl(void * temporary_storage,
-                                     size_t& storage_size,
-                                     KeysInputIterator keys_input,
-                                     typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
-                                     KeysOutputIterator keys_output,
-                                     ValuesInputIterator values_input,
-                                     typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
-                                     ValuesOutputIterator values_output,
-                                     unsigned int size,
-                                     bool& is_result_in_output,
-                                     unsigned int segments,
-                                     OffsetIterator begin_offsets,
-                                     OffsetIterator end_offsets,
-                                     unsigned int begin_bit,
-                                     unsigned int end_bit,
-                                     hipStream_t stream,
-                                     bool debug_synchronous)
+auto segmented_radix_sort_segments(void * temporary_storage,
+                                   size_t& storage_size,
+                                   KeysInputIterator keys_input,
+                                   typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                   KeysOutputIterator keys_output,
+                                   ValuesInputIterator values_input,
+                                   typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                   ValuesOutputIterator values_output,
+                                   unsigned int size,
+                                   bool& is_result_in_output,
+                                   unsigned int segments,
+                                   OffsetIterator begin_offsets,
+                                   OffsetIterator end_offsets,
+                                   unsigned int begin_bit,
+                                   unsigned int end_bit,
+                                   hipStream_t stream,
+                                   bool debug_synchronous)
+    -> typename std::enable_if<std::is_void<typename select_config_bins<Config>::type>::value, hipError_t>::type
 {
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
 
-    static_assert(
-        std::is_same<key_type, typename std::iterator_traits<KeysOutputIterator>::value_type>::value,
-        "KeysInputIterator and KeysOutputIterator must have the same value_type"
-    );
-    static_assert(
-        std::is_same<value_type, typename std::iterator_traits<ValuesOutputIterator>::value_type>::value,
-        "ValuesInputIterator and ValuesOutputIterator must have the same value_type"
-    );
-
-    using config = default_or_custom_config<
-        Config,
-        default_segmented_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
-    >;
+    using config = Config;
 
     constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
 
@@ -199,6 +221,291 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     return hipSuccess;
 }
 
+template<
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator
+>
+inline
+auto segmented_radix_sort_segments(void * temporary_storage,
+                                   size_t& storage_size,
+                                   KeysInputIterator keys_input,
+                                   typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                   KeysOutputIterator keys_output,
+                                   ValuesInputIterator values_input,
+                                   typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                   ValuesOutputIterator values_output,
+                                   unsigned int size,
+                                   bool& is_result_in_output,
+                                   unsigned int segments,
+                                   OffsetIterator begin_offsets,
+                                   OffsetIterator end_offsets,
+                                   unsigned int begin_bit,
+                                   unsigned int end_bit,
+                                   hipStream_t stream,
+                                   bool debug_synchronous)
+    -> typename std::enable_if<!std::is_void<typename select_config_bins<Config>::type>::value, hipError_t>::type
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+
+    using config = Config;
+    using bins_config = typename select_config_bins<config>::type;
+    // Long segments are sorted by iterations of device-wide radix sort with the same radix bits,
+    // so their results are stored in the same buffer as results of other segments
+    using radix_sort_config_type = radix_sort_config<
+        config::long_radix_bits,
+        config::short_radix_bits,
+        typename default_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>::scan,
+        typename config::sort
+    >;
+
+    static_assert(
+        bins_config::logical_warp_size <= ::rocprim::warp_size()
+            && ::rocprim::detail::is_power_of_two(bins_config::logical_warp_size),
+        "LogicalWarpSize must be a power of two and must not be greater than warp size"
+    );
+    static_assert(
+        bins_config::block_size % bins_config::logical_warp_size == 0,
+        "BlockSize must be a multiple of LogicalWarpSize"
+    );
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    constexpr unsigned int max_radix_size = 1 << config::long_radix_bits;
+    constexpr unsigned int scan_size =
+        radix_sort_config_type::scan::block_size * radix_sort_config_type::scan::items_per_thread;
+    constexpr unsigned int sort_size = config::sort::block_size * config::sort::items_per_thread;
+    constexpr unsigned int warps_per_block = bins_config::block_size / bins_config::logical_warp_size;
+
+    const bool with_double_buffer = keys_tmp != nullptr;
+
+    const unsigned int bits = end_bit - begin_bit;
+    const unsigned int iterations = ::rocprim::detail::ceiling_div(bits, config::long_radix_bits);
+    const unsigned int radix_bits_diff = config::long_radix_bits - config::short_radix_bits;
+    const unsigned int short_iterations = radix_bits_diff != 0
+        ? ::rocprim::min(iterations, (config::long_radix_bits * iterations - bits) / radix_bits_diff)
+        : 0;
+    const unsigned int long_iterations = iterations - short_iterations;
+
+    segment_bins<offset_type> bins;
+    size_t bins_bytes;
+    hipError_t error = partition_segment_bins(
+        nullptr, bins_bytes,
+        segments, begin_offsets, end_offsets,
+        bins_config::logical_warp_size, bins_config::device_sort_threshold,
+        bins, stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    bins_bytes = ::rocprim::detail::align_size(bins_bytes);
+    const size_t batch_digit_counts_bytes =
+        ::rocprim::detail::align_size(scan_size * max_radix_size * sizeof(unsigned int));
+    const size_t digit_counts_bytes = ::rocprim::detail::align_size(max_radix_size * sizeof(unsigned int));
+    const size_t keys_bytes = ::rocprim::detail::align_size(size * sizeof(key_type));
+    const size_t values_bytes = with_values ? ::rocprim::detail::align_size(size * sizeof(value_type)) : 0;
+    if(temporary_storage == nullptr)
+    {
+        storage_size = bins_bytes + batch_digit_counts_bytes + digit_counts_bytes;
+        if(!with_double_buffer)
+        {
+            storage_size += keys_bytes + values_bytes;
+        }
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "iterations " << iterations << '\n';
+        std::cout << "long_iterations " << long_iterations << '\n';
+        std::cout << "short_iterations " << short_iterations << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess) return error;
+    }
+
+    char * ptr = reinterpret_cast<char *>(temporary_storage);
+    void * bins_storage = ptr;
+    ptr += bins_bytes;
+    unsigned int * batch_digit_counts = reinterpret_cast<unsigned int *>(ptr);
+    ptr += batch_digit_counts_bytes;
+    unsigned int * digit_counts = reinterpret_cast<unsigned int *>(ptr);
+    ptr += digit_counts_bytes;
+    if(!with_double_buffer)
+    {
+        keys_tmp = reinterpret_cast<key_type *>(ptr);
+        ptr += keys_bytes;
+        values_tmp = with_values ? reinterpret_cast<value_type *>(ptr) : nullptr;
+    }
+
+    const bool to_output = with_double_buffer || (iterations - 1) % 2 == 0;
+    is_result_in_output = ((iterations % 2 == 0) != to_output);
+
+    if(segments == 0u)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    error = partition_segment_bins(
+        bins_storage, bins_bytes,
+        segments, begin_offsets, end_offsets,
+        bins_config::logical_warp_size, bins_config::device_sort_threshold,
+        bins, stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    if(bins.short_segments > 0)
+    {
+        const unsigned int warp_sort_blocks = ::rocprim::detail::ceiling_div(bins.short_segments, warps_per_block);
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_warp_sort_kernel<config, Descending>),
+            dim3(warp_sort_blocks), dim3(bins_config::block_size), 0, stream,
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+            is_result_in_output,
+            bins.short_segments, bins.short_begin_offsets, bins.short_end_offsets,
+            begin_bit, end_bit
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_warp_sort", bins.short_segments, start)
+    }
+
+    if(bins.medium_segments > 0)
+    {
+        if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(segmented_sort_kernel<config, Descending>),
+            dim3(bins.medium_segments), dim3(config::sort::block_size), 0, stream,
+            keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
+            to_output,
+            bins.medium_begin_offsets, bins.medium_end_offsets,
+            long_iterations, short_iterations,
+            begin_bit, end_bit
+        );
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort", bins.medium_segments, start)
+    }
+
+    return for_each_long_segment(
+        bins,
+        [&](const size_t begin_offset, const size_t segment_size) -> hipError_t
+        {
+            // Segments are parts of the input, their sizes fit in unsigned int as the size does
+            const unsigned int current_size = static_cast<unsigned int>(segment_size);
+
+            unsigned int blocks_per_full_batch, full_batches, batches;
+            radix_sort_batches(current_size, sort_size, scan_size, blocks_per_full_batch, full_batches, batches);
+
+            // The same sequence of buffers as in segmented_sort
+            bool from_input = true;
+            bool current_to_output = to_output;
+            unsigned int bit = begin_bit;
+            for(unsigned int i = 0; i < long_iterations; i++)
+            {
+                hipError_t error = radix_sort_iteration<radix_sort_config_type, config::long_radix_bits, Descending>(
+                    keys_input + begin_offset, keys_tmp + begin_offset, keys_output + begin_offset,
+                    values_input + begin_offset, values_tmp + begin_offset, values_output + begin_offset,
+                    current_size,
+                    batch_digit_counts, digit_counts,
+                    from_input, current_to_output,
+                    bit, end_bit,
+                    blocks_per_full_batch, full_batches, batches,
+                    stream, debug_synchronous
+                );
+                if(error != hipSuccess) return error;
+
+                from_input = false;
+                current_to_output = !current_to_output;
+                bit += config::long_radix_bits;
+            }
+            for(unsigned int i = 0; i < short_iterations; i++)
+            {
+                hipError_t error = radix_sort_iteration<radix_sort_config_type, config::short_radix_bits, Descending>(
+                    keys_input + begin_offset, keys_tmp + begin_offset, keys_output + begin_offset,
+                    values_input + begin_offset, values_tmp + begin_offset, values_output + begin_offset,
+                    current_size,
+                    batch_digit_counts, digit_counts,
+                    from_input, current_to_output,
+                    bit, end_bit,
+                    blocks_per_full_batch, full_batches, batches,
+                    stream, debug_synchronous
+                );
+                if(error != hipSuccess) return error;
+
+                from_input = false;
+                current_to_output = !current_to_output;
+                bit += config::short_radix_bits;
+            }
+            return hipSuccess;
+        },
+        stream
+    );
+}
+
+template<
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator
+>
+inline
+hipError_t segmented_radix_sort_impl(void * temporary_storage,
+                                     size_t& storage_size,
+                                     KeysInputIterator keys_input,
+                                     typename std::iterator_traits<KeysInputIterator>::value_type * keys_tmp,
+                                     KeysOutputIterator keys_output,
+                                     ValuesInputIterator values_input,
+                                     typename std::iterator_traits<ValuesInputIterator>::value_type * values_tmp,
+                                     ValuesOutputIterator values_output,
+                                     unsigned int size,
+                                     bool& is_result_in_output,
+                                     unsigned int segments,
+                                     OffsetIterator begin_offsets,
+                                     OffsetIterator end_offsets,
+                                     unsigned int begin_bit,
+                                     unsigned int end_bit,
+                                     hipStream_t stream,
+                                     bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    static_assert(
+        std::is_same<key_type, typename std::iterator_traits<KeysOutputIterator>::value_type>::value,
+        "KeysInputIterator and KeysOutputIterator must have the same value_type"
+    );
+    static_assert(
+        std::is_same<value_type, typename std::iterator_traits<ValuesOutputIterator>::value_type>::value,
+        "ValuesInputIterator and ValuesOutputIterator must have the same value_type"
+    );
+
+    using config = default_or_custom_config<
+        Config,
+        default_segmented_radix_sort_config<ROCPRIM_TARGET_ARCH, key_type, value_type>
+    >;
+
+    // Radix keys of tuples and user-defined types may have fewer bits than 8 * sizeof(key_type)
+    const unsigned int key_bits = radix_key_codec<key_type>::bits;
+    end_bit = ::rocprim::min(end_bit, key_bits);
+
+    return segmented_radix_sort_segments<config, Descending>(
+        temporary_storage, storage_size,
+        keys_input, keys_tmp, keys_output,
+        values_input, values_tmp, values_output,
+        size, is_result_in_output,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous
+    );
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // end namespace detail
@@ -213,7 +520,8 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
-/// an arithmetic type (that is, an integral type or a floating-point type).
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
 /// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
 /// * Ranges specified by \p begin_offsets and \p end_offsets must have
 /// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
@@ -334,7 +642,8 @@ hipError_t segmented_radix_sort_keys(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
-/// an arithmetic type (that is, an integral type or a floating-point type).
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
 /// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
 /// * Ranges specified by \p begin_offsets and \p end_offsets must have
 /// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
@@ -455,7 +764,8 @@ hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
-/// an arithmetic type (that is, an integral type or a floating-point type).
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
 /// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
 /// have at least \p size elements.
 /// * Ranges specified by \p begin_offsets and \p end_offsets must have
@@ -595,7 +905,8 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
-/// an arithmetic type (that is, an integral type or a floating-point type).
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
 /// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
 /// have at least \p size elements.
 /// * Ranges specified by \p begin_offsets and \p end_offsets must have
@@ -736,7 +1047,8 @@ hipError_t segmented_radix_sort_pairs_desc(void * temporary_storage,
 /// * The function requires small \p temporary_storage as it does not need
 /// a temporary buffer of \p size elements.
 /// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
+/// type), \p rocprim::tuple of arithmetic types or a type with \p radix_key_decomposer
+/// specialization.
 /// * Buffers of \p keys must have at least \p size elements.
 /// * Ranges specified by \p begin_offsets and \p end_offsets must have
 /// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
@@ -863,7 +1175,8 @@ hipError_t segmented_radix_sort_keys(void * temporary_storage,
 /// * The function requires small \p temporary_storage as it does not need
 /// a temporary buffer of \p size elements.
 /// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
+/// type), \p rocprim::tuple of arithmetic types or a type with \p radix_key_decomposer
+/// specialization.
 /// * Buffers of \p keys must have at least \p size elements.
 /// * Ranges specified by \p begin_offsets and \p end_offsets must have
 /// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
@@ -990,7 +1303,8 @@ hipError_t segmented_radix_sort_keys_desc(void * temporary_storage,
 /// * The function requires small \p temporary_storage as it does not need
 /// a temporary buffer of \p size elements.
 /// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
+/// type), \p rocprim::tuple of arithmetic types or a type with \p radix_key_decomposer
+/// specialization.
 /// * Buffers of \p keys must have at least \p size elements.
 /// * Ranges specified by \p begin_offsets and \p end_offsets must have
 /// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
@@ -1132,7 +1446,8 @@ hipError_t segmented_radix_sort_pairs(void * temporary_storage,
 /// * The function requires small \p temporary_storage as it does not need
 /// a temporary buffer of \p size elements.
 /// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point
-/// type).
+/// type), \p rocprim::tuple of arithmetic types or a type with \p radix_key_decomposer
+/// specialization.
 /// * Buffers of \p keys must have at least \p size elements.
 /// * Ranges specified by \p begin_offsets and \p end_offsets must have
 /// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
@@ -33,6 +33,38 @@
 
 BEGIN_ROCPRIM_NAMESPACE
 
+/// \brief Configuration of size-binned dispatch of device-level segmented radix sort.
+///
+/// Segments are partitioned by their lengths before sorting:
+/// * segments with at most \p LogicalWarpSize items are sorted by logical warps
+/// (several segments per block),
+/// * segments with more than \p DeviceSortThreshold items are sorted one by one using
+/// device-wide radix sort,
+/// * all other segments are sorted by blocks, one block per segment.
+///
+/// Partitioning requires synchronization with the host (numbers of segments in bins must
+/// be known to launch kernels), so it is beneficial when lengths of segments vary greatly.
+///
+/// \tparam LogicalWarpSize - maximum length of segments sorted by logical warps. Must be
+/// a power of two and must not be greater than the size of hardware warp.
+/// \tparam BlockSize - number of threads in a block of the kernel sorting short segments.
+/// \tparam DeviceSortThreshold - minimum length of segments sorted by device-wide radix sort
+/// is <tt>DeviceSortThreshold + 1</tt>.
+template<
+    unsigned int LogicalWarpSize,
+    unsigned int BlockSize,
+    unsigned int DeviceSortThreshold
+>
+struct segmented_radix_sort_bins_config
+{
+    /// \brief Maximum length of segments sorted by logical warps.
+    static constexpr unsigned int logical_warp_size = LogicalWarpSize;
+    /// \brief Number of threads in a block of the kernel sorting short segments.
+    static constexpr unsigned int block_size = BlockSize;
+    /// \brief Segments longer than this are sorted by device-wide radix sort.
+    static constexpr unsigned int device_sort_threshold = DeviceSortThreshold;
+};
+
 /// \brief Configuration of device-level segmented radix sort operation.
 ///
 /// Radix sort is excecuted in a few iterations (passes) depending on total number of bits to be sorted
@@ -45,10 +77,14 @@ BEGIN_ROCPRIM_NAMESPACE
 /// \tparam LongRadixBits - number of bits in long iterations.
 /// \tparam ShortRadixBits - number of bits in short iterations, must be equal to or less than \p LongRadixBits.
 /// \tparam SortConfig - configuration of radix sort kernel. Must be \p kernel_config.
+/// \tparam BinsConfig - [optional] configuration of size-binned dispatch, must be
+/// \p segmented_radix_sort_bins_config or \p void. If it is \p void (default), every segment
+/// is sorted by one block.
 template<
     unsigned int LongRadixBits,
     unsigned int ShortRadixBits,
-    class SortConfig
+    class SortConfig,
+    class BinsConfig = void
 >
 struct segmented_radix_sort_config
 {
@@ -58,11 +94,26 @@ struct segmented_radix_sort_config
     static constexpr unsigned int short_radix_bits = ShortRadixBits;
     /// \brief Configuration of radix sort kernel.
     using sort = SortConfig;
+    /// \brief Configuration of size-binned dispatch.
+    using bins = BinsConfig;
 };
 
 namespace detail
 {
 
+// Custom configs without bins sort every segment by one block
+template<class Config, class = void>
+struct select_config_bins
+{
+    using type = void;
+};
+
+template<class Config>
+struct select_config_bins<Config, void_t<typename Config::bins>>
+{
+    using type = typename Config::bins;
+};
+
 template<class Key, class Value>
 struct segmented_radix_sort_config_803
 {
@@ -96,7 +147,11 @@ struct segmented_radix_sort_config_803<Key, empty_type>
         select_type_case<sizeof(Key) == 1, segmented_radix_sort_config<8, 7, kernel_config<256, 10> > >,
         select_type_case<sizeof(Key) == 2, segmented_radix_sort_config<8, 7, kernel_config<256, 10> > >,
         select_type_case<sizeof(Key) == 4, segmented_radix_sort_config<7, 6, kernel_config<256, 9> > >,
-        select_type_case<sizeof(Key) == 8, segmented_radix_sort_config<7, 6, kernel_config<256, 7> > >
+        select_type_case<sizeof(Key) == 8, segmented_radix_sort_config<7, 6, kernel_config<256, 7> > >,
+        segmented_radix_sort_config<
+            7, 6,
+            kernel_config<256, ::rocprim::max(1u, 15u / ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int)))>
+        >
     > { };
 
 template<class Key, class Value>
@@ -132,7 +187,11 @@ struct segmented_radix_sort_config_900<Key, empty_type>
         select_type_case<sizeof(Key) == 1, segmented_radix_sort_config<4, 3, kernel_config<256, 10> > >,
         select_type_case<sizeof(Key) == 2, segmented_radix_sort_config<6, 5, kernel_config<256, 10> > >,
         select_type_case<sizeof(Key) == 4, segmented_radix_sort_config<7, 6, kernel_config<256, 17> > >,
-        select_type_case<sizeof(Key) == 8, segmented_radix_sort_config<7, 6, kernel_config<256, 15> > >
+        select_type_case<sizeof(Key) == 8, segmented_radix_sort_config<7, 6, kernel_config<256, 15> > >,
+        segmented_radix_sort_config<
+            7, 6,
+            kernel_config<256, ::rocprim::max(1u, 15u / ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int)))>
+        >
     > { };
 
 template<unsigned int TargetArch, class Key, class Value>
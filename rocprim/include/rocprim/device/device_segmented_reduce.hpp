@@ -23,13 +23,21 @@
 
 #include <type_traits>
 #include <iterator>
+#include <algorithm>
 
 #include "../config.hpp"
 #include "../functional.hpp"
 #include "../detail/various.hpp"
 #include "../detail/match_result_type.hpp"
 
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+
+#include "device_reduce.hpp"
+#include "device_scan.hpp"
+#include "detail/device_info.hpp"
 #include "detail/device_segmented_reduce.hpp"
+#include "detail/device_deterministic_sum.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -62,6 +70,116 @@ void segmented_reduce_kernel(InputIterator input,
     );
 }
 
+// Sums of levels of deterministic_segmented_reduce, items of every segment are split and sums are
+// converted to results using the scale of the segment
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator
+>
+__global__
+void deterministic_segmented_sum_kernel(InputIterator input,
+                                        OutputIterator output,
+                                        OffsetIterator begin_offsets,
+                                        OffsetIterator end_offsets,
+                                        const deterministic_sum_stats * segment_stats,
+                                        double initial_value)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    const unsigned int segment_id = ::rocprim::detail::block_id<0>();
+    const deterministic_sum_scale scale = make_deterministic_sum_scale(segment_stats[segment_id]);
+
+    segmented_reduce<Config>(
+        ::rocprim::make_transform_iterator(input, deterministic_sum_split_op<input_type> { &scale }),
+        deterministic_sum_output_iterator<OutputIterator, input_type>(output, &scale, initial_value),
+        begin_offsets, end_offsets,
+        deterministic_sum_op(), deterministic_sum_type()
+    );
+}
+
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+__global__
+void segmented_reduce_short_kernel(InputIterator input,
+                                   OutputIterator output,
+                                   unsigned int segments,
+                                   OffsetIterator begin_offsets,
+                                   OffsetIterator end_offsets,
+                                   BinaryFunction reduce_op,
+                                   ResultType initial_value)
+{
+    segmented_reduce_short<Config>(
+        input, output,
+        segments, begin_offsets, end_offsets,
+        reduce_op, initial_value
+    );
+}
+
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+__global__
+void segmented_reduce_long_kernel(InputIterator input,
+                                  OutputIterator output,
+                                  unsigned int segments,
+                                  OffsetIterator begin_offsets,
+                                  OffsetIterator end_offsets,
+                                  const unsigned int * chunk_offsets,
+                                  ResultType * head_values,
+                                  unsigned int * head_complete,
+                                  ResultType * tail_values,
+                                  unsigned int * tail_segments,
+                                  BinaryFunction reduce_op,
+                                  ResultType initial_value)
+{
+    segmented_reduce_long<Config>(
+        input, output,
+        segments, begin_offsets, end_offsets,
+        chunk_offsets,
+        head_values, head_complete, tail_values, tail_segments,
+        reduce_op, initial_value
+    );
+}
+
+template<
+    unsigned int BlockSize,
+    class OutputIterator,
+    class ResultType,
+    class BinaryFunction
+>
+__global__
+void segmented_reduce_fixup_kernel(OutputIterator output,
+                                   unsigned int segments,
+                                   const unsigned int * chunk_offsets,
+                                   const ResultType * head_values,
+                                   const unsigned int * head_complete,
+                                   const ResultType * tail_values,
+                                   const unsigned int * tail_segments,
+                                   unsigned int number_of_blocks,
+                                   BinaryFunction reduce_op,
+                                   ResultType initial_value)
+{
+    segmented_reduce_fixup<BlockSize>(
+        output, segments, chunk_offsets,
+        head_values, head_complete, tail_values, tail_segments,
+        number_of_blocks,
+        reduce_op, initial_value
+    );
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, size, start) \
     { \
         auto error = hipPeekAtLastError(); \
@@ -77,6 +195,139 @@ void segmented_reduce_kernel(InputIterator input,
         } \
     }
 
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+inline
+hipError_t balanced_segmented_reduce_impl(void * temporary_storage,
+                                          size_t& storage_size,
+                                          InputIterator input,
+                                          OutputIterator output,
+                                          unsigned int segments,
+                                          OffsetIterator begin_offsets,
+                                          OffsetIterator end_offsets,
+                                          BinaryFunction reduce_op,
+                                          ResultType initial_value,
+                                          hipStream_t stream,
+                                          bool debug_synchronous)
+{
+    using params = segmented_reduce_balanced_params<Config>;
+    using scan_config = default_scan_config<ROCPRIM_TARGET_ARCH, unsigned int>;
+
+    constexpr unsigned int block_size = params::block_size;
+    constexpr unsigned int warps_per_block = params::warps_per_block;
+
+    device_info info;
+    hipError_t error = get_device_info(info);
+    if(error != hipSuccess) return error;
+    const unsigned int compute_units = info.compute_units;
+
+    // Long segments are reduced by a fixed number of blocks
+    const unsigned int long_blocks =
+        compute_units * select_config_balanced_blocks_per_cu<Config>::value;
+
+    const size_t chunk_offsets_bytes =
+        ::rocprim::detail::align_size((segments + 1) * sizeof(unsigned int));
+    const size_t values_bytes = ::rocprim::detail::align_size(long_blocks * sizeof(ResultType));
+    const size_t flags_bytes = ::rocprim::detail::align_size(long_blocks * sizeof(unsigned int));
+
+    unsigned int * chunk_offsets = nullptr;
+    ResultType * head_values = nullptr;
+    ResultType * tail_values = nullptr;
+    unsigned int * head_complete = nullptr;
+    unsigned int * tail_segments = nullptr;
+    void * scan_temp_storage = nullptr;
+    size_t scan_storage_size = 0;
+    if(temporary_storage != nullptr)
+    {
+        char * ptr = reinterpret_cast<char *>(temporary_storage);
+        chunk_offsets = reinterpret_cast<unsigned int *>(ptr);
+        ptr += chunk_offsets_bytes;
+        head_values = reinterpret_cast<ResultType *>(ptr);
+        ptr += values_bytes;
+        tail_values = reinterpret_cast<ResultType *>(ptr);
+        ptr += values_bytes;
+        head_complete = reinterpret_cast<unsigned int *>(ptr);
+        ptr += flags_bytes;
+        tail_segments = reinterpret_cast<unsigned int *>(ptr);
+        ptr += flags_bytes;
+        scan_temp_storage = ptr;
+        scan_storage_size = storage_size - chunk_offsets_bytes - 2 * values_bytes - 2 * flags_bytes;
+    }
+
+    // Numbers of chunks of long segments (0 for short ones) and one extra item, so the last
+    // offset is the total number of chunks
+    auto chunks_input = ::rocprim::make_transform_iterator(
+        ::rocprim::make_counting_iterator<unsigned int>(0),
+        segmented_reduce_chunks_op<OffsetIterator> {
+            begin_offsets, end_offsets, segments, params::warp_items, params::items_per_block
+        }
+    );
+    error = scan_impl<true, scan_config>(
+        scan_temp_storage, scan_storage_size,
+        chunks_input, chunk_offsets, 0U, segments + 1,
+        ::rocprim::plus<unsigned int>(), stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    if(temporary_storage == nullptr)
+    {
+        storage_size = chunk_offsets_bytes + 2 * values_bytes + 2 * flags_bytes + scan_storage_size;
+        return hipSuccess;
+    }
+
+    if(segments == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(segmented_reduce_short_kernel<Config>),
+        dim3(::rocprim::detail::ceiling_div(segments, warps_per_block)), dim3(block_size), 0, stream,
+        input, output,
+        segments, begin_offsets, end_offsets,
+        reduce_op, initial_value
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_short", segments, start);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(segmented_reduce_long_kernel<Config>),
+        dim3(long_blocks), dim3(block_size), 0, stream,
+        input, output,
+        segments, begin_offsets, end_offsets,
+        const_cast<const unsigned int *>(chunk_offsets),
+        head_values, head_complete, tail_values, tail_segments,
+        reduce_op, initial_value
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_long", long_blocks, start);
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(segmented_reduce_fixup_kernel<block_size>),
+        dim3(::rocprim::detail::ceiling_div(long_blocks, block_size)), dim3(block_size), 0, stream,
+        output, segments,
+        const_cast<const unsigned int *>(chunk_offsets),
+        const_cast<const ResultType *>(head_values),
+        const_cast<const unsigned int *>(head_complete),
+        const_cast<const ResultType *>(tail_values),
+        const_cast<const unsigned int *>(tail_segments),
+        long_blocks,
+        reduce_op, initial_value
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_fixup", long_blocks, start);
+
+    return hipSuccess;
+}
+
 template<
     class Config,
     class InputIterator,
@@ -111,6 +362,17 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
 
     constexpr unsigned int block_size = config::block_size;
 
+    if(select_config_balanced_blocks_per_cu<config>::value > 0)
+    {
+        return balanced_segmented_reduce_impl<config>(
+            temporary_storage, storage_size,
+            input, output,
+            segments, begin_offsets, end_offsets,
+            reduce_op, static_cast<result_type>(initial_value),
+            stream, debug_synchronous
+        );
+    }
+
     if(temporary_storage == nullptr)
     {
         // Make sure user won't try to allocate 0 bytes memory, because
@@ -134,6 +396,90 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
     return hipSuccess;
 }
 
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class InitValueType
+>
+inline
+hipError_t deterministic_segmented_reduce_impl(void * temporary_storage,
+                                               size_t& storage_size,
+                                               InputIterator input,
+                                               OutputIterator output,
+                                               unsigned int segments,
+                                               OffsetIterator begin_offsets,
+                                               OffsetIterator end_offsets,
+                                               InitValueType initial_value,
+                                               hipStream_t stream,
+                                               bool debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // Get default config if Config is default_config
+    using config = default_or_custom_config<
+        Config,
+        default_reduce_config<ROCPRIM_TARGET_ARCH, deterministic_sum_type>
+    >;
+
+    constexpr unsigned int block_size = config::block_size;
+
+    const size_t segment_stats_bytes =
+        ::rocprim::detail::align_size(segments * sizeof(deterministic_sum_stats));
+
+    deterministic_sum_stats * segment_stats = nullptr;
+    void * nested_temp_storage = nullptr;
+    size_t nested_temp_storage_size = 0;
+    if(temporary_storage != nullptr)
+    {
+        char * ptr = reinterpret_cast<char *>(temporary_storage);
+        segment_stats = reinterpret_cast<deterministic_sum_stats *>(ptr);
+        ptr += segment_stats_bytes;
+        nested_temp_storage = ptr;
+        nested_temp_storage_size = storage_size - segment_stats_bytes;
+    }
+
+    auto stats_input = ::rocprim::make_transform_iterator(
+        input, deterministic_sum_stats_transform_op<input_type>()
+    );
+
+    // The first pass: stats of every segment, they define the scale of the segment
+    // (the maximum absolute value and the length of the segment), so segments of very
+    // different magnitudes are summed with the same relative accuracy
+    hipError_t error = segmented_reduce_impl<default_config>(
+        nested_temp_storage, nested_temp_storage_size,
+        stats_input, segment_stats,
+        segments, begin_offsets, end_offsets,
+        deterministic_sum_stats_op(), deterministic_sum_stats(),
+        stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    if(temporary_storage == nullptr)
+    {
+        storage_size = segment_stats_bytes + nested_temp_storage_size;
+        return hipSuccess;
+    }
+
+    // The second pass: sums of levels, one block per segment (the scale of the segment
+    // is required for splitting items)
+    std::chrono::high_resolution_clock::time_point start;
+
+    if(debug_synchronous) start = std::chrono::high_resolution_clock::now();
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(deterministic_segmented_sum_kernel<config>),
+        dim3(segments), dim3(block_size), 0, stream,
+        input, output,
+        begin_offsets, end_offsets,
+        const_cast<const deterministic_sum_stats *>(segment_stats),
+        static_cast<double>(initial_value)
+    );
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("deterministic_segmented_sum", segments, start);
+
+    return hipSuccess;
+}
+
 #undef ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
 
 } // end of detail namespace
@@ -146,6 +492,13 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
 /// \par Overview
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
+/// * By default (and with \p reduce_config) every segment is reduced by one block in a single
+/// launch, which is slow when a few segments are much longer than others. With
+/// \p balanced_segmented_reduce_config work is balanced between blocks regardless of lengths
+/// of segments: short segments (up to the warp size multiplied by \p items_per_thread items)
+/// are reduced by warps, several segments per block, longer segments are split into tiles which
+/// are evenly distributed among a fixed number of blocks (\p balanced_blocks_per_cu per
+/// compute unit).
 /// * Ranges specified by \p input must have at least \p size elements, \p output must have
 /// \p segments elements.
 /// * Ranges specified by \p begin_offsets and \p end_offsets must have
@@ -153,8 +506,8 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
 /// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
 /// <tt>offsets + 1</tt> for \p end_offsets.
 ///
-/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config or
-/// a custom class with the same members.
+/// \tparam Config - [optional] configuration of the primitive. It can be \p reduce_config,
+/// \p balanced_segmented_reduce_config or a custom class with the same members.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
@@ -262,6 +615,119 @@ hipError_t segmented_reduce(void * temporary_storage,
     );
 }
 
+/// \brief Deterministic parallel segmented sum primitive for device level.
+///
+/// deterministic_segmented_reduce function calculates sums of floating-point values
+/// in every segment. Unlike \p segmented_reduce with \p rocprim::plus, results do not depend
+/// on the configuration (\p Config), block sizes and the target architecture, so they are
+/// bitwise reproducible between runs, devices and builds.
+///
+/// \par Overview
+/// * Sums are calculated in the same way as \p deterministic_reduce does: using a fixed-point
+/// representation with 3 levels. Every segment has its own scale defined by the maximum
+/// absolute value of its items and by its length, so the accuracy of a segment does not depend
+/// on magnitudes of other segments.
+/// * Input values are read twice: the first pass finds the maximum absolute value (and NaNs and
+/// infinities) of every segment, the second pass calculates sums of levels.
+/// * If a segment contains NaNs or infinities, its sum is NaN or infinity (see
+/// \p deterministic_reduce).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer. The size is proportional to \p segments.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+///
+/// \tparam Config - [optional] configuration of the second pass. It can be \p reduce_config or
+/// a custom class with the same members. It affects performance only.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type. Its
+/// \p value_type must be \p float or \p double, it is also the type of the results.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value, it must be convertible to \p double.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] initial_value - initial value, it is added to the sum of every segment.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// float * input;         // e.g., [1e8, 1, -1e8, 1, 0.5, 0.25]
+/// float * output;        // empty array of at least 2 elements
+/// int * offsets;         // e.g. [0, 4, 6]
+/// unsigned int segments; // e.g., 2
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::deterministic_segmented_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output,
+///     segments, offsets, offsets + 1,
+///     0.0f
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform segmented reduction
+/// rocprim::deterministic_segmented_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output,
+///     segments, offsets, offsets + 1,
+///     0.0f
+/// );
+/// // output: [2, 0.75]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class InitValueType = typename std::iterator_traits<InputIterator>::value_type
+>
+inline
+hipError_t deterministic_segmented_reduce(void * temporary_storage,
+                                          size_t& storage_size,
+                                          InputIterator input,
+                                          OutputIterator output,
+                                          unsigned int segments,
+                                          OffsetIterator begin_offsets,
+                                          OffsetIterator end_offsets,
+                                          InitValueType initial_value = InitValueType(),
+                                          hipStream_t stream = 0,
+                                          bool debug_synchronous = false)
+{
+    return detail::deterministic_segmented_reduce_impl<Config>(
+        temporary_storage, storage_size,
+        input, output,
+        segments, begin_offsets, end_offsets,
+        initial_value,
+        stream, debug_synchronous
+    );
+}
+
 /// @}
 // end of group devicemodule
 
@@ -71,6 +71,9 @@ namespace detail
 /// * Range specified by \p output must have at least so many elements, that all positively
 /// flagged values can be copied into it.
 /// * Range specified by \p selected_count_output must have at least 1 element.
+/// * The type of offsets and counts is \p offset_type of \p Config. The default (\p unsigned \p int)
+/// supports up to 2^32 - 1 elements, \p select_config with 64-bit \p OffsetType is required for
+/// larger inputs. If \p size is too large for \p offset_type, \p hipErrorInvalidValue is returned.
 /// * Values of \p flag range should be implicitly convertible to `bool` type.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
@@ -178,6 +181,9 @@ hipError_t select(void * temporary_storage,
 /// * Range specified by \p output must have at least so many elements, that all selected
 /// values can be copied into it.
 /// * Range specified by \p selected_count_output must have at least 1 element.
+/// * The type of offsets and counts is \p offset_type of \p Config. The default (\p unsigned \p int)
+/// supports up to 2^32 - 1 elements, \p select_config with 64-bit \p OffsetType is required for
+/// larger inputs. If \p size is too large for \p offset_type, \p hipErrorInvalidValue is returned.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It can be \p select_config or
 /// a custom class with the same members.
@@ -289,6 +295,9 @@ hipError_t select(void * temporary_storage,
 /// * Range specified by \p output must have at least so many elements, that all selected
 /// values can be copied into it.
 /// * Range specified by \p unique_count_output must have at least 1 element.
+/// * The type of offsets and counts is \p offset_type of \p Config. The default (\p unsigned \p int)
+/// supports up to 2^32 - 1 elements, \p select_config with 64-bit \p OffsetType is required for
+/// larger inputs. If \p size is too large for \p offset_type, \p hipErrorInvalidValue is returned.
 /// * By default <tt>InputIterator::value_type</tt>'s equality operator is used to check
 /// if elements are equivalent.
 ///
@@ -43,12 +43,20 @@ BEGIN_ROCPRIM_NAMESPACE
 /// \tparam ValueBlockLoadMethod - method for loading input values.
 /// \tparam FlagBlockLoadMethod - method for loading flag values.
 /// \tparam BlockScanMethod - algorithm for block scan.
+/// \tparam OffsetType - [optional] unsigned integer type of offsets and counts of selected
+/// values. \p unsigned \p int limits the input size to 2^32 - 1 elements, 64-bit types
+/// (\p size_t or \p unsigned \p long \p long) allow larger inputs at the cost of more registers.
+/// All 32-bit and 64-bit unsigned types are supported by select, partition, partition_three_way
+/// and partition_multi.
+/// \tparam Backoff - [optional] strategy of waiting for prefixes of previous blocks in lookback scan.
 template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     ::rocprim::block_load_method ValueBlockLoadMethod,
     ::rocprim::block_load_method FlagBlockLoadMethod,
-    ::rocprim::block_scan_algorithm BlockScanMethod
+    ::rocprim::block_scan_algorithm BlockScanMethod,
+    class OffsetType = unsigned int,
+    ::rocprim::lookback_backoff Backoff = ::rocprim::lookback_backoff::automatic
 >
 struct select_config
 {
@@ -62,11 +70,28 @@ struct select_config
     static constexpr block_load_method flag_block_load_method = FlagBlockLoadMethod;
     /// \brief Algorithm for block scan.
     static constexpr block_scan_algorithm block_scan_method = BlockScanMethod;
+    /// \brief Type of offsets and counts of selected values.
+    using offset_type = OffsetType;
+    /// \brief Strategy of waiting for prefixes of previous blocks in lookback scan.
+    static constexpr ::rocprim::lookback_backoff backoff = Backoff;
 };
 
 namespace detail
 {
 
+// Custom configs without offset_type use 32-bit offsets
+template<class Config, class = void>
+struct select_config_offset_type
+{
+    using type = unsigned int;
+};
+
+template<class Config>
+struct select_config_offset_type<Config, void_t<typename Config::offset_type>>
+{
+    using type = typename Config::offset_type;
+};
+
 template<class Value>
 struct select_config_803
 {
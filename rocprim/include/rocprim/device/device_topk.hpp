@@ -0,0 +1,672 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_TOPK_HPP_
+#define ROCPRIM_DEVICE_DEVICE_TOPK_HPP_
+
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../detail/radix_sort.hpp"
+
+#include "../intrinsics.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+#include "../iterator/constant_iterator.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
+
+#include "device_nth_element.hpp"
+#include "device_partition.hpp"
+#include "device_radix_sort.hpp"
+#include "device_topk_config.hpp"
+#include "detail/device_topk.hpp"
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<
+    class Config,
+    bool Descending,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator
+>
+inline
+hipError_t topk_impl(void * temporary_storage,
+                     size_t& storage_size,
+                     KeysInputIterator keys_input,
+                     KeysOutputIterator keys_output,
+                     ValuesInputIterator values_input,
+                     ValuesOutputIterator values_output,
+                     size_t size,
+                     size_t k,
+                     hipStream_t stream,
+                     bool debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    using config = default_or_custom_config<
+        Config,
+        default_topk_config<ROCPRIM_TARGET_ARCH, key_type>
+    >;
+    using key_codec = radix_key_codec<key_type, Descending>;
+    using bit_key_type = typename key_codec::bit_key_type;
+    using state_type = radix_select_state<bit_key_type>;
+    using flag_op_type = topk_flag_op<key_type, Descending>;
+
+    constexpr unsigned int radix_bits = config::radix_bits;
+    constexpr unsigned int radix_size = 1 << radix_bits;
+
+    k = std::min(k, size);
+
+    const auto keys_indices = ::rocprim::make_zip_iterator(
+        ::rocprim::make_tuple(keys_input, ::rocprim::make_counting_iterator<size_t>(0))
+    );
+    const auto flags = ::rocprim::make_transform_iterator(keys_indices, flag_op_type { nullptr });
+
+    key_type * keys_selected = nullptr;
+    value_type * values_selected = nullptr;
+    auto select_input = make_topk_select_iterator<with_values>(keys_input, values_input);
+    auto select_output = make_topk_select_iterator<with_values>(keys_selected, values_selected);
+
+    // Temporary storage of select and radix sort is not used at the same time
+    size_t select_bytes;
+    hipError_t error = partition_impl<select_method::flag, true, typename config::select>(
+        nullptr, select_bytes,
+        select_input, flags, select_output, static_cast<unsigned int *>(nullptr), size,
+        ::rocprim::empty_type(), ::rocprim::empty_type(),
+        stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+    size_t sort_bytes;
+    bool is_result_in_output;
+    error = radix_sort_impl<typename config::sort, Descending>(
+        nullptr, sort_bytes,
+        keys_selected, nullptr, keys_output,
+        values_selected, nullptr, values_output,
+        k, is_result_in_output,
+        0, radix_key_codec<key_type>::bits,
+        stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    const size_t state_bytes = ::rocprim::detail::align_size(sizeof(state_type));
+    const size_t digit_counts_bytes = ::rocprim::detail::align_size(radix_size * sizeof(unsigned long long));
+    const size_t selected_count_bytes = ::rocprim::detail::align_size(sizeof(unsigned int));
+    const size_t keys_bytes = ::rocprim::detail::align_size(k * sizeof(key_type));
+    const size_t values_bytes = with_values ? ::rocprim::detail::align_size(k * sizeof(value_type)) : 0;
+    const size_t storage_bytes = ::rocprim::detail::align_size(std::max(select_bytes, sort_bytes));
+    if(temporary_storage == nullptr)
+    {
+        storage_size = state_bytes + digit_counts_bytes + selected_count_bytes
+            + keys_bytes + values_bytes + storage_bytes;
+        // Make sure user won't try to allocate 0 bytes memory
+        storage_size = storage_size == 0 ? 4 : storage_size;
+        return hipSuccess;
+    }
+
+    if(k == 0)
+    {
+        return hipSuccess;
+    }
+
+    char * ptr = reinterpret_cast<char *>(temporary_storage);
+    state_type * state = reinterpret_cast<state_type *>(ptr);
+    ptr += state_bytes;
+    unsigned long long * digit_counts = reinterpret_cast<unsigned long long *>(ptr);
+    ptr += digit_counts_bytes;
+    unsigned int * selected_count = reinterpret_cast<unsigned int *>(ptr);
+    ptr += selected_count_bytes;
+    keys_selected = reinterpret_cast<key_type *>(ptr);
+    ptr += keys_bytes;
+    values_selected = with_values ? reinterpret_cast<value_type *>(ptr) : nullptr;
+    ptr += values_bytes;
+    void * storage = ptr;
+
+    const unsigned int key_bits = radix_key_codec<key_type>::bits;
+    unsigned int index_bits = 0;
+    while(index_bits < 8 * sizeof(size_t) && ((size - 1) >> index_bits) != 0)
+    {
+        index_bits++;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "k " << k << '\n';
+    }
+
+    // Find the k-th key
+    error = radix_select_keys<config, 1, Descending>(
+        keys_input, size, ::rocprim::make_constant_iterator<size_t>(k - 1),
+        state, 1, digit_counts,
+        stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    // If there are more keys equal to the k-th key than needed, the first of them
+    // (in the order of indices) are selected, so the result is the same as the beginning of
+    // the stably sorted sequence
+    state_type host_state;
+    error = hipMemcpyAsync(&host_state, state, sizeof(state_type), hipMemcpyDeviceToHost, stream);
+    if(error != hipSuccess) return error;
+    error = hipStreamSynchronize(stream);
+    if(error != hipSuccess) return error;
+    if(host_state.count != host_state.rank + 1)
+    {
+        for(unsigned int end_bit = index_bits; end_bit > 0;)
+        {
+            const unsigned int current_radix_bits = std::min(radix_bits, end_bit);
+            const unsigned int bit = end_bit - current_radix_bits;
+            error = radix_select_pass<config, 1, Descending, true>(
+                keys_input, size, state, 1, digit_counts,
+                bit, current_radix_bits, false,
+                stream, debug_synchronous
+            );
+            if(error != hipSuccess) return error;
+            end_bit = bit;
+        }
+    }
+
+    // Exactly k items precede the k-th item (including itself)
+    error = partition_impl<select_method::flag, true, typename config::select>(
+        storage, select_bytes,
+        select_input,
+        ::rocprim::make_transform_iterator(keys_indices, flag_op_type { state }),
+        make_topk_select_iterator<with_values>(keys_selected, values_selected),
+        selected_count, size,
+        ::rocprim::empty_type(), ::rocprim::empty_type(),
+        stream, debug_synchronous
+    );
+    if(error != hipSuccess) return error;
+
+    return radix_sort_impl<typename config::sort, Descending>(
+        storage, sort_bytes,
+        keys_selected, nullptr, keys_output,
+        values_selected, nullptr, values_output,
+        k, is_result_in_output,
+        0, key_bits,
+        stream, debug_synchronous
+    );
+}
+
+} // end namespace detail
+
+/// \brief Parallel ascending top-k selection primitive for device level.
+///
+/// \p topk_keys function selects \p k smallest keys
+/// of the input range and writes them to the output in ascending order of keys.
+/// The result is the same as the first \p k items produced by \p radix_sort_keys,
+/// but the whole input is not sorted: the k-th key is found by radix select (several
+/// passes counting digits of keys), items preceding it are compacted and only these
+/// \p k keys are sorted.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
+/// * Ranges specified by \p keys_input must have at least \p size elements,
+/// ranges specified by \p keys_output must have at least <tt>min(k, size)</tt> elements.
+/// * If there are more keys equal to the k-th key than needed, the first of them
+/// (in the order of the input range) are selected. Relative order of equal keys is preserved.
+/// * The function synchronizes the stream once, to check whether keys equal to the k-th key
+/// must be selected by their positions.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p topk_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range of keys.
+/// \param [out] keys_output - pointer to the first element in the output range of keys.
+/// \param [in] size - number of element in the input range.
+/// \param [in] k - number of keys to select. If it is greater than \p size, all keys
+/// are selected.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example 3 smallest of \p float values are selected.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;      // e.g., 8
+/// size_t k;               // e.g., 3
+/// float * input;          // e.g., [0.6, 0.3, 0.65, 0.4, 0.2, 0.08, 1, 0.7]
+/// float * output;         // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::topk_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, k
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::topk_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, k
+/// );
+/// // output: [0.08, 0.2, 0.3]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator
+>
+inline
+hipError_t topk_keys(void * temporary_storage,
+                     size_t& storage_size,
+                     KeysInputIterator keys_input,
+                     KeysOutputIterator keys_output,
+                     size_t size,
+                     size_t k,
+                     hipStream_t stream = 0,
+                     bool debug_synchronous = false)
+{
+    empty_type * values = nullptr;
+    return detail::topk_impl<Config, false>(
+        temporary_storage, storage_size,
+        keys_input, keys_output,
+        values, values,
+        size, k,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel descending top-k selection primitive for device level.
+///
+/// \p topk_keys_desc function selects \p k largest keys
+/// of the input range and writes them to the output in descending order of keys.
+/// The result is the same as the first \p k items produced by \p radix_sort_keys_desc,
+/// but the whole input is not sorted: the k-th key is found by radix select (several
+/// passes counting digits of keys), items preceding it are compacted and only these
+/// \p k keys are sorted.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
+/// * Ranges specified by \p keys_input must have at least \p size elements,
+/// ranges specified by \p keys_output must have at least <tt>min(k, size)</tt> elements.
+/// * If there are more keys equal to the k-th key than needed, the first of them
+/// (in the order of the input range) are selected. Relative order of equal keys is preserved.
+/// * The function synchronizes the stream once, to check whether keys equal to the k-th key
+/// must be selected by their positions.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p topk_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range of keys.
+/// \param [out] keys_output - pointer to the first element in the output range of keys.
+/// \param [in] size - number of element in the input range.
+/// \param [in] k - number of keys to select. If it is greater than \p size, all keys
+/// are selected.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example 3 largest of integer values are selected.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 8
+/// size_t k;             // e.g., 3
+/// int * input;          // e.g., [6, 3, 5, 4, 2, 8, 1, 7]
+/// int * output;         // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::topk_keys_desc(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, k
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::topk_keys_desc(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, k
+/// );
+/// // output: [8, 7, 6]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator
+>
+inline
+hipError_t topk_keys_desc(void * temporary_storage,
+                          size_t& storage_size,
+                          KeysInputIterator keys_input,
+                          KeysOutputIterator keys_output,
+                          size_t size,
+                          size_t k,
+                          hipStream_t stream = 0,
+                          bool debug_synchronous = false)
+{
+    empty_type * values = nullptr;
+    return detail::topk_impl<Config, true>(
+        temporary_storage, storage_size,
+        keys_input, keys_output,
+        values, values,
+        size, k,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel ascending top-k selection primitive for device level.
+///
+/// \p topk_pairs function selects \p k smallest keys (with their values)
+/// of the input range and writes them to the output in ascending order of keys.
+/// The result is the same as the first \p k items produced by \p radix_sort_pairs,
+/// but the whole input is not sorted: the k-th key is found by radix select (several
+/// passes counting digits of keys), items preceding it are compacted and only these
+/// \p k pairs are sorted.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
+/// * Ranges specified by \p keys_input and \p values_input must have at least \p size elements,
+/// ranges specified by \p keys_output and \p values_output must have at least <tt>min(k, size)</tt> elements.
+/// * If there are more keys equal to the k-th key than needed, the first of them
+/// (in the order of the input range) are selected. Relative order of equal keys is preserved.
+/// * The function synchronizes the stream once, to check whether keys equal to the k-th key
+/// must be selected by their positions.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p topk_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range of keys.
+/// \param [out] keys_output - pointer to the first element in the output range of keys.
+/// \param [in] values_input - pointer to the first element in the range of values.
+/// \param [out] values_output - pointer to the first element in the output range of values.
+/// \param [in] size - number of element in the input range.
+/// \param [in] k - number of keys to select. If it is greater than \p size, all keys
+/// are selected.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example pairs with 4 smallest keys are selected, keys are represented
+/// by an array of integers and values by an array of <tt>double</tt>s.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;       // e.g., 8
+/// size_t k;                // e.g., 4
+/// int * keys_input;        // e.g., [ 6, 3,  5, 4,  1,  8,  1, 7]
+/// double * values_input;   // e.g., [-5, 2, -4, 3, -1, -8, -2, 7]
+/// int * keys_output;       // empty array of 4 elements
+/// double * values_output;  // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::topk_pairs(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output,
+///     input_size, k
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::topk_pairs(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output,
+///     input_size, k
+/// );
+/// // keys_output:   [ 1,  1, 3, 4]
+/// // values_output: [-1, -2, 2, 3]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator
+>
+inline
+hipError_t topk_pairs(void * temporary_storage,
+                      size_t& storage_size,
+                      KeysInputIterator keys_input,
+                      KeysOutputIterator keys_output,
+                      ValuesInputIterator values_input,
+                      ValuesOutputIterator values_output,
+                      size_t size,
+                      size_t k,
+                      hipStream_t stream = 0,
+                      bool debug_synchronous = false)
+{
+    return detail::topk_impl<Config, false>(
+        temporary_storage, storage_size,
+        keys_input, keys_output,
+        values_input, values_output,
+        size, k,
+        stream, debug_synchronous
+    );
+}
+
+/// \brief Parallel descending top-k selection primitive for device level.
+///
+/// \p topk_pairs_desc function selects \p k largest keys (with their values)
+/// of the input range and writes them to the output in descending order of keys.
+/// The result is the same as the first \p k items produced by \p radix_sort_pairs_desc,
+/// but the whole input is not sorted: the k-th key is found by radix select (several
+/// passes counting digits of keys), items preceding it are compacted and only these
+/// \p k pairs are sorted.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type), \p rocprim::tuple
+/// of arithmetic types or a type with \p radix_key_decomposer specialization.
+/// * Ranges specified by \p keys_input and \p values_input must have at least \p size elements,
+/// ranges specified by \p keys_output and \p values_output must have at least <tt>min(k, size)</tt> elements.
+/// * If there are more keys equal to the k-th key than needed, the first of them
+/// (in the order of the input range) are selected. Relative order of equal keys is preserved.
+/// * The function synchronizes the stream once, to check whether keys equal to the k-th key
+/// must be selected by their positions.
+///
+/// \tparam Config - [optional] configuration of the primitive. It can be \p topk_config or
+/// a custom class with the same members.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range of keys.
+/// \param [out] keys_output - pointer to the first element in the output range of keys.
+/// \param [in] values_input - pointer to the first element in the range of values.
+/// \param [out] values_output - pointer to the first element in the output range of values.
+/// \param [in] size - number of element in the input range.
+/// \param [in] k - number of keys to select. If it is greater than \p size, all keys
+/// are selected.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example pairs with 4 largest keys are selected, keys are represented
+/// by an array of integers and values by an array of <tt>double</tt>s.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;       // e.g., 8
+/// size_t k;                // e.g., 4
+/// int * keys_input;        // e.g., [ 6, 3,  5, 4,  1,  8,  1, 7]
+/// double * values_input;   // e.g., [-5, 2, -4, 3, -1, -8, -2, 7]
+/// int * keys_output;       // empty array of 4 elements
+/// double * values_output;  // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::topk_pairs_desc(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output,
+///     input_size, k
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::topk_pairs_desc(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, values_input, values_output,
+///     input_size, k
+/// );
+/// // keys_output:   [ 8, 7,  6,  5]
+/// // values_output: [-8, 7, -5, -4]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator
+>
+inline
+hipError_t topk_pairs_desc(void * temporary_storage,
+                           size_t& storage_size,
+                           KeysInputIterator keys_input,
+                           KeysOutputIterator keys_output,
+                           ValuesInputIterator values_input,
+                           ValuesOutputIterator values_output,
+                           size_t size,
+                           size_t k,
+                           hipStream_t stream = 0,
+                           bool debug_synchronous = false)
+{
+    return detail::topk_impl<Config, true>(
+        temporary_storage, storage_size,
+        keys_input, keys_output,
+        values_input, values_output,
+        size, k,
+        stream, debug_synchronous
+    );
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_TOPK_HPP_
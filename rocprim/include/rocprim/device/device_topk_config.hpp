@@ -0,0 +1,105 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_TOPK_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_TOPK_CONFIG_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Configuration of device-level top-k selection.
+///
+/// The k-th key is found by radix select: every pass counts \p RadixBits -bit digits of keys
+/// that have the same higher digits as the k-th key (found by previous passes). Then keys
+/// preceding the k-th key are compacted by device-wide select and sorted by device-wide
+/// radix sort.
+///
+/// \tparam RadixBits - number of bits of the digit counted in one pass. <tt>2^RadixBits</tt>
+/// must not be greater than the block size of the histogram kernel.
+/// \tparam HistogramConfig - configuration of the digit counting kernel. Must be \p kernel_config.
+/// \tparam SelectConfig - [optional] configuration of the compaction. It can be \p select_config
+/// or \p default_config.
+/// \tparam SortConfig - [optional] configuration of the sort of selected items. It can be
+/// \p radix_sort_config or \p default_config.
+template<
+    unsigned int RadixBits,
+    class HistogramConfig,
+    class SelectConfig = default_config,
+    class SortConfig = default_config
+>
+struct topk_config
+{
+    /// \brief Number of bits of the digit counted in one pass.
+    static constexpr unsigned int radix_bits = RadixBits;
+    /// \brief Configuration of the digit counting kernel.
+    using histogram = HistogramConfig;
+    /// \brief Configuration of the compaction.
+    using select = SelectConfig;
+    /// \brief Configuration of the sort of selected items.
+    using sort = SortConfig;
+};
+
+namespace detail
+{
+
+template<class Key>
+struct topk_config_803
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int));
+
+    using type = topk_config<8, kernel_config<256, ::rocprim::max(1u, 16u / item_scale)>>;
+};
+
+template<class Key>
+struct topk_config_900
+{
+    static constexpr unsigned int item_scale =
+        ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Key), sizeof(int));
+
+    using type = topk_config<8, kernel_config<256, ::rocprim::max(1u, 16u / item_scale)>>;
+};
+
+template<unsigned int TargetArch, class Key>
+struct default_topk_config
+    : select_arch<
+        TargetArch,
+        select_arch_case<803, topk_config_803<Key>>,
+        select_arch_case<900, topk_config_900<Key>>,
+        topk_config_900<Key>
+    > { };
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DEVICE_TOPK_CONFIG_HPP_
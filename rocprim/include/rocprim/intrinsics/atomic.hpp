@@ -21,6 +21,8 @@
 #ifndef ROCPRIM_INTRINSICS_ATOMIC_HPP_
 #define ROCPRIM_INTRINSICS_ATOMIC_HPP_
 
+#include <type_traits>
+
 #include "../config.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -45,12 +47,31 @@ namespace detail
         return ::atomicAdd(address, value);
     }
 
+    ROCPRIM_DEVICE inline
+    double atomic_add(double * address, double value)
+    {
+        return ::atomicAdd(address, value);
+    }
+
     ROCPRIM_DEVICE inline
     unsigned long long atomic_add(unsigned long long * address, unsigned long long value)
     {
         return ::atomicAdd(address, value);
     }
 
+    // size_t is unsigned long on LP64 platforms, it is a distinct type from unsigned long long
+    // of the same size
+    ROCPRIM_DEVICE inline
+    unsigned long atomic_add(unsigned long * address, unsigned long value)
+    {
+        using atomic_type = typename std::conditional<
+            sizeof(unsigned long) == sizeof(unsigned long long), unsigned long long, unsigned int
+        >::type;
+        return static_cast<unsigned long>(
+            ::atomicAdd(reinterpret_cast<atomic_type *>(address), static_cast<atomic_type>(value))
+        );
+    }
+
     ROCPRIM_DEVICE inline
     unsigned int atomic_wrapinc(unsigned int * address, unsigned int value)
     {
@@ -49,10 +49,12 @@
 #include "block/block_sort.hpp"
 #include "block/block_store.hpp"
 
+#include "device/device_adjacent_difference.hpp"
 #include "device/device_binary_search.hpp"
 #include "device/device_histogram.hpp"
 #include "device/device_merge.hpp"
 #include "device/device_merge_sort.hpp"
+#include "device/device_nth_element.hpp"
 #include "device/device_partition.hpp"
 #include "device/device_radix_sort.hpp"
 #include "device/device_reduce_by_key.hpp"
@@ -60,10 +62,12 @@
 #include "device/device_run_length_encode.hpp"
 #include "device/device_scan_by_key.hpp"
 #include "device/device_scan.hpp"
+#include "device/device_segmented_merge_sort.hpp"
 #include "device/device_segmented_radix_sort.hpp"
 #include "device/device_segmented_reduce.hpp"
 #include "device/device_segmented_scan.hpp"
 #include "device/device_select.hpp"
+#include "device/device_topk.hpp"
 #include "device/device_transform.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
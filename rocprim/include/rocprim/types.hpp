@@ -29,6 +29,7 @@
 #include "types/double_buffer.hpp"
 #include "types/integer_sequence.hpp"
 #include "types/key_value_pair.hpp"
+#include "types/radix_key_decomposer.hpp"
 #include "types/tuple.hpp"
 
 /// \addtogroup utilsmodule
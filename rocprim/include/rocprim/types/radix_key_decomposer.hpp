@@ -0,0 +1,98 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_TYPES_RADIX_KEY_DECOMPOSER_HPP_
+#define ROCPRIM_TYPES_RADIX_KEY_DECOMPOSER_HPP_
+
+#include "../config.hpp"
+
+/// \addtogroup utilsmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Customization point that allows using user-defined types as keys of radix sort.
+///
+/// Radix sort supports integral (including \p __int128 and <tt>unsigned __int128</tt>
+/// if they are supported by the compiler), floating point types and \p rocprim::tuple
+/// of supported types as keys. Tuples are ordered lexicographically: the first element
+/// occupies the most significant bits of the radix key, the last element occupies
+/// the least significant bits. For example, radix key of <tt>rocprim::tuple<int, short></tt>
+/// has 48 bits: bits <tt>[16; 48)</tt> are taken by \p int and bits <tt>[0; 16)</tt> by \p short.
+/// The total number of bits must not exceed 64 (or 128 if \p __int128 is supported).
+///
+/// Other types can be used as keys if \p radix_key_decomposer is specialized for them.
+/// The specialization must define \p tuple_type (\p rocprim::tuple of supported types)
+/// and two static functions: \p decompose, which converts a key to \p tuple_type,
+/// and \p compose, which reconstructs the key from \p tuple_type.
+///
+/// \p begin_bit and \p end_bit of radix sort functions refer to bits of the radix key,
+/// <tt>end_bit</tt> greater than the number of bits of the radix key is treated as
+/// the number of bits.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// struct event
+/// {
+///     unsigned int tenant_id;
+///     long long timestamp;
+/// };
+///
+/// namespace rocprim
+/// {
+///
+/// // Events are sorted by tenant_id, then by timestamp
+/// template<>
+/// struct radix_key_decomposer<event>
+/// {
+///     using tuple_type = rocprim::tuple<unsigned int, long long>;
+///
+///     ROCPRIM_HOST_DEVICE static tuple_type decompose(const event& key)
+///     {
+///         return tuple_type(key.tenant_id, key.timestamp);
+///     }
+///
+///     ROCPRIM_HOST_DEVICE static event compose(const tuple_type& t)
+///     {
+///         return event { rocprim::get<0>(t), rocprim::get<1>(t) };
+///     }
+/// };
+///
+/// } // end namespace rocprim
+///
+/// // event can be used as key type of rocprim::radix_sort_keys, rocprim::radix_sort_pairs,
+/// // rocprim::segmented_radix_sort_keys etc.
+/// \endcode
+/// \endparblock
+///
+/// \tparam Key - key type.
+template<class Key>
+struct radix_key_decomposer
+{
+
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group utilsmodule
+
+#endif // ROCPRIM_TYPES_RADIX_KEY_DECOMPOSER_HPP_
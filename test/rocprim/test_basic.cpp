@@ -45,3 +45,22 @@ TEST(RocprimBasicTests, GetVersionOnDevice)
     auto version = get_rocprim_version_on_device();
     ASSERT_EQ(version, ROCPRIM_VERSION);
 }
+
+TEST(RocprimBasicTests, GetDeviceInfo)
+{
+    int device_id;
+    ASSERT_EQ(hipGetDevice(&device_id), hipSuccess);
+    hipDeviceProp_t prop;
+    ASSERT_EQ(hipGetDeviceProperties(&prop, device_id), hipSuccess);
+
+    // The second call returns cached properties
+    for(int i = 0; i < 2; i++)
+    {
+        rocprim::detail::device_info info;
+        ASSERT_EQ(rocprim::detail::get_device_info(info), hipSuccess);
+        ASSERT_EQ(info.arch, prop.gcnArch);
+        ASSERT_EQ(info.compute_units, static_cast<unsigned int>(prop.multiProcessorCount));
+        ASSERT_EQ(info.shared_memory_per_block, prop.sharedMemPerBlock);
+        ASSERT_EQ(info.warp_size, static_cast<unsigned int>(prop.warpSize));
+    }
+}
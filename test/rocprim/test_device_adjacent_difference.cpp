@@ -0,0 +1,324 @@
+// MIT License
+//
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+// Google Test
+#include <gtest/gtest.h>
+// HIP API
+#include <hip/hip_runtime.h>
+// rocPRIM API
+#include <rocprim/rocprim.hpp>
+
+#include "test_utils.hpp"
+
+#define HIP_CHECK(error)         \
+    ASSERT_EQ(static_cast<hipError_t>(error),hipSuccess)
+
+namespace rp = rocprim;
+
+// Params for tests
+template<
+    class InputType,
+    class OutputType = InputType,
+    class Config = rp::default_config
+>
+struct DeviceAdjacentDifferenceParams
+{
+    using input_type = InputType;
+    using output_type = OutputType;
+    using config = Config;
+};
+
+template<class Params>
+class RocprimDeviceAdjacentDifferenceTests : public ::testing::Test
+{
+public:
+    using input_type = typename Params::input_type;
+    using output_type = typename Params::output_type;
+    using config = typename Params::config;
+    static constexpr bool debug_synchronous = false;
+};
+
+using custom_int2 = test_utils::custom_test_type<int>;
+using custom_double2 = test_utils::custom_test_type<double>;
+
+typedef ::testing::Types<
+    DeviceAdjacentDifferenceParams<int>,
+    DeviceAdjacentDifferenceParams<unsigned long long>,
+    DeviceAdjacentDifferenceParams<int8_t>,
+    DeviceAdjacentDifferenceParams<float, double>,
+    DeviceAdjacentDifferenceParams<double>,
+    DeviceAdjacentDifferenceParams<custom_int2>,
+    DeviceAdjacentDifferenceParams<custom_double2>,
+    DeviceAdjacentDifferenceParams<int, int, rp::adjacent_difference_config<64, 3>>,
+    DeviceAdjacentDifferenceParams<long long, long long, rp::adjacent_difference_config<256, 1>>
+> RocprimDeviceAdjacentDifferenceTestsParams;
+
+std::vector<size_t> get_sizes(int seed_value)
+{
+    std::vector<size_t> sizes = {
+        1, 10, 53, 211,
+        1024, 2048, 5096,
+        34567, (1 << 17) - 1220
+    };
+    const std::vector<size_t> random_sizes = test_utils::get_random_data<size_t>(2, 1, 16384, seed_value);
+    sizes.insert(sizes.end(), random_sizes.begin(), random_sizes.end());
+    std::sort(sizes.begin(), sizes.end());
+    return sizes;
+}
+
+TYPED_TEST_CASE(RocprimDeviceAdjacentDifferenceTests, RocprimDeviceAdjacentDifferenceTestsParams);
+
+// Runs one variant of adjacent difference (left or right, in-place or not) and compares
+// results with the host implementation
+template<class Config, bool InPlace, bool Right, class T, class U>
+void test_adjacent_difference(const std::vector<T>& input, bool debug_synchronous)
+{
+    hipStream_t stream = 0; // default
+    const size_t size = input.size();
+
+    // Calculate expected results on host
+    std::vector<U> expected(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        if(Right)
+        {
+            expected[i] = i + 1 < size ? U(input[i] - input[i + 1]) : U(input[i]);
+        }
+        else
+        {
+            expected[i] = i > 0 ? U(input[i] - input[i - 1]) : U(input[i]);
+        }
+    }
+
+    T * d_input;
+    U * d_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(U)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_input, input.data(),
+            size * sizeof(T),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    auto run = [&](void * d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(InPlace)
+        {
+            return Right
+                ? rp::adjacent_difference_right_inplace<Config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_input, size, rp::minus<T>(), stream, debug_synchronous
+                )
+                : rp::adjacent_difference_inplace<Config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_input, size, rp::minus<T>(), stream, debug_synchronous
+                );
+        }
+        return Right
+            ? rp::adjacent_difference_right<Config>(
+                d_temporary_storage, temporary_storage_bytes,
+                d_input, d_output, size, rp::minus<T>(), stream, debug_synchronous
+            )
+            : rp::adjacent_difference<Config>(
+                d_temporary_storage, temporary_storage_bytes,
+                d_input, d_output, size, rp::minus<T>(), stream, debug_synchronous
+            );
+    };
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(run(nullptr, temporary_storage_bytes));
+    ASSERT_GT(temporary_storage_bytes, 0U);
+
+    void * d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+
+    // Copy output to host
+    std::vector<U> output(size);
+    if(InPlace)
+    {
+        std::vector<T> inplace_output(size);
+        HIP_CHECK(
+            hipMemcpy(
+                inplace_output.data(), d_input,
+                size * sizeof(T),
+                hipMemcpyDeviceToHost
+            )
+        );
+        std::copy(inplace_output.begin(), inplace_output.end(), output.begin());
+    }
+    else
+    {
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), d_output,
+                size * sizeof(U),
+                hipMemcpyDeviceToHost
+            )
+        );
+    }
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+
+    // Check if output values are as expected
+    ASSERT_NO_FATAL_FAILURE(test_utils::assert_near(output, expected, 0.01f));
+}
+
+TYPED_TEST(RocprimDeviceAdjacentDifferenceTests, AdjacentDifference)
+{
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    using config = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            ASSERT_NO_FATAL_FAILURE((test_adjacent_difference<config, false, false, T, U>(input, debug_synchronous)));
+            ASSERT_NO_FATAL_FAILURE((test_adjacent_difference<config, false, true, T, U>(input, debug_synchronous)));
+            ASSERT_NO_FATAL_FAILURE((test_adjacent_difference<config, true, false, T, T>(input, debug_synchronous)));
+            ASSERT_NO_FATAL_FAILURE((test_adjacent_difference<config, true, true, T, T>(input, debug_synchronous)));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceAdjacentDifferenceTests, AdjacentDifferenceByKey)
+{
+    using key_type = int;
+    using T = typename TestFixture::input_type;
+    using config = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Runs of equal keys
+            std::vector<key_type> keys_input(size);
+            std::default_random_engine gen(seed_value);
+            std::uniform_int_distribution<size_t> key_count_dis(1, 100);
+            key_type current_key = 0;
+            for(size_t offset = 0; offset < size; current_key++)
+            {
+                const size_t end = std::min(size, offset + key_count_dis(gen));
+                std::fill(keys_input.begin() + offset, keys_input.begin() + end, current_key);
+                offset = end;
+            }
+            std::vector<T> values_input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            std::vector<T> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = (i > 0 && keys_input[i] == keys_input[i - 1])
+                    ? T(values_input[i] - values_input[i - 1])
+                    : values_input[i];
+            }
+
+            key_type * d_keys_input;
+            T * d_values;
+            HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(hipMalloc(&d_values, size * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_values, values_input.data(),
+                    size * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // In-place
+            size_t temporary_storage_bytes;
+            HIP_CHECK(
+                rp::adjacent_difference_by_key<config>(
+                    nullptr, temporary_storage_bytes,
+                    d_keys_input, d_values, d_values, size,
+                    rp::minus<T>(), rp::equal_to<key_type>(),
+                    stream, debug_synchronous
+                )
+            );
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rp::adjacent_difference_by_key<config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_keys_input, d_values, d_values, size,
+                    rp::minus<T>(), rp::equal_to<key_type>(),
+                    stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipPeekAtLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_values,
+                    size * sizeof(T),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_values));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_near(output, expected, 0.01f));
+        }
+    }
+}
@@ -421,3 +421,295 @@ TYPED_TEST(RocprimDeviceBinarySearch, BinarySearch)
         }
     }   
 }
+
+// Sorted needles (lower_bound_sorted_needles and upper_bound_sorted_needles)
+template<class Params, bool Upper>
+void test_sorted_needles()
+{
+    using haystack_type = typename Params::haystack_type;
+    using needle_type = typename Params::needle_type;
+    using output_type = typename Params::output_type;
+    using compare_op_type = typename Params::compare_op_type;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    compare_op_type compare_op;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t haystack_size = size;
+            const size_t d = haystack_size / 100;
+
+            // Generate data
+            std::vector<haystack_type> haystack = test_utils::get_random_data<haystack_type>(
+                haystack_size, 0, haystack_size + 2 * d, seed_value
+            );
+            std::sort(haystack.begin(), haystack.end(), compare_op);
+
+            // Few and many needles (with duplicates)
+            for(size_t needles_size : { size_t(std::sqrt(size)), size })
+            {
+                SCOPED_TRACE(testing::Message() << "with needles_size = " << needles_size);
+
+                std::vector<needle_type> needles = test_utils::get_random_data<needle_type>(
+                    needles_size, d, haystack_size + d, seed_value
+                );
+                std::sort(needles.begin(), needles.end(), compare_op);
+
+                haystack_type * d_haystack;
+                needle_type * d_needles;
+                output_type * d_output;
+                HIP_CHECK(hipMalloc(&d_haystack, haystack_size * sizeof(haystack_type)));
+                HIP_CHECK(hipMalloc(&d_needles, needles_size * sizeof(needle_type)));
+                HIP_CHECK(hipMalloc(&d_output, needles_size * sizeof(output_type)));
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_haystack, haystack.data(),
+                        haystack_size * sizeof(haystack_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_needles, needles.data(),
+                        needles_size * sizeof(needle_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+
+                // Calculate expected results on host
+                std::vector<output_type> expected(needles_size);
+                for(size_t i = 0; i < needles_size; i++)
+                {
+                    expected[i] = Upper
+                        ? std::upper_bound(haystack.begin(), haystack.end(), needles[i], compare_op) -
+                            haystack.begin()
+                        : std::lower_bound(haystack.begin(), haystack.end(), needles[i], compare_op) -
+                            haystack.begin();
+                }
+
+                auto run = [&](void * d_temporary_storage, size_t& temporary_storage_bytes)
+                {
+                    return Upper
+                        ? rocprim::upper_bound_sorted_needles(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_haystack, d_needles, d_output,
+                            haystack_size, needles_size,
+                            compare_op,
+                            stream, debug_synchronous
+                        )
+                        : rocprim::lower_bound_sorted_needles(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_haystack, d_needles, d_output,
+                            haystack_size, needles_size,
+                            compare_op,
+                            stream, debug_synchronous
+                        );
+                };
+
+                void * d_temporary_storage = nullptr;
+                size_t temporary_storage_bytes;
+                HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+                HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+
+                std::vector<output_type> output(needles_size);
+                HIP_CHECK(
+                    hipMemcpy(
+                        output.data(), d_output,
+                        needles_size * sizeof(output_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_haystack));
+                HIP_CHECK(hipFree(d_needles));
+                HIP_CHECK(hipFree(d_output));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBinarySearch, LowerBoundSortedNeedles)
+{
+    ASSERT_NO_FATAL_FAILURE((test_sorted_needles<typename TestFixture::params, false>()));
+}
+
+TYPED_TEST(RocprimDeviceBinarySearch, UpperBoundSortedNeedles)
+{
+    ASSERT_NO_FATAL_FAILURE((test_sorted_needles<typename TestFixture::params, true>()));
+}
+
+template<class Params, bool Upper>
+void test_search_index()
+{
+    using haystack_type = typename Params::haystack_type;
+    using needle_type = typename Params::needle_type;
+    using output_type = typename Params::output_type;
+    using compare_op_type = typename Params::compare_op_type;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    compare_op_type compare_op;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t haystack_size = size;
+            const size_t index_size = rocprim::search_index_size(haystack_size);
+            const size_t needles_size = size;
+            const size_t d = haystack_size / 100;
+
+            // Generate data
+            std::vector<haystack_type> haystack = test_utils::get_random_data<haystack_type>(
+                haystack_size, 0, haystack_size + 2 * d, seed_value
+            );
+            std::sort(haystack.begin(), haystack.end(), compare_op);
+
+            std::vector<needle_type> needles = test_utils::get_random_data<needle_type>(
+                needles_size, d, haystack_size + d, seed_value
+            );
+
+            haystack_type * d_haystack;
+            haystack_type * d_index;
+            needle_type * d_needles;
+            output_type * d_output;
+            HIP_CHECK(hipMalloc(&d_haystack, haystack_size * sizeof(haystack_type)));
+            HIP_CHECK(hipMalloc(&d_index, index_size * sizeof(haystack_type)));
+            HIP_CHECK(hipMalloc(&d_needles, needles_size * sizeof(needle_type)));
+            HIP_CHECK(hipMalloc(&d_output, needles_size * sizeof(output_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_haystack, haystack.data(),
+                    haystack_size * sizeof(haystack_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_needles, needles.data(),
+                    needles_size * sizeof(needle_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<output_type> expected(needles_size);
+            for(size_t i = 0; i < needles_size; i++)
+            {
+                expected[i] = Upper
+                    ? std::upper_bound(haystack.begin(), haystack.end(), needles[i], compare_op) -
+                        haystack.begin()
+                    : std::lower_bound(haystack.begin(), haystack.end(), needles[i], compare_op) -
+                        haystack.begin();
+            }
+
+            const rocprim::search_index<haystack_type> index =
+                rocprim::make_search_index(d_index, haystack_size);
+
+            void * d_temporary_storage = nullptr;
+            size_t temporary_storage_bytes;
+            HIP_CHECK(
+                rocprim::build_search_index(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_haystack, index,
+                    stream, debug_synchronous
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rocprim::build_search_index(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_haystack, index,
+                    stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            // The index does not reference the haystack
+            HIP_CHECK(hipFree(d_haystack));
+
+            auto run = [&](void * d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                return Upper
+                    ? rocprim::upper_bound(
+                        d_temporary_storage, temporary_storage_bytes,
+                        index, d_needles, d_output,
+                        needles_size,
+                        compare_op,
+                        stream, debug_synchronous
+                    )
+                    : rocprim::lower_bound(
+                        d_temporary_storage, temporary_storage_bytes,
+                        index, d_needles, d_output,
+                        needles_size,
+                        compare_op,
+                        stream, debug_synchronous
+                    );
+            };
+
+            d_temporary_storage = nullptr;
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<output_type> output(needles_size);
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    needles_size * sizeof(output_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_index));
+            HIP_CHECK(hipFree(d_needles));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBinarySearch, LowerBoundSearchIndex)
+{
+    ASSERT_NO_FATAL_FAILURE((test_search_index<typename TestFixture::params, false>()));
+}
+
+TYPED_TEST(RocprimDeviceBinarySearch, UpperBoundSearchIndex)
+{
+    ASSERT_NO_FATAL_FAILURE((test_search_index<typename TestFixture::params, true>()));
+}
@@ -27,6 +27,7 @@
 #include <tuple>
 #include <vector>
 #include <utility>
+#include <random>
 
 // Google Test
 #include <gtest/gtest.h>
@@ -312,6 +313,547 @@ TYPED_TEST(RocprimDeviceHistogramEven, Even)
     }
 }
 
+// Most samples fall into one bin and form long runs of equal values, so both privatized copies
+// of the histogram and pre-aggregation of runs are used
+template<unsigned int SharedImplHistograms>
+void test_histogram_even_skewed()
+{
+    using sample_type = unsigned char;
+    using counter_type = unsigned int;
+    using config = rp::histogram_config<
+        rp::kernel_config<256, 8>, 1024, 2048, SharedImplHistograms
+    >;
+    constexpr unsigned int bins = 64;
+    constexpr int lower_level = 0;
+    constexpr int upper_level = 256;
+
+    hipStream_t stream = 0;
+    const bool debug_synchronous = false;
+
+    for(size_t size : { 1, 53, 5096, 34567, (1 << 20) - 1220 })
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+            std::vector<sample_type> input = test_utils::get_random_data<sample_type>(size, 0, 255, seed_value);
+            std::default_random_engine gen(seed_value);
+            std::uniform_int_distribution<int> hot_dis(0, 9);
+            for(size_t i = 0; i < size; i++)
+            {
+                // 90% of samples are in the same bin, runs of equal samples
+                if(hot_dis(gen) != 0)
+                {
+                    input[i] = i > 0 && (i % 16) != 0 ? input[i - 1] : 100;
+                }
+            }
+
+            std::vector<counter_type> histogram_expected(bins, 0);
+            for(sample_type sample : input)
+            {
+                histogram_expected[(sample - lower_level) * bins / (upper_level - lower_level)]++;
+            }
+
+            sample_type * d_input;
+            counter_type * d_histogram;
+            HIP_CHECK(hipMalloc(&d_input, size * sizeof(sample_type)));
+            HIP_CHECK(hipMalloc(&d_histogram, bins * sizeof(counter_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    size * sizeof(sample_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(
+                rp::histogram_even<config>(
+                    nullptr, temporary_storage_bytes,
+                    d_input, size,
+                    d_histogram,
+                    bins + 1, lower_level, upper_level,
+                    stream, debug_synchronous
+                )
+            );
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rp::histogram_even<config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_input, size,
+                    d_histogram,
+                    bins + 1, lower_level, upper_level,
+                    stream, debug_synchronous
+                )
+            );
+
+            std::vector<counter_type> histogram(bins);
+            HIP_CHECK(
+                hipMemcpy(
+                    histogram.data(), d_histogram,
+                    bins * sizeof(counter_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_histogram));
+
+            for(size_t i = 0; i < bins; i++)
+            {
+                ASSERT_EQ(histogram[i], histogram_expected[i]);
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceHistogramEven, EvenSkewed)
+{
+    ASSERT_NO_FATAL_FAILURE(test_histogram_even_skewed<1>());
+    ASSERT_NO_FATAL_FAILURE(test_histogram_even_skewed<8>());
+    ASSERT_NO_FATAL_FAILURE(test_histogram_even_skewed<64>());
+}
+
+TEST(RocprimDeviceHistogramEven, MultiEvenSortImpl)
+{
+    // Many bins, the sort-based implementation is used
+    using sample_type = int;
+    using counter_type = unsigned int;
+    using config = rp::histogram_config<rp::kernel_config<256, 4>, 1024, 2048, 4, 4096>;
+    constexpr unsigned int channels = 2;
+    constexpr unsigned int active_channels = 2;
+
+    unsigned int bins[active_channels] = { 10000, 123456 };
+    unsigned int levels[active_channels];
+    int lower_level[active_channels] = { 0, -1000 };
+    int upper_level[active_channels];
+    for(unsigned int channel = 0; channel < active_channels; channel++)
+    {
+        levels[channel] = bins[channel] + 1;
+        upper_level[channel] = lower_level[channel] + static_cast<int>(bins[channel]) * 2;
+    }
+
+    hipStream_t stream = 0;
+    const bool debug_synchronous = false;
+
+    for(size_t size : { 1, 5096, 34567, (1 << 20) - 1220 })
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+            // Some samples are outside of histogram ranges
+            std::vector<sample_type> input = test_utils::get_random_data<sample_type>(
+                size * channels, -2000, 300000, seed_value
+            );
+
+            std::vector<counter_type> histogram_expected[active_channels];
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                histogram_expected[channel].assign(bins[channel], 0);
+                for(size_t i = 0; i < size; i++)
+                {
+                    const int s = input[i * channels + channel];
+                    if(s >= lower_level[channel] && s < upper_level[channel])
+                    {
+                        histogram_expected[channel][(s - lower_level[channel]) / 2]++;
+                    }
+                }
+            }
+
+            sample_type * d_input;
+            counter_type * d_histogram[active_channels];
+            HIP_CHECK(hipMalloc(&d_input, size * channels * sizeof(sample_type)));
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                HIP_CHECK(hipMalloc(&d_histogram[channel], bins[channel] * sizeof(counter_type)));
+            }
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    size * channels * sizeof(sample_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK((
+                rp::multi_histogram_even<channels, active_channels, config>(
+                    nullptr, temporary_storage_bytes,
+                    d_input, size,
+                    d_histogram,
+                    levels, lower_level, upper_level,
+                    stream, debug_synchronous
+                )
+            ));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK((
+                rp::multi_histogram_even<channels, active_channels, config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_input, size,
+                    d_histogram,
+                    levels, lower_level, upper_level,
+                    stream, debug_synchronous
+                )
+            ));
+
+            std::vector<counter_type> histogram[active_channels];
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                histogram[channel].resize(bins[channel]);
+                HIP_CHECK(
+                    hipMemcpy(
+                        histogram[channel].data(), d_histogram[channel],
+                        bins[channel] * sizeof(counter_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+            }
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                HIP_CHECK(hipFree(d_histogram[channel]));
+            }
+
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                SCOPED_TRACE(testing::Message() << "with channel = " << channel);
+                for(size_t i = 0; i < bins[channel]; i++)
+                {
+                    ASSERT_EQ(histogram[channel][i], histogram_expected[channel][i]);
+                }
+            }
+        }
+    }
+}
+
+template<class Counter>
+void test_weighted_multi_histogram_even(unsigned int bins)
+{
+    using sample_type = unsigned short;
+    using weight_type = float;
+    using counter_type = Counter;
+    constexpr unsigned int channels = 4;
+    constexpr unsigned int active_channels = 3;
+
+    unsigned int levels[active_channels];
+    int lower_level[active_channels] = { 0, 100, 0 };
+    int upper_level[active_channels];
+    for(unsigned int channel = 0; channel < active_channels; channel++)
+    {
+        levels[channel] = bins + 1;
+        upper_level[channel] = lower_level[channel] + static_cast<int>(bins) * 3;
+    }
+
+    hipStream_t stream = 0;
+    const bool debug_synchronous = false;
+
+    for(size_t size : { 1, 53, 5096, 34567, (1 << 18) - 1220 })
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+            std::vector<sample_type> input = test_utils::get_random_data<sample_type>(
+                size * channels, 0, static_cast<sample_type>(bins * 3 + 200), seed_value
+            );
+            // Multiples of 0.25 are summed exactly (in any order)
+            const std::vector<int> quarters = test_utils::get_random_data<int>(size, 0, 8, seed_value);
+            std::vector<weight_type> weights(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                weights[i] = quarters[i] * 0.25f;
+            }
+
+            std::vector<counter_type> histogram_expected[active_channels];
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                histogram_expected[channel].assign(bins, 0);
+                for(size_t i = 0; i < size; i++)
+                {
+                    const int s = input[i * channels + channel];
+                    if(s >= lower_level[channel] && s < upper_level[channel])
+                    {
+                        histogram_expected[channel][(s - lower_level[channel]) / 3] += weights[i];
+                    }
+                }
+            }
+
+            sample_type * d_input;
+            weight_type * d_weights;
+            counter_type * d_histogram[active_channels];
+            HIP_CHECK(hipMalloc(&d_input, size * channels * sizeof(sample_type)));
+            HIP_CHECK(hipMalloc(&d_weights, size * sizeof(weight_type)));
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                HIP_CHECK(hipMalloc(&d_histogram[channel], bins * sizeof(counter_type)));
+            }
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    size * channels * sizeof(sample_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_weights, weights.data(),
+                    size * sizeof(weight_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK((
+                rp::weighted_multi_histogram_even<channels, active_channels>(
+                    nullptr, temporary_storage_bytes,
+                    d_input, d_weights, size,
+                    d_histogram,
+                    levels, lower_level, upper_level,
+                    stream, debug_synchronous
+                )
+            ));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK((
+                rp::weighted_multi_histogram_even<channels, active_channels>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_input, d_weights, size,
+                    d_histogram,
+                    levels, lower_level, upper_level,
+                    stream, debug_synchronous
+                )
+            ));
+
+            std::vector<counter_type> histogram[active_channels];
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                histogram[channel].resize(bins);
+                HIP_CHECK(
+                    hipMemcpy(
+                        histogram[channel].data(), d_histogram[channel],
+                        bins * sizeof(counter_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+            }
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_weights));
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                HIP_CHECK(hipFree(d_histogram[channel]));
+            }
+
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                SCOPED_TRACE(testing::Message() << "with channel = " << channel);
+                for(size_t i = 0; i < bins; i++)
+                {
+                    ASSERT_EQ(histogram[channel][i], histogram_expected[channel][i]);
+                }
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceHistogramEven, WeightedMultiEven)
+{
+    // Shared and global implementations
+    ASSERT_NO_FATAL_FAILURE(test_weighted_multi_histogram_even<float>(100));
+    ASSERT_NO_FATAL_FAILURE(test_weighted_multi_histogram_even<float>(5000));
+    ASSERT_NO_FATAL_FAILURE(test_weighted_multi_histogram_even<double>(100));
+    ASSERT_NO_FATAL_FAILURE(test_weighted_multi_histogram_even<double>(5000));
+}
+
+// Range histograms use the same (evenly-segmented) levels, so results are the same
+template<bool Range>
+void test_segmented_histogram(unsigned int bins)
+{
+    using sample_type = int;
+    using counter_type = unsigned int;
+
+    const unsigned int levels = bins + 1;
+    const int lower_level = -100;
+    const int upper_level = lower_level + static_cast<int>(bins) * 4;
+    std::vector<int> level_values(levels);
+    for(unsigned int i = 0; i < levels; i++)
+    {
+        level_values[i] = lower_level + static_cast<int>(i) * 4;
+    }
+
+    hipStream_t stream = 0;
+    const bool debug_synchronous = false;
+
+    for(unsigned int max_segment_length : { 0, 1, 100, 1234, 20000 })
+    {
+        SCOPED_TRACE(testing::Message() << "with max_segment_length = " << max_segment_length);
+
+        for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+            // Segments with gaps between them (samples not included in any segment)
+            std::default_random_engine gen(seed_value);
+            std::uniform_int_distribution<unsigned int> length_dis(0, max_segment_length);
+            std::vector<unsigned int> begin_offsets;
+            std::vector<unsigned int> end_offsets;
+            unsigned int offset = 0;
+            for(unsigned int segment = 0; segment < 500; segment++)
+            {
+                offset += length_dis(gen) / 8;
+                begin_offsets.push_back(offset);
+                offset += length_dis(gen);
+                end_offsets.push_back(offset);
+            }
+            const size_t size = offset;
+            const unsigned int segments = begin_offsets.size();
+
+            // Some samples are outside of histogram ranges
+            std::vector<sample_type> input = test_utils::get_random_data<sample_type>(
+                size, lower_level - 10, upper_level + 10, seed_value
+            );
+
+            std::vector<counter_type> histogram_expected(segments * bins, 0);
+            for(unsigned int segment = 0; segment < segments; segment++)
+            {
+                for(unsigned int i = begin_offsets[segment]; i < end_offsets[segment]; i++)
+                {
+                    const int s = input[i];
+                    if(s >= lower_level && s < upper_level)
+                    {
+                        histogram_expected[segment * bins + (s - lower_level) / 4]++;
+                    }
+                }
+            }
+
+            sample_type * d_input;
+            int * d_level_values;
+            unsigned int * d_offsets;
+            counter_type * d_histogram;
+            HIP_CHECK(hipMalloc(&d_input, std::max<size_t>(1, size) * sizeof(sample_type)));
+            HIP_CHECK(hipMalloc(&d_level_values, levels * sizeof(int)));
+            HIP_CHECK(hipMalloc(&d_offsets, 2 * segments * sizeof(unsigned int)));
+            HIP_CHECK(hipMalloc(&d_histogram, segments * bins * sizeof(counter_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    size * sizeof(sample_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_level_values, level_values.data(),
+                    levels * sizeof(int),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_offsets, begin_offsets.data(),
+                    segments * sizeof(unsigned int),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_offsets + segments, end_offsets.data(),
+                    segments * sizeof(unsigned int),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            auto run = [&](void * d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                return Range
+                    ? rp::segmented_histogram_range(
+                        d_temporary_storage, temporary_storage_bytes,
+                        d_input, d_histogram,
+                        segments, d_offsets, d_offsets + segments,
+                        levels, d_level_values,
+                        stream, debug_synchronous
+                    )
+                    : rp::segmented_histogram_even(
+                        d_temporary_storage, temporary_storage_bytes,
+                        d_input, d_histogram,
+                        segments, d_offsets, d_offsets + segments,
+                        levels, lower_level, upper_level,
+                        stream, debug_synchronous
+                    );
+            };
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<counter_type> histogram(segments * bins);
+            HIP_CHECK(
+                hipMemcpy(
+                    histogram.data(), d_histogram,
+                    segments * bins * sizeof(counter_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_level_values));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_histogram));
+
+            for(size_t i = 0; i < segments * bins; i++)
+            {
+                ASSERT_EQ(histogram[i], histogram_expected[i]) << "where segment = " << i / bins;
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceHistogramEven, SegmentedEven)
+{
+    // Shared and global implementations
+    ASSERT_NO_FATAL_FAILURE(test_segmented_histogram<false>(10));
+    ASSERT_NO_FATAL_FAILURE(test_segmented_histogram<false>(256));
+    ASSERT_NO_FATAL_FAILURE(test_segmented_histogram<false>(5000));
+}
+
+TEST(RocprimDeviceHistogramRange, SegmentedRange)
+{
+    ASSERT_NO_FATAL_FAILURE(test_segmented_histogram<true>(10));
+    ASSERT_NO_FATAL_FAILURE(test_segmented_histogram<true>(5000));
+}
+
 template<
     class SampleType,
     unsigned int Bins,
@@ -1066,3 +1608,122 @@ TYPED_TEST(RocprimDeviceHistogramMultiRange, MultiRange)
         
     }
 }
+
+// Custom config with only members of the original histogram_config, the number of privatized
+// copies and the sort-based implementation use their defaults
+struct custom_histogram_config
+{
+    using histogram = rp::kernel_config<192, 3>;
+
+    static constexpr unsigned int max_grid_size = 1024;
+    static constexpr unsigned int shared_impl_max_bins = 2048;
+};
+
+constexpr unsigned int custom_histogram_config::max_grid_size;
+constexpr unsigned int custom_histogram_config::shared_impl_max_bins;
+
+TEST(RocprimDeviceHistogramRange, CustomConfig)
+{
+    using sample_type = int;
+    using counter_type = unsigned int;
+    using level_type = int;
+    using config = custom_histogram_config;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    const std::vector<level_type> levels = { 0, 10, 20, 50, 100, 300, 1000, 5000 };
+    const unsigned int bins = levels.size() - 1;
+
+    for(size_t size : { 1, 1000, 12345, 1 << 20 })
+    {
+        SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+        for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+            // Generate data
+            std::vector<sample_type> input = get_random_samples<sample_type>(size, levels.front(), levels.back(), seed_value);
+
+            sample_type * d_input;
+            level_type * d_levels;
+            counter_type * d_histogram;
+            HIP_CHECK(hipMalloc(&d_input, size * sizeof(sample_type)));
+            HIP_CHECK(hipMalloc(&d_levels, levels.size() * sizeof(level_type)));
+            HIP_CHECK(hipMalloc(&d_histogram, bins * sizeof(counter_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    size * sizeof(sample_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_levels, levels.data(),
+                    levels.size() * sizeof(level_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<counter_type> histogram_expected(bins, 0);
+            for(sample_type s : input)
+            {
+                if(s >= levels.front() && s < levels.back())
+                {
+                    const auto bin_iter = std::upper_bound(levels.begin(), levels.end(), s);
+                    histogram_expected[bin_iter - levels.begin() - 1]++;
+                }
+            }
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(
+                rp::histogram_range<config>(
+                    nullptr, temporary_storage_bytes,
+                    d_input, size,
+                    d_histogram,
+                    levels.size(), d_levels,
+                    stream, debug_synchronous
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rp::histogram_range<config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_input, size,
+                    d_histogram,
+                    levels.size(), d_levels,
+                    stream, debug_synchronous
+                )
+            );
+
+            std::vector<counter_type> histogram(bins);
+            HIP_CHECK(
+                hipMemcpy(
+                    histogram.data(), d_histogram,
+                    bins * sizeof(counter_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_levels));
+            HIP_CHECK(hipFree(d_histogram));
+
+            for(size_t i = 0; i < bins; i++)
+            {
+                ASSERT_EQ(histogram[i], histogram_expected[i]);
+            }
+        }
+    }
+}
@@ -42,13 +42,15 @@ namespace rp = rocprim;
 template<
     class KeyType,
     class ValueType = KeyType,
-    class CompareFunction = ::rocprim::less<KeyType>
+    class CompareFunction = ::rocprim::less<KeyType>,
+    class Config = ::rocprim::default_config
 >
 struct DeviceSortParams
 {
     using key_type = KeyType;
     using value_type = ValueType;
     using compare_function = CompareFunction;
+    using config = Config;
 };
 
 // ---------------------------------------------------------
@@ -62,6 +64,7 @@ public:
     using key_type = typename Params::key_type;
     using value_type = typename Params::value_type;
     using compare_function = typename Params::compare_function;
+    using config = typename Params::config;
     const bool debug_synchronous = false;
 };
 
@@ -78,7 +81,14 @@ typedef ::testing::Types<
     DeviceSortParams<int, float, ::rocprim::greater<int>>,
     DeviceSortParams<short, test_utils::custom_test_type<int>>,
     DeviceSortParams<double, test_utils::custom_test_type<double>>,
-    DeviceSortParams<test_utils::custom_test_type<float>, test_utils::custom_test_type<double>>
+    DeviceSortParams<test_utils::custom_test_type<float>, test_utils::custom_test_type<double>>,
+    // Tiles of the merge stage are smaller than, larger than and not aligned to sorted runs
+    DeviceSortParams<int, int, ::rocprim::less<int>, rocprim::merge_sort_config<64, 3, 32, 5>>,
+    DeviceSortParams<unsigned long, float, ::rocprim::greater<unsigned long>, rocprim::merge_sort_config<128, 1, 256, 4>>,
+    DeviceSortParams<unsigned short, int, ::rocprim::less<unsigned short>, rocprim::merge_sort_config<256, 7, 64, 2>>,
+    // Previous single-stage forms of the config
+    DeviceSortParams<int, int, ::rocprim::less<int>, rocprim::merge_sort_config<128>>,
+    DeviceSortParams<float, int, ::rocprim::less<float>, rocprim::kernel_config<256, 1>>
 > RocprimDeviceSortTestsParams;
 
 std::vector<size_t> get_sizes(int seed_value)
@@ -101,6 +111,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKey)
 {
     using key_type = typename TestFixture::key_type;
     using compare_function = typename TestFixture::compare_function;
+    using config = typename TestFixture::config;
     const bool debug_synchronous = TestFixture::debug_synchronous;
 
     bool in_place = false;
@@ -158,7 +169,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKey)
             void * d_temp_storage = nullptr;
             // Get size of d_temp_storage
             HIP_CHECK(
-                rocprim::merge_sort(
+                rocprim::merge_sort<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input, d_output, input.size(),
                     compare_op, stream, debug_synchronous
@@ -174,7 +185,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKey)
 
             // Run
             HIP_CHECK(
-                rocprim::merge_sort(
+                rocprim::merge_sort<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input, d_output, input.size(),
                     compare_op, stream, debug_synchronous
@@ -212,6 +223,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKeyValue)
     using key_type = typename TestFixture::key_type;
     using value_type = typename TestFixture::value_type;
     using compare_function = typename TestFixture::compare_function;
+    using config = typename TestFixture::config;
     const bool debug_synchronous = TestFixture::debug_synchronous;
 
     bool in_place = false;
@@ -299,7 +311,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKeyValue)
             void * d_temp_storage = nullptr;
             // Get size of d_temp_storage
             HIP_CHECK(
-                rocprim::merge_sort(
+                rocprim::merge_sort<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_keys_input, d_keys_output,
                     d_values_input, d_values_output, keys_input.size(),
@@ -316,7 +328,7 @@ TYPED_TEST(RocprimDeviceSortTests, SortKeyValue)
 
             // Run
             HIP_CHECK(
-                rocprim::merge_sort(
+                rocprim::merge_sort<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_keys_input, d_keys_output,
                     d_values_input, d_values_output, keys_input.size(),
@@ -0,0 +1,298 @@
+// MIT License
+//
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <utility>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+// rocPRIM API
+#include <rocprim/rocprim.hpp>
+
+#include "test_utils.hpp"
+
+namespace rp = rocprim;
+
+#define HIP_CHECK(error) ASSERT_EQ(static_cast<hipError_t>(error), hipSuccess)
+
+template<
+    class Key,
+    bool ManyEqualKeys = false,
+    class Config = rp::default_config
+>
+struct params
+{
+    using key_type = Key;
+    static constexpr bool many_equal_keys = ManyEqualKeys;
+    using config = Config;
+};
+
+template<class Params>
+class RocprimDeviceNthElement : public ::testing::Test {
+public:
+    using params = Params;
+};
+
+// 4-bit digits, small tiles and only 3 order statistics per batch of passes
+using small_config = rp::nth_element_config<4, rp::kernel_config<64, 3>, 3>;
+
+typedef ::testing::Types<
+    params<int>,
+    params<unsigned int>,
+    params<float>,
+    params<double>,
+    params<long long>,
+    params<unsigned char, true>,
+    params<short, true>,
+    params<unsigned long long, true>,
+
+    params<int, false, small_config>,
+    params<float, true, small_config>,
+    params<unsigned short, true, small_config>
+> Params;
+
+TYPED_TEST_CASE(RocprimDeviceNthElement, Params);
+
+template<class Key, bool ManyEqualKeys>
+auto get_keys(size_t size, int seed_value)
+    -> typename std::enable_if<ManyEqualKeys, std::vector<Key>>::type
+{
+    return test_utils::get_random_data<Key>(size, 0, 20, seed_value);
+}
+
+template<class Key, bool ManyEqualKeys>
+auto get_keys(size_t size, int seed_value)
+    -> typename std::enable_if<!ManyEqualKeys, std::vector<Key>>::type
+{
+    return test_utils::get_random_data<Key>(
+        size,
+        std::is_signed<Key>::value ? std::numeric_limits<Key>::lowest() / 2 : Key(0),
+        std::numeric_limits<Key>::max() / 2,
+        seed_value
+    );
+}
+
+std::vector<size_t> get_sizes(int seed_value)
+{
+    std::vector<size_t> sizes = {
+        1, 10, 53, 211, 1024, 2048, 5096,
+        34567, (1 << 17) - 1220, 1000000
+    };
+    const std::vector<size_t> random_sizes = test_utils::get_random_data<size_t>(3, 1, 100000, seed_value);
+    sizes.insert(sizes.end(), random_sizes.begin(), random_sizes.end());
+    return sizes;
+}
+
+TYPED_TEST(RocprimDeviceNthElement, NthElement)
+{
+    using key_type = typename TestFixture::params::key_type;
+    using config = typename TestFixture::params::config;
+    constexpr bool many_equal_keys = TestFixture::params::many_equal_keys;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input = get_keys<key_type, many_equal_keys>(size, seed_value);
+
+            key_type * d_keys_input;
+            key_type * d_output;
+            HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(hipMalloc(&d_output, sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<key_type> expected(keys_input);
+            std::sort(expected.begin(), expected.end());
+
+            for(size_t n : { size_t(0), size / 3, size / 2, size - 1 })
+            {
+                SCOPED_TRACE(testing::Message() << "with n = " << n);
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(
+                    rp::nth_element<config>(
+                        nullptr, temporary_storage_bytes,
+                        d_keys_input, d_output, size, n
+                    )
+                );
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void * d_temporary_storage;
+                HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+                HIP_CHECK(
+                    rp::nth_element<config>(
+                        d_temporary_storage, temporary_storage_bytes,
+                        d_keys_input, d_output, size, n,
+                        stream, debug_synchronous
+                    )
+                );
+
+                key_type output;
+                HIP_CHECK(
+                    hipMemcpy(
+                        &output, d_output,
+                        sizeof(key_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                ASSERT_EQ(output, expected[n]);
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceNthElement, SelectQuantiles)
+{
+    using key_type = typename TestFixture::params::key_type;
+    using config = typename TestFixture::params::config;
+    constexpr bool many_equal_keys = TestFixture::params::many_equal_keys;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input = get_keys<key_type, many_equal_keys>(size, seed_value);
+
+            // Percentiles and a few random ranks (more than max_selections of small_config)
+            std::vector<size_t> ranks = {
+                0, size / 2, size * 9 / 10, size * 99 / 100, size * 999 / 1000, size - 1
+            };
+            const std::vector<size_t> random_ranks =
+                test_utils::get_random_data<size_t>(5, 0, size - 1, seed_value);
+            ranks.insert(ranks.end(), random_ranks.begin(), random_ranks.end());
+            const unsigned int ranks_count = ranks.size();
+
+            key_type * d_keys_input;
+            size_t * d_ranks;
+            key_type * d_output;
+            HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(hipMalloc(&d_ranks, ranks_count * sizeof(size_t)));
+            HIP_CHECK(hipMalloc(&d_output, ranks_count * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(
+                hipMemcpy(
+                    d_ranks, ranks.data(),
+                    ranks_count * sizeof(size_t),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<key_type> sorted(keys_input);
+            std::sort(sorted.begin(), sorted.end());
+            std::vector<key_type> expected(ranks_count);
+            for(size_t i = 0; i < ranks_count; i++)
+            {
+                expected[i] = sorted[ranks[i]];
+            }
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(
+                rp::select_quantiles<config>(
+                    nullptr, temporary_storage_bytes,
+                    d_keys_input, d_ranks, d_output, size, ranks_count
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rp::select_quantiles<config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_keys_input, d_ranks, d_output, size, ranks_count,
+                    stream, debug_synchronous
+                )
+            );
+
+            std::vector<key_type> output(ranks_count);
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    ranks_count * sizeof(key_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_ranks));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
@@ -472,3 +472,528 @@ TYPED_TEST(RocprimDevicePartitionTests, Predicate)
     }
     
 }
+
+TYPED_TEST(RocprimDevicePartitionTests, ThreeWay)
+{
+    using O = typename TestFixture::input_type;
+    using T = typename std::conditional<std::is_same<O, rocprim::half>::value, int, O>::type;
+    using U = typename TestFixture::output_type;
+    static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+
+    auto select_first_part_op = [] __host__ __device__ (const T& value) -> bool
+    {
+        return value < T(30);
+    };
+    auto select_second_part_op = [] __host__ __device__ (const T& value) -> bool
+    {
+        return value < T(70);
+    };
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(auto size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T * d_input;
+            U * d_first_output;
+            U * d_second_output;
+            U * d_unselected_output;
+            unsigned int * d_selected_count_output;
+            HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_first_output, input.size() * sizeof(U)));
+            HIP_CHECK(hipMalloc(&d_second_output, input.size() * sizeof(U)));
+            HIP_CHECK(hipMalloc(&d_unselected_output, input.size() * sizeof(U)));
+            HIP_CHECK(hipMalloc(&d_selected_count_output, 2 * sizeof(unsigned int)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Calculate expected results on host
+            std::vector<U> expected_first;
+            std::vector<U> expected_second;
+            std::vector<U> expected_unselected;
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(select_first_part_op(input[i]))
+                {
+                    expected_first.push_back(input[i]);
+                }
+                else if(select_second_part_op(input[i]))
+                {
+                    expected_second.push_back(input[i]);
+                }
+                else
+                {
+                    expected_unselected.push_back(input[i]);
+                }
+            }
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::partition_three_way(
+                    nullptr,
+                    temp_storage_size_bytes,
+                    d_input,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_first_output),
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_second_output),
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_unselected_output),
+                    d_selected_count_output,
+                    input.size(),
+                    select_first_part_op,
+                    select_second_part_op,
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            void * d_temp_storage = nullptr;
+            HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Run
+            HIP_CHECK(
+                rocprim::partition_three_way(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_input,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_first_output),
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_second_output),
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_unselected_output),
+                    d_selected_count_output,
+                    input.size(),
+                    select_first_part_op,
+                    select_second_part_op,
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if numbers of values in parts are as expected
+            unsigned int selected_count_output[2] = { 0, 0 };
+            HIP_CHECK(
+                hipMemcpy(
+                    selected_count_output, d_selected_count_output,
+                    2 * sizeof(unsigned int),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+            ASSERT_EQ(selected_count_output[0], expected_first.size());
+            ASSERT_EQ(selected_count_output[1], expected_second.size());
+
+            // Check if output values are as expected
+            std::vector<U> first_output(input.size());
+            std::vector<U> second_output(input.size());
+            std::vector<U> unselected_output(input.size());
+            HIP_CHECK(hipMemcpy(first_output.data(), d_first_output, input.size() * sizeof(U), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(second_output.data(), d_second_output, input.size() * sizeof(U), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(unselected_output.data(), d_unselected_output, input.size() * sizeof(U), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::custom_assert_eq(first_output, expected_first, expected_first.size()));
+            ASSERT_NO_FATAL_FAILURE(test_utils::custom_assert_eq(second_output, expected_second, expected_second.size()));
+            ASSERT_NO_FATAL_FAILURE(test_utils::custom_assert_eq(unselected_output, expected_unselected, expected_unselected.size()));
+
+            hipFree(d_input);
+            hipFree(d_first_output);
+            hipFree(d_second_output);
+            hipFree(d_unselected_output);
+            hipFree(d_selected_count_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
+
+TYPED_TEST(RocprimDevicePartitionTests, Multi)
+{
+    using O = typename TestFixture::input_type;
+    using T = typename std::conditional<std::is_same<O, rocprim::half>::value, int, O>::type;
+    using U = typename TestFixture::output_type;
+    static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    constexpr unsigned int buckets = 5;
+
+    hipStream_t stream = 0; // default stream
+
+    // Bucket 3 is always empty, out-of-range buckets are clamped to the last bucket
+    auto bucket_op = [] __host__ __device__ (const T& value) -> unsigned int
+    {
+        if(value < T(5)) return buckets + 2;
+        if(value < T(10)) return 4;
+        if(value < T(40)) return 0;
+        if(value < T(50)) return 2;
+        return 1;
+    };
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(auto size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T * d_input;
+            U * d_output;
+            unsigned int * d_bucket_counts_output;
+            HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_output, input.size() * sizeof(U)));
+            HIP_CHECK(hipMalloc(&d_bucket_counts_output, buckets * sizeof(unsigned int)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Calculate expected results on host (stable partition by buckets)
+            std::vector<U> expected;
+            std::vector<unsigned int> expected_counts(buckets, 0);
+            expected.reserve(input.size());
+            for(unsigned int bucket = 0; bucket < buckets; bucket++)
+            {
+                for(size_t i = 0; i < input.size(); i++)
+                {
+                    if(std::min(bucket_op(input[i]), buckets - 1) == bucket)
+                    {
+                        expected.push_back(input[i]);
+                        expected_counts[bucket]++;
+                    }
+                }
+            }
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::partition_multi<buckets>(
+                    nullptr,
+                    temp_storage_size_bytes,
+                    d_input,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
+                    d_bucket_counts_output,
+                    input.size(),
+                    bucket_op,
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            void * d_temp_storage = nullptr;
+            HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Run
+            HIP_CHECK(
+                rocprim::partition_multi<buckets>(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_input,
+                    test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
+                    d_bucket_counts_output,
+                    input.size(),
+                    bucket_op,
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if numbers of values in buckets are as expected
+            std::vector<unsigned int> bucket_counts_output(buckets);
+            HIP_CHECK(
+                hipMemcpy(
+                    bucket_counts_output.data(), d_bucket_counts_output,
+                    buckets * sizeof(unsigned int),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+            ASSERT_EQ(bucket_counts_output, expected_counts);
+
+            // Check if output values are as expected
+            std::vector<U> output(input.size());
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    output.size() * sizeof(U),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+            ASSERT_NO_FATAL_FAILURE(test_utils::custom_assert_eq(output, expected, expected.size()));
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_bucket_counts_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
+
+// 64-bit offsets and counts are used for partition_multi and partition_three_way
+// with offset_type of select_config
+using partition_64bit_offsets_config = rocprim::select_config<
+    128, 4,
+    rocprim::block_load_method::block_load_transpose,
+    rocprim::block_load_method::block_load_transpose,
+    rocprim::block_scan_algorithm::using_warp_scan,
+    size_t
+>;
+
+TEST(RocprimDevicePartition64BitOffsetsTests, ThreeWay)
+{
+    using T = int;
+    using config = partition_64bit_offsets_config;
+    const bool debug_synchronous = false;
+
+    hipStream_t stream = 0; // default stream
+
+    auto select_first_part_op = [] __host__ __device__ (const T& value) -> bool
+    {
+        return value < T(30);
+    };
+    auto select_second_part_op = [] __host__ __device__ (const T& value) -> bool
+    {
+        return value < T(70);
+    };
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(auto size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T * d_input;
+            T * d_output;
+            size_t * d_selected_count_output;
+            HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_output, 3 * input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_selected_count_output, 2 * sizeof(size_t)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            std::vector<T> expected_first;
+            std::vector<T> expected_second;
+            std::vector<T> expected_unselected;
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(select_first_part_op(input[i]))
+                {
+                    expected_first.push_back(input[i]);
+                }
+                else if(select_second_part_op(input[i]))
+                {
+                    expected_second.push_back(input[i]);
+                }
+                else
+                {
+                    expected_unselected.push_back(input[i]);
+                }
+            }
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(
+                rocprim::partition_three_way<config>(
+                    nullptr, temp_storage_size_bytes,
+                    d_input, d_output, d_output + size, d_output + 2 * size,
+                    d_selected_count_output, input.size(),
+                    select_first_part_op, select_second_part_op,
+                    stream, debug_synchronous
+                )
+            );
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void * d_temp_storage = nullptr;
+            HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(
+                rocprim::partition_three_way<config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input, d_output, d_output + size, d_output + 2 * size,
+                    d_selected_count_output, input.size(),
+                    select_first_part_op, select_second_part_op,
+                    stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            size_t selected_count_output[2] = { 0, 0 };
+            HIP_CHECK(
+                hipMemcpy(
+                    selected_count_output, d_selected_count_output,
+                    2 * sizeof(size_t),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            ASSERT_EQ(selected_count_output[0], expected_first.size());
+            ASSERT_EQ(selected_count_output[1], expected_second.size());
+
+            std::vector<T> output(3 * input.size());
+            HIP_CHECK(hipMemcpy(output.data(), d_output, output.size() * sizeof(T), hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < expected_first.size(); i++)
+            {
+                ASSERT_EQ(output[i], expected_first[i]) << "where index = " << i;
+            }
+            for(size_t i = 0; i < expected_second.size(); i++)
+            {
+                ASSERT_EQ(output[size + i], expected_second[i]) << "where index = " << i;
+            }
+            for(size_t i = 0; i < expected_unselected.size(); i++)
+            {
+                ASSERT_EQ(output[2 * size + i], expected_unselected[i]) << "where index = " << i;
+            }
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_selected_count_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
+
+TEST(RocprimDevicePartition64BitOffsetsTests, Multi)
+{
+    using T = int;
+    using config = partition_64bit_offsets_config;
+    const bool debug_synchronous = false;
+
+    constexpr unsigned int buckets = 4;
+
+    hipStream_t stream = 0; // default stream
+
+    auto bucket_op = [] __host__ __device__ (const T& value) -> unsigned int
+    {
+        return static_cast<unsigned int>(value) % buckets;
+    };
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(auto size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T * d_input;
+            T * d_output;
+            size_t * d_bucket_counts_output;
+            HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_output, input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_bucket_counts_output, buckets * sizeof(size_t)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            std::vector<T> expected;
+            std::vector<size_t> expected_counts(buckets, 0);
+            expected.reserve(input.size());
+            for(unsigned int bucket = 0; bucket < buckets; bucket++)
+            {
+                for(size_t i = 0; i < input.size(); i++)
+                {
+                    if(bucket_op(input[i]) == bucket)
+                    {
+                        expected.push_back(input[i]);
+                        expected_counts[bucket]++;
+                    }
+                }
+            }
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(
+                rocprim::partition_multi<buckets, config>(
+                    nullptr, temp_storage_size_bytes,
+                    d_input, d_output, d_bucket_counts_output, input.size(),
+                    bucket_op, stream, debug_synchronous
+                )
+            );
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void * d_temp_storage = nullptr;
+            HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(
+                rocprim::partition_multi<buckets, config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input, d_output, d_bucket_counts_output, input.size(),
+                    bucket_op, stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<size_t> bucket_counts_output(buckets);
+            HIP_CHECK(
+                hipMemcpy(
+                    bucket_counts_output.data(), d_bucket_counts_output,
+                    buckets * sizeof(size_t),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            ASSERT_EQ(bucket_counts_output, expected_counts);
+
+            std::vector<T> output(input.size());
+            HIP_CHECK(hipMemcpy(output.data(), d_output, output.size() * sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::custom_assert_eq(output, expected, expected.size()));
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_bucket_counts_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
@@ -453,6 +453,319 @@ TYPED_TEST(RocprimDeviceRadixSort, SortPairs)
     
 }
 
+TYPED_TEST(RocprimDeviceRadixSort, SortPairsOnesweep)
+{
+    using key_type = typename TestFixture::params::key_type;
+    using value_type = typename TestFixture::params::value_type;
+    constexpr bool descending = TestFixture::params::descending;
+    constexpr unsigned int start_bit = TestFixture::params::start_bit;
+    constexpr unsigned int end_bit = TestFixture::params::end_bit;
+    constexpr bool check_huge_sizes = TestFixture::params::check_huge_sizes;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    bool in_place = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value); 
+
+        for(size_t size : get_sizes(seed_value))
+        {
+            if(size > (1 << 20) && !check_huge_sizes) continue;
+
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            in_place = !in_place;
+
+            // Generate data
+            std::vector<key_type> keys_input;
+            if(rp::is_floating_point<key_type>::value)
+            {
+                keys_input = test_utils::get_random_data<key_type>(size, (key_type)-1000, (key_type)+1000, seed_value);
+            }
+            else
+            {
+                keys_input = test_utils::get_random_data<key_type>(
+                    size,
+                    std::numeric_limits<key_type>::min(),
+                    std::numeric_limits<key_type>::max(), 
+                    seed_index
+                );
+            }
+
+            std::vector<value_type> values_input(size);
+            std::iota(values_input.begin(), values_input.end(), 0);
+
+            key_type * d_keys_input;
+            key_type * d_keys_output;
+            HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+            if(in_place)
+            {
+                d_keys_output = d_keys_input;
+            }
+            else
+            {
+                HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+            }
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            value_type * d_values_input;
+            value_type * d_values_output;
+            HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
+            if(in_place)
+            {
+                d_values_output = d_values_input;
+            }
+            else
+            {
+                HIP_CHECK(hipMalloc(&d_values_output, size * sizeof(value_type)));
+            }
+            HIP_CHECK(
+                hipMemcpy(
+                    d_values_input, values_input.data(),
+                    size * sizeof(value_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            using key_value = std::pair<key_type, value_type>;
+
+            // Calculate expected results on host
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            std::stable_sort(
+                expected.begin(), expected.end(),
+                key_value_comparator<key_type, value_type, descending, start_bit, end_bit>()
+            );
+            std::vector<key_type> keys_expected(size);
+            std::vector<value_type> values_expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                keys_expected[i] = expected[i].first;
+                values_expected[i] = expected[i].second;
+            }
+
+            // Use onesweep algorithm
+            using config = rp::radix_sort_config<
+                8, 8, rp::kernel_config<256, 2>, rp::kernel_config<256, 8>, true
+            >;
+
+            void * d_temporary_storage = nullptr;
+            size_t temporary_storage_bytes;
+            HIP_CHECK(
+                rp::radix_sort_pairs<config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_keys_input, d_keys_output, d_values_input, d_values_output, size,
+                    start_bit, end_bit
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            if(descending)
+            {
+                HIP_CHECK(
+                    rp::radix_sort_pairs_desc<config>(
+                        d_temporary_storage, temporary_storage_bytes,
+                        d_keys_input, d_keys_output, d_values_input, d_values_output, size,
+                        start_bit, end_bit,
+                        stream, debug_synchronous
+                    )
+                );
+            }
+            else
+            {
+                HIP_CHECK(
+                    rp::radix_sort_pairs<config>(
+                        d_temporary_storage, temporary_storage_bytes,
+                        d_keys_input, d_keys_output, d_values_input, d_values_output, size,
+                        start_bit, end_bit,
+                        stream, debug_synchronous
+                    )
+                );
+            }
+
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    keys_output.data(), d_keys_output,
+                    size * sizeof(key_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    values_output.data(), d_values_output,
+                    size * sizeof(value_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_values_input));
+            if(!in_place)
+            {
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_output));
+            }
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+        }
+    }
+    
+}
+
+TYPED_TEST(RocprimDeviceRadixSort, SortKeysOnesweep)
+{
+    using key_type = typename TestFixture::params::key_type;
+    constexpr bool descending = TestFixture::params::descending;
+    constexpr unsigned int start_bit = TestFixture::params::start_bit;
+    constexpr unsigned int end_bit = TestFixture::params::end_bit;
+    constexpr bool check_huge_sizes = TestFixture::params::check_huge_sizes;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    bool in_place = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value); 
+
+        for(size_t size : get_sizes(seed_value))
+        {
+            if(size > (1 << 20) && !check_huge_sizes) continue;
+
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            in_place = !in_place;
+
+            // Generate data
+            std::vector<key_type> keys_input;
+            if(rp::is_floating_point<key_type>::value)
+            {
+                keys_input = test_utils::get_random_data<key_type>(size, (key_type)-1000, (key_type)+1000, seed_value);
+            }
+            else
+            {
+                keys_input = test_utils::get_random_data<key_type>(
+                    size,
+                    std::numeric_limits<key_type>::min(),
+                    std::numeric_limits<key_type>::max(), 
+                    seed_index
+                );
+            }
+
+            key_type * d_keys_input;
+            key_type * d_keys_output;
+            HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+            if(in_place)
+            {
+                d_keys_output = d_keys_input;
+            }
+            else
+            {
+                HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+            }
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<key_type> expected(keys_input);
+            std::stable_sort(expected.begin(), expected.end(), key_comparator<key_type, descending, start_bit, end_bit>());
+
+            // Use onesweep algorithm
+            using config = rp::radix_sort_config<
+                8, 8, rp::kernel_config<256, 2>, rp::kernel_config<256, 8>, true
+            >;
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(
+                rp::radix_sort_keys<config>(
+                    nullptr, temporary_storage_bytes,
+                    d_keys_input, d_keys_output, size,
+                    start_bit, end_bit
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            if(descending)
+            {
+                HIP_CHECK(
+                    rp::radix_sort_keys_desc<config>(
+                        d_temporary_storage, temporary_storage_bytes,
+                        d_keys_input, d_keys_output, size,
+                        start_bit, end_bit,
+                        stream, debug_synchronous
+                    )
+                );
+            }
+            else
+            {
+                HIP_CHECK(
+                    rp::radix_sort_keys<config>(
+                        d_temporary_storage, temporary_storage_bytes,
+                        d_keys_input, d_keys_output, size,
+                        start_bit, end_bit,
+                        stream, debug_synchronous
+                    )
+                );
+            }
+
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    keys_output.data(), d_keys_output,
+                    size * sizeof(key_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            if(!in_place)
+            {
+                HIP_CHECK(hipFree(d_keys_output));
+            }
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected));
+        }  
+    }
+    
+}
+
 TYPED_TEST(RocprimDeviceRadixSort, SortKeysDoubleBuffer)
 {
     using key_type = typename TestFixture::params::key_type;
@@ -727,3 +1040,444 @@ TYPED_TEST(RocprimDeviceRadixSort, SortPairsDoubleBuffer)
     }
     
 }
+
+struct large_size_key_op
+{
+    ROCPRIM_HOST_DEVICE
+    unsigned char operator()(size_t i) const
+    {
+        return static_cast<unsigned char>(i % 251);
+    }
+};
+
+TEST(RocprimDeviceRadixSortLargeSizes, SortKeys)
+{
+    using key_type = unsigned char;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    // More elements than can be indexed with 32-bit offsets
+    const size_t size = (size_t(1) << 32) + 12345;
+
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t device_properties;
+    HIP_CHECK(hipGetDeviceProperties(&device_properties, device_id));
+    // Output keys and temporary keys are stored on device
+    if(device_properties.totalGlobalMem < size * sizeof(key_type) * 3)
+    {
+        std::cout << "[ SKIPPED  ] Not enough device memory" << std::endl;
+        return;
+    }
+
+    // Keys are generated on the fly: key of the i-th element is (i % 251)
+    rp::transform_iterator<rp::counting_iterator<size_t>, large_size_key_op, key_type> d_keys_input(
+        rp::counting_iterator<size_t>(0), large_size_key_op()
+    );
+
+    key_type * d_keys_output;
+    HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(
+        rp::radix_sort_keys(
+            nullptr, temporary_storage_bytes,
+            d_keys_input, d_keys_output, size,
+            0, 8 * sizeof(key_type),
+            stream, debug_synchronous
+        )
+    );
+
+    ASSERT_GT(temporary_storage_bytes, 0U);
+
+    void * d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(
+        rp::radix_sort_keys(
+            d_temporary_storage, temporary_storage_bytes,
+            d_keys_input, d_keys_output, size,
+            0, 8 * sizeof(key_type),
+            stream, debug_synchronous
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+
+    // The output must consist of runs of equal keys in ascending order,
+    // key k appears (size / 251 + (k < size % 251)) times
+    size_t expected_key = 0;
+    size_t expected_count = size / 251 + (0 < size % 251 ? 1 : 0);
+    const size_t check_size = size_t(1) << 28;
+    std::vector<key_type> keys_output(check_size);
+    for(size_t offset = 0; offset < size; offset += check_size)
+    {
+        const size_t current_size = std::min(check_size, size - offset);
+        HIP_CHECK(
+            hipMemcpy(
+                keys_output.data(), d_keys_output + offset,
+                current_size * sizeof(key_type),
+                hipMemcpyDeviceToHost
+            )
+        );
+        for(size_t i = 0; i < current_size; i++)
+        {
+            while(expected_count == 0)
+            {
+                expected_key++;
+                expected_count = size / 251 + (expected_key < size % 251 ? 1 : 0);
+            }
+            ASSERT_EQ(keys_output[i], expected_key) << "where index = " << (offset + i);
+            expected_count--;
+        }
+    }
+    ASSERT_EQ(expected_key, 250U);
+    ASSERT_EQ(expected_count, 0U);
+
+    HIP_CHECK(hipFree(d_keys_output));
+}
+
+// Custom config with only members of the original radix_sort_config,
+// the iterative algorithm is used
+struct custom_radix_sort_config
+{
+    static constexpr unsigned int long_radix_bits = 7;
+    static constexpr unsigned int short_radix_bits = 6;
+    using scan = rp::kernel_config<256, 2>;
+    using sort = rp::kernel_config<256, 7>;
+};
+
+TEST(RocprimDeviceRadixSortCustomConfig, SortKeys)
+{
+    using key_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : get_sizes(seed_value))
+        {
+            if(size > (1 << 20)) continue;
+
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input = test_utils::get_random_data<key_type>(
+                size,
+                std::numeric_limits<key_type>::min(),
+                std::numeric_limits<key_type>::max(),
+                seed_value
+            );
+
+            key_type * d_keys_input;
+            key_type * d_keys_output;
+            HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            std::vector<key_type> expected(keys_input);
+            std::sort(expected.begin(), expected.end());
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(
+                rp::radix_sort_keys<custom_radix_sort_config>(
+                    nullptr, temporary_storage_bytes,
+                    d_keys_input, d_keys_output, size
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rp::radix_sort_keys<custom_radix_sort_config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_keys_input, d_keys_output, size,
+                    0, 8 * sizeof(key_type),
+                    stream, debug_synchronous
+                )
+            );
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    keys_output.data(), d_keys_output,
+                    size * sizeof(key_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected));
+        }
+    }
+}
+
+struct tenant_event
+{
+    unsigned int tenant_id;
+    long long timestamp;
+
+    bool operator<(const tenant_event& other) const
+    {
+        return tenant_id < other.tenant_id || (tenant_id == other.tenant_id && timestamp < other.timestamp);
+    }
+
+    bool operator==(const tenant_event& other) const
+    {
+        return tenant_id == other.tenant_id && timestamp == other.timestamp;
+    }
+};
+
+namespace rocprim
+{
+
+template<>
+struct radix_key_decomposer<tenant_event>
+{
+    using tuple_type = ::rocprim::tuple<unsigned int, long long>;
+
+    ROCPRIM_HOST_DEVICE
+    static tuple_type decompose(const tenant_event& key)
+    {
+        return tuple_type(key.tenant_id, key.timestamp);
+    }
+
+    ROCPRIM_HOST_DEVICE
+    static tenant_event compose(const tuple_type& t)
+    {
+        return tenant_event { ::rocprim::get<0>(t), ::rocprim::get<1>(t) };
+    }
+};
+
+} // end namespace rocprim
+
+// Keys have many duplicates in the first fields, so the following fields affect the order
+template<class Key>
+struct composite_key_generator;
+
+template<>
+struct composite_key_generator<rp::tuple<int, short>>
+{
+    rp::tuple<int, short> operator()(std::default_random_engine& gen) const
+    {
+        return rp::tuple<int, short>(
+            std::uniform_int_distribution<int>(-10, 10)(gen),
+            static_cast<short>(std::uniform_int_distribution<int>(-1000, 1000)(gen))
+        );
+    }
+};
+
+template<>
+struct composite_key_generator<rp::tuple<float, unsigned char, unsigned long long>>
+{
+    rp::tuple<float, unsigned char, unsigned long long> operator()(std::default_random_engine& gen) const
+    {
+        return rp::tuple<float, unsigned char, unsigned long long>(
+            std::uniform_int_distribution<int>(-8, 8)(gen) * 0.25f,
+            static_cast<unsigned char>(std::uniform_int_distribution<int>(0, 3)(gen)),
+            std::uniform_int_distribution<unsigned long long>()(gen)
+        );
+    }
+};
+
+template<>
+struct composite_key_generator<tenant_event>
+{
+    tenant_event operator()(std::default_random_engine& gen) const
+    {
+        return tenant_event {
+            std::uniform_int_distribution<unsigned int>(0, 100)(gen),
+            std::uniform_int_distribution<long long>(-100000, 100000)(gen)
+        };
+    }
+};
+
+#ifdef __SIZEOF_INT128__
+template<>
+struct composite_key_generator<__int128>
+{
+    __int128 operator()(std::default_random_engine& gen) const
+    {
+        const __int128 high = std::uniform_int_distribution<long long>(-100, 100)(gen);
+        return high * (__int128(1) << 64) + std::uniform_int_distribution<unsigned long long>()(gen);
+    }
+};
+#endif
+
+template<class Key>
+class RocprimDeviceRadixSortCompositeKeys : public ::testing::Test {
+public:
+    using key_type = Key;
+};
+
+typedef ::testing::Types<
+    rp::tuple<int, short>
+#ifdef __SIZEOF_INT128__
+    // Radix keys with more than 64 bits
+    , rp::tuple<float, unsigned char, unsigned long long>
+    , tenant_event
+    , __int128
+#endif
+> CompositeKeys;
+
+TYPED_TEST_CASE(RocprimDeviceRadixSortCompositeKeys, CompositeKeys);
+
+TYPED_TEST(RocprimDeviceRadixSortCompositeKeys, SortPairs)
+{
+    using key_type = typename TestFixture::key_type;
+    using value_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(bool descending : { false, true })
+            {
+                SCOPED_TRACE(testing::Message() << "with descending = " << descending);
+
+                // Generate data
+                std::default_random_engine gen(seed_value);
+                std::vector<key_type> keys_input(size);
+                std::generate(keys_input.begin(), keys_input.end(), [&]() { return composite_key_generator<key_type>()(gen); });
+
+                std::vector<value_type> values_input(size);
+                std::iota(values_input.begin(), values_input.end(), 0);
+
+                key_type * d_keys_input;
+                key_type * d_keys_output;
+                HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+                HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_keys_input, keys_input.data(),
+                        size * sizeof(key_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+
+                value_type * d_values_input;
+                value_type * d_values_output;
+                HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
+                HIP_CHECK(hipMalloc(&d_values_output, size * sizeof(value_type)));
+                HIP_CHECK(
+                    hipMemcpy(
+                        d_values_input, values_input.data(),
+                        size * sizeof(value_type),
+                        hipMemcpyHostToDevice
+                    )
+                );
+
+                // Calculate expected results on host: lexicographic order of fields,
+                // values are indices of keys, so stability is checked too
+                std::vector<value_type> values_expected(values_input);
+                std::stable_sort(
+                    values_expected.begin(), values_expected.end(),
+                    [&](value_type l, value_type r)
+                    {
+                        return descending ? (keys_input[r] < keys_input[l]) : (keys_input[l] < keys_input[r]);
+                    }
+                );
+                std::vector<key_type> keys_expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    keys_expected[i] = keys_input[values_expected[i]];
+                }
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(
+                    rp::radix_sort_pairs(
+                        nullptr, temporary_storage_bytes,
+                        d_keys_input, d_keys_output, d_values_input, d_values_output, size
+                    )
+                );
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void * d_temporary_storage;
+                HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+                if(descending)
+                {
+                    HIP_CHECK(
+                        rp::radix_sort_pairs_desc(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, d_values_input, d_values_output, size,
+                            0, 8 * sizeof(key_type),
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+                else
+                {
+                    HIP_CHECK(
+                        rp::radix_sort_pairs(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, d_values_input, d_values_output, size,
+                            0, 8 * sizeof(key_type),
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+
+                std::vector<key_type> keys_output(size);
+                HIP_CHECK(
+                    hipMemcpy(
+                        keys_output.data(), d_keys_output,
+                        size * sizeof(key_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(
+                    hipMemcpy(
+                        values_output.data(), d_values_output,
+                        size * sizeof(value_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_values_output));
+
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_TRUE(keys_output[i] == keys_expected[i]) << "where index = " << i;
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+            }
+        }
+    }
+}
@@ -23,6 +23,9 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstring>
 
 // Google Test
 #include <gtest/gtest.h>
@@ -43,7 +46,8 @@ namespace rp = rocprim;
 template<
     class InputType,
     class OutputType = InputType,
-    bool UseIdentityIterator = false
+    bool UseIdentityIterator = false,
+    class Config = rp::default_config
 >
 struct DeviceReduceParams
 {
@@ -51,6 +55,7 @@ struct DeviceReduceParams
     using output_type = OutputType;
     // Tests output iterator with void value_type (OutputIterator concept)
     static constexpr bool use_identity_iterator =  UseIdentityIterator;
+    using config = Config;
 };
 
 // ---------------------------------------------------------
@@ -65,6 +70,20 @@ public:
     using output_type = typename Params::output_type;
     const bool debug_synchronous = false;
     static constexpr bool use_identity_iterator = Params::use_identity_iterator;
+    using config = typename Params::config;
+};
+
+// Reduction of partial results by nested launches
+using multi_launch_config = rp::reduce_config<256, 8, rp::block_reduce_algorithm::using_warp_reduce, 0>;
+// Single launch, every block reduces many small tiles
+using grid_stride_config = rp::reduce_config<64, 3, rp::block_reduce_algorithm::raking_reduce, 1>;
+// Custom config without persistent_blocks_per_cu
+struct custom_reduce_config
+{
+    static constexpr unsigned int block_size = 128;
+    static constexpr unsigned int items_per_thread = 4;
+    static constexpr rp::block_reduce_algorithm block_reduce_method =
+        rp::block_reduce_algorithm::using_warp_reduce;
 };
 
 typedef ::testing::Types<
@@ -76,7 +95,12 @@ typedef ::testing::Types<
     DeviceReduceParams<uint8_t, uint8_t>,
     DeviceReduceParams<rp::half, rp::half>,
     DeviceReduceParams<test_utils::custom_test_type<float>, test_utils::custom_test_type<float>>,
-    DeviceReduceParams<test_utils::custom_test_type<int>, test_utils::custom_test_type<float>>
+    DeviceReduceParams<test_utils::custom_test_type<int>, test_utils::custom_test_type<float>>,
+    DeviceReduceParams<int, int, false, multi_launch_config>,
+    DeviceReduceParams<double, double, true, multi_launch_config>,
+    DeviceReduceParams<int, long long, false, grid_stride_config>,
+    DeviceReduceParams<float, float, true, grid_stride_config>,
+    DeviceReduceParams<int, int, false, custom_reduce_config>
 > RocprimDeviceReduceTestsParams;
 
 std::vector<size_t> get_sizes(int seed_value)
@@ -97,6 +121,7 @@ TYPED_TEST_CASE(RocprimDeviceReduceTests, RocprimDeviceReduceTestsParams);
 TYPED_TEST(RocprimDeviceReduceTests, ReduceEmptyInput)
 {
     using T = typename TestFixture::input_type;
+    using config = typename TestFixture::config;
     using U = typename TestFixture::output_type;
     const bool debug_synchronous = TestFixture::debug_synchronous;
 
@@ -110,7 +135,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceEmptyInput)
     size_t temp_storage_size_bytes;
     // Get size of d_temp_storage
     HIP_CHECK(
-        rocprim::reduce(
+        rocprim::reduce<config>(
             nullptr, temp_storage_size_bytes,
             rocprim::make_constant_iterator<T>(T(345)),
             d_output,
@@ -124,7 +149,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceEmptyInput)
 
     // Run
     HIP_CHECK(
-        rocprim::reduce(
+        rocprim::reduce<config>(
             d_temp_storage, temp_storage_size_bytes,
             rocprim::make_constant_iterator<T>(T(345)),
             d_output,
@@ -151,6 +176,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceEmptyInput)
 TYPED_TEST(RocprimDeviceReduceTests, Reduce)
 {
     using T = typename TestFixture::input_type;
+    using config = typename TestFixture::config;
     using U = typename TestFixture::output_type;
     using binary_op_type = typename std::conditional<std::is_same<U, rp::half>::value, test_utils::half_plus, rp::plus<U>>::type;
     const bool debug_synchronous = TestFixture::debug_synchronous;
@@ -206,7 +232,7 @@ TYPED_TEST(RocprimDeviceReduceTests, Reduce)
             void * d_temp_storage = nullptr;
             // Get size of d_temp_storage
             HIP_CHECK(
-                rocprim::reduce(
+                rocprim::reduce<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input,
                     test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
@@ -223,7 +249,7 @@ TYPED_TEST(RocprimDeviceReduceTests, Reduce)
 
             // Run
             HIP_CHECK(
-                rocprim::reduce(
+                rocprim::reduce<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input,
                     test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
@@ -257,6 +283,7 @@ TYPED_TEST(RocprimDeviceReduceTests, Reduce)
 TYPED_TEST(RocprimDeviceReduceTests, ReduceMinimum)
 {
     using T = typename TestFixture::input_type;
+    using config = typename TestFixture::config;
     using U = typename TestFixture::output_type;
     using binary_op_type = typename std::conditional<std::is_same<U, rp::half>::value, test_utils::half_minimum, rp::minimum<U>>::type;
     const bool debug_synchronous = TestFixture::debug_synchronous;
@@ -306,7 +333,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceMinimum)
             void * d_temp_storage = nullptr;
             // Get size of d_temp_storage
             HIP_CHECK(
-                rocprim::reduce(
+                rocprim::reduce<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input,
                     test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
@@ -323,7 +350,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceMinimum)
 
             // Run
             HIP_CHECK(
-                rocprim::reduce(
+                rocprim::reduce<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input,
                     test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
@@ -389,6 +416,7 @@ struct arg_min<int, rp::half>
 TYPED_TEST(RocprimDeviceReduceTests, ReduceArgMinimum)
 {
     using T = typename TestFixture::input_type;
+    using config = typename TestFixture::config;
     using key_value = rocprim::key_value_pair<int, T>;
     const bool debug_synchronous = TestFixture::debug_synchronous;
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
@@ -442,7 +470,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceArgMinimum)
             void * d_temp_storage = nullptr;
             // Get size of d_temp_storage
             HIP_CHECK(
-                rocprim::reduce(
+                rocprim::reduce<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input,
                     test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
@@ -459,7 +487,7 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceArgMinimum)
 
             // Run
             HIP_CHECK(
-                rocprim::reduce(
+                rocprim::reduce<config>(
                     d_temp_storage, temp_storage_size_bytes,
                     d_input,
                     test_utils::wrap_in_identity_iterator<use_identity_iterator>(d_output),
@@ -490,3 +518,319 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceArgMinimum)
     }
     
 }
+
+// ---------------------------------------------------------
+// Test for multi_reduce (several reductions in one pass)
+// ---------------------------------------------------------
+
+template<
+    class InputType,
+    class SumType,
+    class Config = rp::default_config
+>
+struct DeviceMultiReduceParams
+{
+    using input_type = InputType;
+    using sum_type = SumType;
+    using config = Config;
+};
+
+template<class Params>
+class RocprimDeviceMultiReduceTests : public ::testing::Test
+{
+public:
+    using input_type = typename Params::input_type;
+    using sum_type = typename Params::sum_type;
+    using config = typename Params::config;
+    const bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<
+    DeviceMultiReduceParams<int, long long>,
+    DeviceMultiReduceParams<unsigned char, unsigned int>,
+    DeviceMultiReduceParams<short, double>,
+    DeviceMultiReduceParams<double, double>,
+    DeviceMultiReduceParams<int, int, multi_launch_config>,
+    DeviceMultiReduceParams<unsigned short, long long, grid_stride_config>
+> RocprimDeviceMultiReduceTestsParams;
+
+TYPED_TEST_CASE(RocprimDeviceMultiReduceTests, RocprimDeviceMultiReduceTestsParams);
+
+TYPED_TEST(RocprimDeviceMultiReduceTests, MultiReduce)
+{
+    using T = typename TestFixture::input_type;
+    using S = typename TestFixture::sum_type;
+    using config = typename TestFixture::config;
+    using result_type = rp::tuple<S, T, T>;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::vector<size_t> sizes = get_sizes(seed_value);
+        sizes.insert(sizes.begin(), 0);
+        for(auto size : sizes)
+        {
+            hipStream_t stream = 0; // default
+
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T * d_input;
+            result_type * d_output;
+            HIP_CHECK(hipMalloc(&d_input, std::max<size_t>(input.size(), 1) * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_output, sizeof(result_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            const auto initial_values = rp::make_tuple(
+                S(10), std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest()
+            );
+            const auto reduce_ops = rp::make_tuple(
+                rp::plus<S>(), rp::minimum<T>(), rp::maximum<T>()
+            );
+
+            // Calculate expected results on host
+            S expected_sum = rp::get<0>(initial_values);
+            T expected_min = rp::get<1>(initial_values);
+            T expected_max = rp::get<2>(initial_values);
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                expected_sum = expected_sum + S(input[i]);
+                expected_min = std::min(expected_min, input[i]);
+                expected_max = std::max(expected_max, input[i]);
+            }
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            void * d_temp_storage = nullptr;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::multi_reduce<config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input, d_output,
+                    initial_values, input.size(), reduce_ops,
+                    stream, debug_synchronous
+                )
+            );
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Run
+            HIP_CHECK(
+                rocprim::multi_reduce<config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input, d_output,
+                    initial_values, input.size(), reduce_ops,
+                    stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipPeekAtLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Copy output to host
+            result_type output;
+            HIP_CHECK(
+                hipMemcpy(
+                    &output, d_output,
+                    sizeof(result_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if output values are as expected
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_near(rp::get<0>(output), expected_sum, 0.01f));
+            ASSERT_EQ(rp::get<1>(output), expected_min);
+            ASSERT_EQ(rp::get<2>(output), expected_max);
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// Test for deterministic_reduce
+// ---------------------------------------------------------
+
+template<class T>
+class RocprimDeviceDeterministicReduceTests : public ::testing::Test
+{
+public:
+    using input_type = T;
+    const bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<float, double> RocprimDeviceDeterministicReduceTestsParams;
+
+TYPED_TEST_CASE(RocprimDeviceDeterministicReduceTests, RocprimDeviceDeterministicReduceTestsParams);
+
+template<class Config, class T>
+void deterministic_reduce_with_config(T * d_input, size_t size, T initial_value, T& output)
+{
+    hipStream_t stream = 0; // default
+    const bool debug_synchronous = false;
+
+    T * d_output;
+    HIP_CHECK(hipMalloc(&d_output, sizeof(T)));
+
+    size_t temp_storage_size_bytes;
+    HIP_CHECK(
+        rocprim::deterministic_reduce<Config>(
+            nullptr, temp_storage_size_bytes,
+            d_input, d_output, initial_value, size,
+            stream, debug_synchronous
+        )
+    );
+    ASSERT_GT(temp_storage_size_bytes, 0);
+
+    void * d_temp_storage;
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+
+    HIP_CHECK(
+        rocprim::deterministic_reduce<Config>(
+            d_temp_storage, temp_storage_size_bytes,
+            d_input, d_output, initial_value, size,
+            stream, debug_synchronous
+        )
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+TYPED_TEST(RocprimDeviceDeterministicReduceTests, DeterministicReduce)
+{
+    using T = typename TestFixture::input_type;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::vector<size_t> sizes = get_sizes(seed_value);
+        sizes.insert(sizes.begin(), 0);
+        for(auto size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Values of different magnitudes, so the result depends on the order of additions
+            std::vector<T> input = test_utils::get_random_data<T>(size, -1000, 1000, seed_value);
+            for(size_t i = 0; i < size; i += 7)
+            {
+                input[i] *= T(1e5);
+            }
+
+            T * d_input;
+            HIP_CHECK(hipMalloc(&d_input, std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    size * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            const T initial_value = T(10);
+
+            // Calculate expected results on host
+            double expected = initial_value;
+            for(size_t i = 0; i < size; i++)
+            {
+                expected += static_cast<double>(input[i]);
+            }
+
+            T output_default, output_multi_launch, output_grid_stride;
+            ASSERT_NO_FATAL_FAILURE((deterministic_reduce_with_config<rp::default_config>(
+                d_input, size, initial_value, output_default
+            )));
+            ASSERT_NO_FATAL_FAILURE((deterministic_reduce_with_config<multi_launch_config>(
+                d_input, size, initial_value, output_multi_launch
+            )));
+            ASSERT_NO_FATAL_FAILURE((deterministic_reduce_with_config<grid_stride_config>(
+                d_input, size, initial_value, output_grid_stride
+            )));
+
+            // Results must be bitwise equal regardless of configs
+            ASSERT_EQ(std::memcmp(&output_default, &output_multi_launch, sizeof(T)), 0);
+            ASSERT_EQ(std::memcmp(&output_default, &output_grid_stride, sizeof(T)), 0);
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_near(output_default, static_cast<T>(expected), 0.0001f)
+            );
+
+            HIP_CHECK(hipFree(d_input));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceDeterministicReduceTests, DeterministicReduceSpecialValues)
+{
+    using T = typename TestFixture::input_type;
+
+    const T inf = std::numeric_limits<T>::infinity();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+
+    std::vector<std::vector<T>> inputs = {
+        { T(1), T(-1), T(0.5) },
+        { T(1), inf, T(-1000) },
+        { -inf, T(1), -inf },
+        { inf, T(1), -inf },
+        { T(1), nan, T(2) },
+        { std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::denorm_min() }
+    };
+
+    for(const auto& input : inputs)
+    {
+        T * d_input;
+        HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+        HIP_CHECK(
+            hipMemcpy(
+                d_input, input.data(),
+                input.size() * sizeof(T),
+                hipMemcpyHostToDevice
+            )
+        );
+
+        T expected = T(0);
+        for(T value : input)
+        {
+            expected += value;
+        }
+
+        T output;
+        ASSERT_NO_FATAL_FAILURE((deterministic_reduce_with_config<rp::default_config>(
+            d_input, input.size(), T(0), output
+        )));
+        if(std::isnan(expected))
+        {
+            ASSERT_TRUE(std::isnan(output));
+        }
+        else
+        {
+            ASSERT_EQ(output, expected);
+        }
+
+        HIP_CHECK(hipFree(d_input));
+    }
+}
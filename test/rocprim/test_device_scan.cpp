@@ -24,6 +24,7 @@
 #include <vector>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 
 // Google Test
 #include <gtest/gtest.h>
@@ -642,3 +643,383 @@ TYPED_TEST(RocprimDeviceScanTests, ExclusiveScanByKey)
     }
     
 }
+
+// ---------------------------------------------------------
+// Test for deterministic_inclusive_scan
+// ---------------------------------------------------------
+
+template<class T>
+class RocprimDeviceDeterministicScanTests : public ::testing::Test
+{
+public:
+    using input_type = T;
+    const bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<float, double> RocprimDeviceDeterministicScanTestsParams;
+
+TYPED_TEST_CASE(RocprimDeviceDeterministicScanTests, RocprimDeviceDeterministicScanTestsParams);
+
+template<class Config, class T>
+void deterministic_inclusive_scan_with_config(T * d_input, size_t size, std::vector<T>& output)
+{
+    hipStream_t stream = 0; // default
+    const bool debug_synchronous = false;
+
+    T * d_output;
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+
+    size_t temp_storage_size_bytes;
+    HIP_CHECK(
+        rocprim::deterministic_inclusive_scan<Config>(
+            nullptr, temp_storage_size_bytes,
+            d_input, d_output, size,
+            stream, debug_synchronous
+        )
+    );
+    ASSERT_GT(temp_storage_size_bytes, 0U);
+
+    void * d_temp_storage;
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+
+    HIP_CHECK(
+        rocprim::deterministic_inclusive_scan<Config>(
+            d_temp_storage, temp_storage_size_bytes,
+            d_input, d_output, size,
+            stream, debug_synchronous
+        )
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    output.resize(size);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+TYPED_TEST(RocprimDeviceDeterministicScanTests, DeterministicInclusiveScan)
+{
+    using T = typename TestFixture::input_type;
+
+    // Different tile sizes and algorithms (reduce-then-scan and look-back)
+    using small_config = rp::scan_config<
+        64, 3, false,
+        rp::block_load_method::block_load_transpose,
+        rp::block_store_method::block_store_transpose,
+        rp::block_scan_algorithm::reduce_then_scan
+    >;
+    using lookback_config = rp::scan_config<
+        256, 7, true,
+        rp::block_load_method::block_load_transpose,
+        rp::block_store_method::block_store_transpose,
+        rp::block_scan_algorithm::using_warp_scan
+    >;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(auto size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Values of different magnitudes, so results depend on the order of additions
+            std::vector<T> input = test_utils::get_random_data<T>(size, -1000, 1000, seed_value);
+            for(size_t i = 0; i < size; i += 7)
+            {
+                input[i] *= T(1e5);
+            }
+
+            T * d_input;
+            HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    size * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<T> expected(size);
+            double sum = 0.0;
+            for(size_t i = 0; i < size; i++)
+            {
+                sum += static_cast<double>(input[i]);
+                expected[i] = static_cast<T>(sum);
+            }
+
+            std::vector<T> output_default, output_small, output_lookback;
+            ASSERT_NO_FATAL_FAILURE((deterministic_inclusive_scan_with_config<rp::default_config>(
+                d_input, size, output_default
+            )));
+            ASSERT_NO_FATAL_FAILURE((deterministic_inclusive_scan_with_config<small_config>(
+                d_input, size, output_small
+            )));
+            ASSERT_NO_FATAL_FAILURE((deterministic_inclusive_scan_with_config<lookback_config>(
+                d_input, size, output_lookback
+            )));
+
+            // Results must be bitwise equal regardless of configs
+            ASSERT_EQ(std::memcmp(output_default.data(), output_small.data(), size * sizeof(T)), 0);
+            ASSERT_EQ(std::memcmp(output_default.data(), output_lookback.data(), size * sizeof(T)), 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                // Absolute error is bounded by the maximum value, not by the prefix sum
+                ASSERT_NEAR(output_default[i], expected[i], 1e5 * 1000 * 1e-4) << "where index = " << i;
+            }
+
+            HIP_CHECK(hipFree(d_input));
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// Test for look-back scan with prefixes that cannot be packed with flags
+// ---------------------------------------------------------
+
+template<class T>
+class RocprimDeviceLookbackScanLargePrefixTests : public ::testing::Test
+{
+public:
+    using input_type = T;
+    const bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<
+    long long,
+    test_utils::custom_test_type<double>,
+    test_utils::custom_test_array_type<int, 10>
+> RocprimDeviceLookbackScanLargePrefixTestsParams;
+
+TYPED_TEST_CASE(RocprimDeviceLookbackScanLargePrefixTests, RocprimDeviceLookbackScanLargePrefixTestsParams);
+
+TYPED_TEST(RocprimDeviceLookbackScanLargePrefixTests, InclusiveScan)
+{
+    using T = typename TestFixture::input_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    // Small tiles, so there are many blocks waiting for prefixes of their predecessors
+    using config = rp::scan_config<
+        64, 2, true,
+        rp::block_load_method::block_load_transpose,
+        rp::block_store_method::block_store_transpose,
+        rp::block_scan_algorithm::using_warp_scan
+    >;
+
+    hipStream_t stream = 0; // default
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(auto size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 10, seed_value);
+            std::vector<T> output(input.size());
+
+            T * d_input;
+            T * d_output;
+            HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_output, output.size() * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            rp::plus<T> scan_op;
+
+            // Calculate expected results on host
+            std::vector<T> expected(input.size());
+            test_utils::host_inclusive_scan(
+                input.begin(), input.end(),
+                expected.begin(), scan_op
+            );
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            void * d_temp_storage = nullptr;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::inclusive_scan<config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input, d_output, input.size(),
+                    scan_op, stream, debug_synchronous
+                )
+            );
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Run
+            HIP_CHECK(
+                rocprim::inclusive_scan<config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input, d_output, input.size(),
+                    scan_op, stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipPeekAtLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Copy output to host
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    output.size() * sizeof(T),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if output values are as expected
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_near(output, expected, 0.01f));
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// Test for back-off policies of look-back scan
+// ---------------------------------------------------------
+
+template<rp::lookback_backoff Backoff>
+struct DeviceScanBackoffParams
+{
+    static constexpr rp::lookback_backoff backoff = Backoff;
+};
+
+template<class Params>
+class RocprimDeviceScanBackoffTests : public ::testing::Test
+{
+public:
+    static constexpr rp::lookback_backoff backoff = Params::backoff;
+    const bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<
+    DeviceScanBackoffParams<rp::lookback_backoff::none>,
+    DeviceScanBackoffParams<rp::lookback_backoff::linear>,
+    DeviceScanBackoffParams<rp::lookback_backoff::exponential>
+> RocprimDeviceScanBackoffTestsParams;
+
+TYPED_TEST_CASE(RocprimDeviceScanBackoffTests, RocprimDeviceScanBackoffTestsParams);
+
+TYPED_TEST(RocprimDeviceScanBackoffTests, InclusiveScan)
+{
+    using T = int;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    // Small tiles, so there are many blocks waiting for prefixes of their predecessors
+    using config = rp::scan_config<
+        64, 2, true,
+        rp::block_load_method::block_load_transpose,
+        rp::block_store_method::block_store_transpose,
+        rp::block_scan_algorithm::using_warp_scan,
+        TestFixture::backoff
+    >;
+
+    hipStream_t stream = 0; // default
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(auto size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 10, seed_value);
+            std::vector<T> output(input.size());
+
+            T * d_input;
+            T * d_output;
+            HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_output, output.size() * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            rp::plus<T> scan_op;
+
+            // Calculate expected results on host
+            std::vector<T> expected(input.size());
+            test_utils::host_inclusive_scan(
+                input.begin(), input.end(),
+                expected.begin(), scan_op
+            );
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            void * d_temp_storage = nullptr;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::inclusive_scan<config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input, d_output, input.size(),
+                    scan_op, stream, debug_synchronous
+                )
+            );
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Run
+            HIP_CHECK(
+                rocprim::inclusive_scan<config>(
+                    d_temp_storage, temp_storage_size_bytes,
+                    d_input, d_output, input.size(),
+                    scan_op, stream, debug_synchronous
+                )
+            );
+            HIP_CHECK(hipPeekAtLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Copy output to host
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    output.size() * sizeof(T),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if output values are as expected
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
@@ -0,0 +1,407 @@
+// MIT License
+//
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <utility>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+// rocPRIM API
+#include <rocprim/rocprim.hpp>
+
+#include "test_utils.hpp"
+
+namespace rp = rocprim;
+
+#define HIP_CHECK(error) ASSERT_EQ(static_cast<hipError_t>(error), hipSuccess)
+
+template<
+    class Key,
+    class Value,
+    class CompareFunction,
+    unsigned int MinSegmentLength,
+    unsigned int MaxSegmentLength,
+    class Config = rp::default_config
+>
+struct params
+{
+    using key_type = Key;
+    using value_type = Value;
+    using compare_function = CompareFunction;
+    static constexpr unsigned int min_segment_length = MinSegmentLength;
+    static constexpr unsigned int max_segment_length = MaxSegmentLength;
+    using config = Config;
+};
+
+template<class Params>
+class RocprimDeviceSegmentedMergeSort : public ::testing::Test {
+public:
+    using params = Params;
+};
+
+// Compares only x, so stability of the sort matters
+struct custom_x_less
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const test_utils::custom_test_type<T>& a, const test_utils::custom_test_type<T>& b) const
+    {
+        return a.x < b.x;
+    }
+};
+
+// Short segments are sorted by logical warps of 8 threads, segments longer than 1000 items
+// by device-wide merge sort
+using small_config = rp::segmented_merge_sort_config<8, 64, rp::kernel_config<64, 3>, 1000>;
+
+typedef ::testing::Types<
+    params<int, int, rp::less<int>, 0, 10>,
+    params<int, short, rp::greater<int>, 0, 100>,
+    params<unsigned char, int, rp::less<unsigned char>, 0, 1000>,
+    params<short, double, rp::less<short>, 100, 10000>,
+    params<long long, test_utils::custom_test_type<char>, rp::greater<long long>, 4000, 8000>,
+    params<float, unsigned int, rp::less<float>, 2, 10>,
+    params<rp::half, rp::half, test_utils::half_less, 0, 1000>,
+    params<test_utils::custom_test_type<float>, int, custom_x_less, 0, 3000>,
+    params<unsigned int, float, rp::less<unsigned int>, 0, 300000>,
+
+    params<int, int, rp::less<int>, 0, 3000, small_config>,
+    params<test_utils::custom_test_type<short>, unsigned char, custom_x_less, 0, 3000, small_config>,
+    params<double, long long, rp::greater<double>, 5, 20, small_config>
+> Params;
+
+TYPED_TEST_CASE(RocprimDeviceSegmentedMergeSort, Params);
+
+template<class Key>
+std::vector<Key> get_keys(size_t size, int seed_value)
+{
+    // Small range of keys, so there are many equal keys
+    return test_utils::get_random_data<Key>(size, 0, 100, seed_value);
+}
+
+std::vector<size_t> get_sizes(int seed_value)
+{
+    std::vector<size_t> sizes = {
+        1024, 2048, 4096, 1792,
+        0, 1, 10, 53, 211, 500,
+        2345, 11001, 34567,
+        1000000,
+        (1 << 16) - 1220
+    };
+    const std::vector<size_t> random_sizes = test_utils::get_random_data<size_t>(5, 1, 100000, seed_value);
+    sizes.insert(sizes.end(), random_sizes.begin(), random_sizes.end());
+    return sizes;
+}
+
+template<class Gen, class Distribution>
+std::vector<unsigned int> get_offsets(size_t size, Gen& gen, Distribution& segment_length_dis)
+{
+    std::vector<unsigned int> offsets;
+    size_t offset = 0;
+    while(offset < size)
+    {
+        offsets.push_back(offset);
+        offset += segment_length_dis(gen);
+    }
+    offsets.push_back(size);
+    return offsets;
+}
+
+TYPED_TEST(RocprimDeviceSegmentedMergeSort, SortKeys)
+{
+    using key_type = typename TestFixture::params::key_type;
+    using compare_function = typename TestFixture::params::compare_function;
+    using config = typename TestFixture::params::config;
+
+    using offset_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    std::random_device rd;
+    std::default_random_engine gen(rd());
+
+    std::uniform_int_distribution<size_t> segment_length_dis(
+        TestFixture::params::min_segment_length,
+        TestFixture::params::max_segment_length
+    );
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input = get_keys<key_type>(size, seed_value);
+
+            std::vector<offset_type> offsets = get_offsets(size, gen, segment_length_dis);
+            const unsigned int segments_count = offsets.size() - 1;
+
+            key_type * d_keys_input;
+            key_type * d_keys_output;
+            HIP_CHECK(hipMalloc(&d_keys_input, std::max<size_t>(size, 1) * sizeof(key_type)));
+            HIP_CHECK(hipMalloc(&d_keys_output, std::max<size_t>(size, 1) * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            offset_type * d_offsets;
+            HIP_CHECK(hipMalloc(&d_offsets, (segments_count + 1) * sizeof(offset_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_offsets, offsets.data(),
+                    (segments_count + 1) * sizeof(offset_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<key_type> expected(keys_input);
+            for(size_t i = 0; i < segments_count; i++)
+            {
+                std::stable_sort(
+                    expected.begin() + offsets[i],
+                    expected.begin() + offsets[i + 1],
+                    compare_function()
+                );
+            }
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(
+                rp::segmented_merge_sort<config>(
+                    nullptr, temporary_storage_bytes,
+                    d_keys_input, d_keys_output, size,
+                    segments_count, d_offsets, d_offsets + 1,
+                    compare_function()
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rp::segmented_merge_sort<config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_keys_input, d_keys_output, size,
+                    segments_count, d_offsets, d_offsets + 1,
+                    compare_function(),
+                    stream, debug_synchronous
+                )
+            );
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    keys_output.data(), d_keys_output,
+                    size * sizeof(key_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_offsets));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceSegmentedMergeSort, SortPairs)
+{
+    using key_type = typename TestFixture::params::key_type;
+    using value_type = typename TestFixture::params::value_type;
+    using compare_function = typename TestFixture::params::compare_function;
+    using config = typename TestFixture::params::config;
+
+    using offset_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    std::random_device rd;
+    std::default_random_engine gen(rd());
+
+    std::uniform_int_distribution<size_t> segment_length_dis(
+        TestFixture::params::min_segment_length,
+        TestFixture::params::max_segment_length
+    );
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input = get_keys<key_type>(size, seed_value);
+            // Values are positions modulo the range of value_type, so stability can be checked
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                values_input[i] = static_cast<value_type>(static_cast<int>(i % 128));
+            }
+
+            std::vector<offset_type> offsets = get_offsets(size, gen, segment_length_dis);
+            const unsigned int segments_count = offsets.size() - 1;
+
+            key_type * d_keys_input;
+            key_type * d_keys_output;
+            HIP_CHECK(hipMalloc(&d_keys_input, std::max<size_t>(size, 1) * sizeof(key_type)));
+            HIP_CHECK(hipMalloc(&d_keys_output, std::max<size_t>(size, 1) * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            value_type * d_values_input;
+            value_type * d_values_output;
+            HIP_CHECK(hipMalloc(&d_values_input, std::max<size_t>(size, 1) * sizeof(value_type)));
+            HIP_CHECK(hipMalloc(&d_values_output, std::max<size_t>(size, 1) * sizeof(value_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_values_input, values_input.data(),
+                    size * sizeof(value_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            offset_type * d_offsets;
+            HIP_CHECK(hipMalloc(&d_offsets, (segments_count + 1) * sizeof(offset_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_offsets, offsets.data(),
+                    (segments_count + 1) * sizeof(offset_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            using key_value = std::pair<key_type, value_type>;
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            for(size_t i = 0; i < segments_count; i++)
+            {
+                std::stable_sort(
+                    expected.begin() + offsets[i],
+                    expected.begin() + offsets[i + 1],
+                    [](const key_value& a, const key_value& b)
+                    {
+                        return compare_function()(a.first, b.first);
+                    }
+                );
+            }
+            std::vector<key_type> keys_expected(size);
+            std::vector<value_type> values_expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                keys_expected[i] = expected[i].first;
+                values_expected[i] = expected[i].second;
+            }
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(
+                rp::segmented_merge_sort<config>(
+                    nullptr, temporary_storage_bytes,
+                    d_keys_input, d_keys_output, d_values_input, d_values_output, size,
+                    segments_count, d_offsets, d_offsets + 1,
+                    compare_function()
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rp::segmented_merge_sort<config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_keys_input, d_keys_output, d_values_input, d_values_output, size,
+                    segments_count, d_offsets, d_offsets + 1,
+                    compare_function(),
+                    stream, debug_synchronous
+                )
+            );
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    keys_output.data(), d_keys_output,
+                    size * sizeof(key_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(
+                hipMemcpy(
+                    values_output.data(), d_values_output,
+                    size * sizeof(value_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_offsets));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+        }
+    }
+}
@@ -21,6 +21,8 @@
 // SOFTWARE.
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <random>
@@ -240,3 +242,431 @@ TYPED_TEST(RocprimDeviceSegmentedReduce, Reduce)
     }
     
 }
+
+template<class Input, class Output, class ReduceOp, class Config>
+struct skewed_params
+{
+    using input_type = Input;
+    using output_type = Output;
+    using reduce_op_type = ReduceOp;
+    using config = Config;
+};
+
+template<class Params>
+class RocprimDeviceSegmentedReduceSkewed : public ::testing::Test {
+public:
+    using params = Params;
+};
+
+// One block per segment
+using block_per_segment_config = rp::reduce_config<64, 3, rp::block_reduce_algorithm::raking_reduce, 0>;
+// Load-balanced
+using balanced_config = rp::balanced_segmented_reduce_config<64, 3, rp::block_reduce_algorithm::raking_reduce, 2>;
+using balanced_small_warps_config = rp::balanced_segmented_reduce_config<32, 2, rp::block_reduce_algorithm::using_warp_reduce, 1>;
+
+typedef ::testing::Types<
+    skewed_params<int, long long, rp::plus<long long>, block_per_segment_config>,
+    skewed_params<int, long long, rp::plus<long long>, balanced_config>,
+    skewed_params<int, long long, rp::plus<long long>, balanced_small_warps_config>,
+    skewed_params<int, long long, rp::plus<long long>, rp::default_config>,
+    skewed_params<double, double, rp::minimum<double>, balanced_config>,
+    skewed_params<custom_short2, custom_int2, rp::plus<custom_int2>, balanced_config>
+> SkewedParams;
+
+TYPED_TEST_CASE(RocprimDeviceSegmentedReduceSkewed, SkewedParams);
+
+TYPED_TEST(RocprimDeviceSegmentedReduceSkewed, Reduce)
+{
+    using input_type = typename TestFixture::params::input_type;
+    using output_type = typename TestFixture::params::output_type;
+    using reduce_op_type = typename TestFixture::params::reduce_op_type;
+    using config = typename TestFixture::params::config;
+    using offset_type = unsigned int;
+
+    const output_type init = output_type(5);
+    const bool debug_synchronous = false;
+    hipStream_t stream = 0; // default
+    reduce_op_type reduce_op;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+
+        // 0: a few giant segments among many short and empty ones,
+        // 1: power-law distribution of lengths,
+        // 2: one segment only
+        for(int distribution = 0; distribution < 3; distribution++)
+        {
+            SCOPED_TRACE(testing::Message() << "with distribution = " << distribution);
+
+            std::vector<size_t> lengths;
+            if(distribution == 0)
+            {
+                std::uniform_int_distribution<size_t> short_dis(0, 20);
+                for(size_t i = 0; i < 3000; i++)
+                {
+                    lengths.push_back(i % 1000 == 500 ? 100000 + i : short_dis(gen));
+                }
+            }
+            else if(distribution == 1)
+            {
+                std::uniform_real_distribution<double> dis(0.0, 1.0);
+                for(size_t i = 0; i < 2000; i++)
+                {
+                    lengths.push_back(static_cast<size_t>(std::pow(1.0 - dis(gen), -2.5)) - 1);
+                    lengths.back() = std::min<size_t>(lengths.back(), 200000);
+                }
+            }
+            else
+            {
+                lengths.push_back(123457);
+            }
+
+            std::vector<offset_type> offsets;
+            size_t size = 0;
+            for(size_t length : lengths)
+            {
+                offsets.push_back(size);
+                size += length;
+            }
+            offsets.push_back(size);
+            const unsigned int segments_count = lengths.size();
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<input_type> values_input =
+                test_utils::get_random_data<input_type>(size, 0, 100, seed_value);
+
+            std::vector<output_type> aggregates_expected;
+            for(unsigned int segment = 0; segment < segments_count; segment++)
+            {
+                output_type aggregate = init;
+                for(size_t i = offsets[segment]; i < offsets[segment + 1]; i++)
+                {
+                    aggregate = reduce_op(aggregate, values_input[i]);
+                }
+                aggregates_expected.push_back(aggregate);
+            }
+
+            input_type * d_values_input;
+            HIP_CHECK(hipMalloc(&d_values_input, std::max<size_t>(size, 1) * sizeof(input_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_values_input, values_input.data(),
+                    size * sizeof(input_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            offset_type * d_offsets;
+            HIP_CHECK(hipMalloc(&d_offsets, (segments_count + 1) * sizeof(offset_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_offsets, offsets.data(),
+                    (segments_count + 1) * sizeof(offset_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            output_type * d_aggregates_output;
+            HIP_CHECK(hipMalloc(&d_aggregates_output, segments_count * sizeof(output_type)));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(
+                rp::segmented_reduce<config>(
+                    nullptr, temporary_storage_bytes,
+                    d_values_input, d_aggregates_output,
+                    segments_count,
+                    d_offsets, d_offsets + 1,
+                    reduce_op, init,
+                    stream, debug_synchronous
+                )
+            );
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void * d_temporary_storage;
+            HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(
+                rp::segmented_reduce<config>(
+                    d_temporary_storage, temporary_storage_bytes,
+                    d_values_input, d_aggregates_output,
+                    segments_count,
+                    d_offsets, d_offsets + 1,
+                    reduce_op, init,
+                    stream, debug_synchronous
+                )
+            );
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<output_type> aggregates_output(segments_count);
+            HIP_CHECK(
+                hipMemcpy(
+                    aggregates_output.data(), d_aggregates_output,
+                    segments_count * sizeof(output_type),
+                    hipMemcpyDeviceToHost
+                )
+            );
+
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_aggregates_output));
+
+            for(unsigned int i = 0; i < segments_count; i++)
+            {
+                ASSERT_EQ(aggregates_output[i], aggregates_expected[i]) << "where index = " << i;
+            }
+        }
+    }
+}
+
+template<class T>
+class RocprimDeviceDeterministicSegmentedReduce : public ::testing::Test {
+public:
+    using input_type = T;
+};
+
+typedef ::testing::Types<float, double> DeterministicParams;
+
+TYPED_TEST_CASE(RocprimDeviceDeterministicSegmentedReduce, DeterministicParams);
+
+template<class Config, class T, class OffsetIterator>
+void deterministic_segmented_reduce_with_config(T * d_input,
+                                                unsigned int segments_count,
+                                                OffsetIterator d_offsets,
+                                                T init,
+                                                std::vector<T>& output)
+{
+    hipStream_t stream = 0; // default
+    const bool debug_synchronous = false;
+
+    T * d_output;
+    HIP_CHECK(hipMalloc(&d_output, segments_count * sizeof(T)));
+
+    size_t temporary_storage_bytes;
+    HIP_CHECK(
+        rp::deterministic_segmented_reduce<Config>(
+            nullptr, temporary_storage_bytes,
+            d_input, d_output,
+            segments_count,
+            d_offsets, d_offsets + 1,
+            init,
+            stream, debug_synchronous
+        )
+    );
+
+    ASSERT_GT(temporary_storage_bytes, 0);
+
+    void * d_temporary_storage;
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(
+        rp::deterministic_segmented_reduce<Config>(
+            d_temporary_storage, temporary_storage_bytes,
+            d_input, d_output,
+            segments_count,
+            d_offsets, d_offsets + 1,
+            init,
+            stream, debug_synchronous
+        )
+    );
+
+    output.resize(segments_count);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), d_output,
+            segments_count * sizeof(T),
+            hipMemcpyDeviceToHost
+        )
+    );
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TYPED_TEST(RocprimDeviceDeterministicSegmentedReduce, Reduce)
+{
+    using input_type = typename TestFixture::input_type;
+    using offset_type = unsigned int;
+
+    using small_config = rp::reduce_config<64, 3, rp::block_reduce_algorithm::raking_reduce>;
+
+    const input_type init = 123;
+
+    std::random_device rd;
+    std::default_random_engine gen(rd());
+    std::uniform_int_distribution<size_t> segment_length_dis(0, 5000);
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data and calculate expected results
+            std::vector<input_type> values_input =
+                test_utils::get_random_data<input_type>(size, -1000, 1000, seed_value);
+            for(size_t i = 0; i < size; i += 7)
+            {
+                values_input[i] *= input_type(1e5);
+            }
+
+            std::vector<input_type> aggregates_expected;
+            std::vector<offset_type> offsets;
+            unsigned int segments_count = 0;
+            size_t offset = 0;
+            while(offset < size)
+            {
+                const size_t segment_length = segment_length_dis(gen);
+                offsets.push_back(offset);
+
+                const size_t end = std::min(size, offset + segment_length);
+                double aggregate = init;
+                for(size_t i = offset; i < end; i++)
+                {
+                    aggregate += static_cast<double>(values_input[i]);
+                }
+                aggregates_expected.push_back(static_cast<input_type>(aggregate));
+
+                segments_count++;
+                offset += segment_length;
+            }
+            offsets.push_back(size);
+
+            input_type * d_values_input;
+            HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(input_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_values_input, values_input.data(),
+                    size * sizeof(input_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            offset_type * d_offsets;
+            HIP_CHECK(hipMalloc(&d_offsets, (segments_count + 1) * sizeof(offset_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_offsets, offsets.data(),
+                    (segments_count + 1) * sizeof(offset_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            std::vector<input_type> output_default, output_small;
+            ASSERT_NO_FATAL_FAILURE((deterministic_segmented_reduce_with_config<rp::default_config>(
+                d_values_input, segments_count, d_offsets, init, output_default
+            )));
+            ASSERT_NO_FATAL_FAILURE((deterministic_segmented_reduce_with_config<small_config>(
+                d_values_input, segments_count, d_offsets, init, output_small
+            )));
+
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_offsets));
+
+            // Results must be bitwise equal regardless of configs
+            ASSERT_EQ(
+                std::memcmp(output_default.data(), output_small.data(), segments_count * sizeof(input_type)),
+                0
+            );
+            for(size_t i = 0; i < segments_count; i++)
+            {
+                // Absolute error is bounded by the maximum value of all segments
+                ASSERT_NEAR(output_default[i], aggregates_expected[i], 1e5 * 1000 * 1e-4) << "where index = " << i;
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceDeterministicSegmentedReduce, ReduceMixedMagnitudes)
+{
+    using input_type = typename TestFixture::input_type;
+    using offset_type = unsigned int;
+
+    const input_type init = 0;
+
+    // Magnitudes of segments differ by many orders, every segment must be accurate
+    const std::vector<double> scales = { 1e-30, 1e30, 1.0, 1e-20, 1e20, 1e-5 };
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+        std::uniform_int_distribution<size_t> segment_length_dis(1, 5000);
+
+        std::vector<input_type> values_input;
+        std::vector<double> aggregates_expected;
+        std::vector<double> abs_aggregates;
+        std::vector<offset_type> offsets;
+        for(size_t segment = 0; segment < 4 * scales.size(); segment++)
+        {
+            const double scale = scales[segment % scales.size()];
+            const size_t segment_length = segment_length_dis(gen);
+            const std::vector<input_type> values =
+                test_utils::get_random_data<input_type>(segment_length, -1000, 1000, seed_value + segment);
+
+            offsets.push_back(values_input.size());
+            double aggregate = init;
+            double abs_aggregate = 0;
+            for(size_t i = 0; i < segment_length; i++)
+            {
+                const input_type value = static_cast<input_type>(values[i] * scale);
+                values_input.push_back(value);
+                aggregate += static_cast<double>(value);
+                abs_aggregate += std::abs(static_cast<double>(value));
+            }
+            aggregates_expected.push_back(aggregate);
+            abs_aggregates.push_back(abs_aggregate);
+        }
+        offsets.push_back(values_input.size());
+
+        const size_t size = values_input.size();
+        const unsigned int segments_count = aggregates_expected.size();
+
+        input_type * d_values_input;
+        HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(input_type)));
+        HIP_CHECK(
+            hipMemcpy(
+                d_values_input, values_input.data(),
+                size * sizeof(input_type),
+                hipMemcpyHostToDevice
+            )
+        );
+
+        offset_type * d_offsets;
+        HIP_CHECK(hipMalloc(&d_offsets, (segments_count + 1) * sizeof(offset_type)));
+        HIP_CHECK(
+            hipMemcpy(
+                d_offsets, offsets.data(),
+                (segments_count + 1) * sizeof(offset_type),
+                hipMemcpyHostToDevice
+            )
+        );
+
+        std::vector<input_type> output;
+        ASSERT_NO_FATAL_FAILURE((deterministic_segmented_reduce_with_config<rp::default_config>(
+            d_values_input, segments_count, d_offsets, init, output
+        )));
+
+        HIP_CHECK(hipFree(d_values_input));
+        HIP_CHECK(hipFree(d_offsets));
+
+        for(size_t i = 0; i < segments_count; i++)
+        {
+            // Error is relative to the magnitude of the segment itself
+            const double tolerance =
+                abs_aggregates[i] * (std::is_same<input_type, float>::value ? 1e-6 : 1e-12);
+            ASSERT_NEAR(static_cast<double>(output[i]), aggregates_expected[i], tolerance)
+                << "where index = " << i;
+        }
+    }
+}
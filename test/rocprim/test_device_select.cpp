@@ -580,3 +580,243 @@ TYPED_TEST(RocprimDeviceSelectTests, Unique)
     }
     
 }
+
+TEST(RocprimDeviceSelectLargeInputTests, SelectOp64BitOffsets)
+{
+    using T = size_t;
+    using config = rocprim::select_config<
+        256, 8,
+        rocprim::block_load_method::block_load_transpose,
+        rocprim::block_load_method::block_load_transpose,
+        rocprim::block_scan_algorithm::using_warp_scan,
+        size_t
+    >;
+    const bool debug_synchronous = false;
+
+    hipStream_t stream = 0; // default stream
+
+    // More than 2^32 values, only every 2^20-th value is selected so the output is small
+    const size_t size = (size_t(1) << 32) + 3 * 1024 * 1024 + 123;
+    const size_t expected_count = (size - 1) / (size_t(1) << 20) + 1;
+    auto select_op = [] __host__ __device__ (const T& value) -> bool
+    {
+        return (value & ((T(1) << 20) - 1)) == 0;
+    };
+    auto input = rocprim::make_counting_iterator<T>(0);
+
+    T * d_output;
+    size_t * d_selected_count_output;
+    HIP_CHECK(hipMalloc(&d_output, expected_count * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_selected_count_output, sizeof(size_t)));
+
+    // 32-bit offsets of the default config are too small
+    size_t temp_storage_size_bytes;
+    ASSERT_EQ(
+        rocprim::select(
+            nullptr, temp_storage_size_bytes,
+            input, d_output, d_selected_count_output, size, select_op,
+            stream, debug_synchronous
+        ),
+        hipErrorInvalidValue
+    );
+
+    HIP_CHECK(
+        rocprim::select<config>(
+            nullptr, temp_storage_size_bytes,
+            input, d_output, d_selected_count_output, size, select_op,
+            stream, debug_synchronous
+        )
+    );
+    ASSERT_GT(temp_storage_size_bytes, 0);
+
+    void * d_temp_storage = nullptr;
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+
+    HIP_CHECK(
+        rocprim::select<config>(
+            d_temp_storage, temp_storage_size_bytes,
+            input, d_output, d_selected_count_output, size, select_op,
+            stream, debug_synchronous
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t selected_count_output = 0;
+    HIP_CHECK(
+        hipMemcpy(
+            &selected_count_output, d_selected_count_output,
+            sizeof(size_t),
+            hipMemcpyDeviceToHost
+        )
+    );
+    ASSERT_EQ(selected_count_output, expected_count);
+
+    std::vector<T> output(expected_count);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), d_output,
+            expected_count * sizeof(T),
+            hipMemcpyDeviceToHost
+        )
+    );
+    for(size_t i = 0; i < expected_count; i++)
+    {
+        ASSERT_EQ(output[i], i << 20) << "where index = " << i;
+    }
+
+    hipFree(d_output);
+    hipFree(d_selected_count_output);
+    hipFree(d_temp_storage);
+}
+
+// Params for tests of back-off policies of the look-back scan
+template<rocprim::lookback_backoff Backoff>
+struct DeviceSelectBackoffParams
+{
+    static constexpr rocprim::lookback_backoff backoff = Backoff;
+};
+
+template<class Params>
+class RocprimDeviceSelectBackoffTests : public ::testing::Test
+{
+public:
+    static constexpr rocprim::lookback_backoff backoff = Params::backoff;
+    const bool debug_synchronous = false;
+};
+
+typedef ::testing::Types<
+    DeviceSelectBackoffParams<rocprim::lookback_backoff::none>,
+    DeviceSelectBackoffParams<rocprim::lookback_backoff::linear>,
+    DeviceSelectBackoffParams<rocprim::lookback_backoff::exponential>
+> RocprimDeviceSelectBackoffTestsParams;
+
+TYPED_TEST_CASE(RocprimDeviceSelectBackoffTests, RocprimDeviceSelectBackoffTestsParams);
+
+TYPED_TEST(RocprimDeviceSelectBackoffTests, SelectOp)
+{
+    using T = int;
+    // Small tiles, so there are many blocks waiting for prefixes of their predecessors
+    using config = rocprim::select_config<
+        64, 2,
+        rocprim::block_load_method::block_load_transpose,
+        rocprim::block_load_method::block_load_transpose,
+        rocprim::block_scan_algorithm::using_warp_scan,
+        unsigned int,
+        TestFixture::backoff
+    >;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(auto size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            T * d_input;
+            T * d_output;
+            unsigned int * d_selected_count_output;
+            HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_output, input.size() * sizeof(T)));
+            HIP_CHECK(hipMalloc(&d_selected_count_output, sizeof(unsigned int)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Calculate expected results on host
+            std::vector<T> expected;
+            expected.reserve(input.size());
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(select_op<T>()(input[i]))
+                {
+                    expected.push_back(input[i]);
+                }
+            }
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            // Get size of d_temp_storage
+            HIP_CHECK(
+                rocprim::select<config>(
+                    nullptr,
+                    temp_storage_size_bytes,
+                    d_input,
+                    d_output,
+                    d_selected_count_output,
+                    input.size(),
+                    select_op<T>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            // allocate temporary storage
+            void * d_temp_storage = nullptr;
+            HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Run
+            HIP_CHECK(
+                rocprim::select<config>(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_input,
+                    d_output,
+                    d_selected_count_output,
+                    input.size(),
+                    select_op<T>(),
+                    stream,
+                    debug_synchronous
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if number of selected value is as expected
+            unsigned int selected_count_output = 0;
+            HIP_CHECK(
+                hipMemcpy(
+                    &selected_count_output, d_selected_count_output,
+                    sizeof(unsigned int),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+            ASSERT_EQ(selected_count_output, expected.size());
+
+            // Check if output values are as expected
+            std::vector<T> output(input.size());
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    output.size() * sizeof(T),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+            ASSERT_NO_FATAL_FAILURE(test_utils::custom_assert_eq(output, expected, expected.size()));
+
+            hipFree(d_input);
+            hipFree(d_output);
+            hipFree(d_selected_count_output);
+            hipFree(d_temp_storage);
+        }
+    }
+}
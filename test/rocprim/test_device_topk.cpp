@@ -0,0 +1,419 @@
+// MIT License
+//
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <utility>
+
+// Google Test
+#include <gtest/gtest.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+// rocPRIM API
+#include <rocprim/rocprim.hpp>
+
+#include "test_utils.hpp"
+
+namespace rp = rocprim;
+
+#define HIP_CHECK(error) ASSERT_EQ(static_cast<hipError_t>(error), hipSuccess)
+
+template<
+    class Key,
+    class Value,
+    bool Descending = false,
+    bool ManyEqualKeys = false,
+    class Config = rp::default_config
+>
+struct params
+{
+    using key_type = Key;
+    using value_type = Value;
+    static constexpr bool descending = Descending;
+    static constexpr bool many_equal_keys = ManyEqualKeys;
+    using config = Config;
+};
+
+template<class Params>
+class RocprimDeviceTopK : public ::testing::Test {
+public:
+    using params = Params;
+};
+
+// 4-bit digits and small tiles, so there are more passes and more tiles per block
+using small_config = rp::topk_config<
+    4,
+    rp::kernel_config<64, 3>,
+    rp::select_config<
+        64, 5,
+        rp::block_load_method::block_load_transpose,
+        rp::block_load_method::block_load_transpose,
+        rp::block_scan_algorithm::using_warp_scan
+    >
+>;
+
+typedef ::testing::Types<
+    params<int, int>,
+    params<unsigned int, short, true>,
+    params<float, int>,
+    params<double, unsigned int, true>,
+    params<long long, char>,
+    params<unsigned char, int, false, true>,
+    params<short, double, true, true>,
+    params<int, test_utils::custom_test_type<float>, false, true>,
+    params<unsigned long long, float, true, true>,
+
+    params<int, int, false, false, small_config>,
+    params<float, long long, true, true, small_config>,
+    params<unsigned short, unsigned char, false, true, small_config>
+> Params;
+
+TYPED_TEST_CASE(RocprimDeviceTopK, Params);
+
+template<class Key, bool ManyEqualKeys>
+auto get_keys(size_t size, int seed_value)
+    -> typename std::enable_if<ManyEqualKeys, std::vector<Key>>::type
+{
+    return test_utils::get_random_data<Key>(size, 0, 20, seed_value);
+}
+
+template<class Key, bool ManyEqualKeys>
+auto get_keys(size_t size, int seed_value)
+    -> typename std::enable_if<!ManyEqualKeys, std::vector<Key>>::type
+{
+    return test_utils::get_random_data<Key>(
+        size,
+        std::is_signed<Key>::value ? std::numeric_limits<Key>::lowest() / 2 : Key(0),
+        std::numeric_limits<Key>::max() / 2,
+        seed_value
+    );
+}
+
+std::vector<size_t> get_sizes(int seed_value)
+{
+    std::vector<size_t> sizes = {
+        0, 1, 10, 53, 211, 1024, 2048, 5096,
+        34567, (1 << 17) - 1220, 1000000
+    };
+    const std::vector<size_t> random_sizes = test_utils::get_random_data<size_t>(3, 1, 100000, seed_value);
+    sizes.insert(sizes.end(), random_sizes.begin(), random_sizes.end());
+    return sizes;
+}
+
+std::vector<size_t> get_ks(size_t size)
+{
+    return { 0, 1, 7, 100, 2345, size / 2, size - 1, size, size + 10 };
+}
+
+template<bool Descending>
+struct key_compare
+{
+    template<class Key>
+    bool operator()(const Key& a, const Key& b) const
+    {
+        return Descending ? b < a : a < b;
+    }
+};
+
+TYPED_TEST(RocprimDeviceTopK, TopKKeys)
+{
+    using key_type = typename TestFixture::params::key_type;
+    using config = typename TestFixture::params::config;
+    constexpr bool descending = TestFixture::params::descending;
+    constexpr bool many_equal_keys = TestFixture::params::many_equal_keys;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input = get_keys<key_type, many_equal_keys>(size, seed_value);
+
+            key_type * d_keys_input;
+            key_type * d_keys_output;
+            HIP_CHECK(hipMalloc(&d_keys_input, std::max<size_t>(size, 1) * sizeof(key_type)));
+            HIP_CHECK(hipMalloc(&d_keys_output, std::max<size_t>(size, 1) * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            std::vector<key_type> expected(keys_input);
+            std::stable_sort(expected.begin(), expected.end(), key_compare<descending>());
+
+            for(size_t k : get_ks(size))
+            {
+                SCOPED_TRACE(testing::Message() << "with k = " << k);
+
+                const size_t output_size = std::min(k, size);
+
+                size_t temporary_storage_bytes = 0;
+                if(descending)
+                {
+                    HIP_CHECK(
+                        rp::topk_keys_desc<config>(
+                            nullptr, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, size, k
+                        )
+                    );
+                }
+                else
+                {
+                    HIP_CHECK(
+                        rp::topk_keys<config>(
+                            nullptr, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, size, k
+                        )
+                    );
+                }
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void * d_temporary_storage;
+                HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+                if(descending)
+                {
+                    HIP_CHECK(
+                        rp::topk_keys_desc<config>(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, size, k,
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+                else
+                {
+                    HIP_CHECK(
+                        rp::topk_keys<config>(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, size, k,
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+
+                std::vector<key_type> keys_output(output_size);
+                HIP_CHECK(
+                    hipMemcpy(
+                        keys_output.data(), d_keys_output,
+                        output_size * sizeof(key_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                const std::vector<key_type> keys_expected(expected.begin(), expected.begin() + output_size);
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceTopK, TopKPairs)
+{
+    using key_type = typename TestFixture::params::key_type;
+    using value_type = typename TestFixture::params::value_type;
+    using config = typename TestFixture::params::config;
+    constexpr bool descending = TestFixture::params::descending;
+    constexpr bool many_equal_keys = TestFixture::params::many_equal_keys;
+
+    hipStream_t stream = 0;
+
+    const bool debug_synchronous = false;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        const std::vector<size_t> sizes = get_sizes(seed_value);
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input = get_keys<key_type, many_equal_keys>(size, seed_value);
+            // Values are positions modulo the range of value_type, so stability can be checked
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                values_input[i] = static_cast<value_type>(static_cast<int>(i % 128));
+            }
+
+            key_type * d_keys_input;
+            key_type * d_keys_output;
+            HIP_CHECK(hipMalloc(&d_keys_input, std::max<size_t>(size, 1) * sizeof(key_type)));
+            HIP_CHECK(hipMalloc(&d_keys_output, std::max<size_t>(size, 1) * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_keys_input, keys_input.data(),
+                    size * sizeof(key_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            value_type * d_values_input;
+            value_type * d_values_output;
+            HIP_CHECK(hipMalloc(&d_values_input, std::max<size_t>(size, 1) * sizeof(value_type)));
+            HIP_CHECK(hipMalloc(&d_values_output, std::max<size_t>(size, 1) * sizeof(value_type)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_values_input, values_input.data(),
+                    size * sizeof(value_type),
+                    hipMemcpyHostToDevice
+                )
+            );
+
+            // Calculate expected results on host
+            using key_value = std::pair<key_type, value_type>;
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            std::stable_sort(
+                expected.begin(), expected.end(),
+                [](const key_value& a, const key_value& b)
+                {
+                    return key_compare<descending>()(a.first, b.first);
+                }
+            );
+
+            for(size_t k : get_ks(size))
+            {
+                SCOPED_TRACE(testing::Message() << "with k = " << k);
+
+                const size_t output_size = std::min(k, size);
+
+                size_t temporary_storage_bytes = 0;
+                if(descending)
+                {
+                    HIP_CHECK(
+                        rp::topk_pairs_desc<config>(
+                            nullptr, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, d_values_input, d_values_output,
+                            size, k
+                        )
+                    );
+                }
+                else
+                {
+                    HIP_CHECK(
+                        rp::topk_pairs<config>(
+                            nullptr, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, d_values_input, d_values_output,
+                            size, k
+                        )
+                    );
+                }
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void * d_temporary_storage;
+                HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+                if(descending)
+                {
+                    HIP_CHECK(
+                        rp::topk_pairs_desc<config>(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, d_values_input, d_values_output,
+                            size, k,
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+                else
+                {
+                    HIP_CHECK(
+                        rp::topk_pairs<config>(
+                            d_temporary_storage, temporary_storage_bytes,
+                            d_keys_input, d_keys_output, d_values_input, d_values_output,
+                            size, k,
+                            stream, debug_synchronous
+                        )
+                    );
+                }
+
+                std::vector<key_type> keys_output(output_size);
+                HIP_CHECK(
+                    hipMemcpy(
+                        keys_output.data(), d_keys_output,
+                        output_size * sizeof(key_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                std::vector<value_type> values_output(output_size);
+                HIP_CHECK(
+                    hipMemcpy(
+                        values_output.data(), d_values_output,
+                        output_size * sizeof(value_type),
+                        hipMemcpyDeviceToHost
+                    )
+                );
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<key_type> keys_expected(output_size);
+                std::vector<value_type> values_expected(output_size);
+                for(size_t i = 0; i < output_size; i++)
+                {
+                    keys_expected[i] = expected[i].first;
+                    values_expected[i] = expected[i].second;
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+        }
+    }
+}